@@ -26,7 +26,7 @@
  */
 
 /** @brief Full version string of the CHDR library. */
-#define CHDR_VERSION          "0.1.0-dev+831d69e2"
+#define CHDR_VERSION          "0.1.0-dev+bfaa55c"
 
 /** @brief CHDR major version number. */
 #define CHDR_VERSION_MAJOR     0
@@ -41,28 +41,44 @@
 #define CHDR_VERSION_TWEAK    "dev"
 
 /** @brief CHDR version metadata string. */
-#define CHDR_VERSION_METADATA "831d69e2"
+#define CHDR_VERSION_METADATA "bfaa55c"
 
 /** @brief Flag indicating whether or not diagnostics should be output by the library (0 = off, 1 = on). */
 #ifndef CHDR_DIAGNOSTICS
 #define CHDR_DIAGNOSTICS 0
 #endif //CHDR_DIAGNOSTICS
 
+/** @brief Flag indicating whether or not the solvers precompiled into `libchdr_static` are linked rather than instantiated (0 = off, 1 = on). */
+#ifndef CHDR_PRECOMPILED
+#define CHDR_PRECOMPILED 0
+#endif //CHDR_PRECOMPILED
+
 /* ReSharper enable CppUnusedIncludeDirective */
 // NOLINTBEGIN(*-include-cleaner)
 
+#include "include/mazes/components.hpp"
+#include "include/mazes/csr.hpp"
+#include "include/mazes/distance_map.hpp"
+#include "include/mazes/flow_field.hpp"
 #include "include/mazes/graph.hpp"
 #include "include/mazes/grid.hpp"
+#include "include/mazes/hierarchy.hpp"
 #include "include/mazes/nodes/id_node.hpp"
 #include "include/mazes/nodes/weighted_node.hpp"
+#include "include/mazes/shortest_path_tree.hpp"
+#include "include/mazes/statistics.hpp"
+#include "include/solvers/arastar.hpp"
 #include "include/solvers/astar.hpp"
 #include "include/solvers/base/bnode.hpp"
+#include "include/solvers/base/budget.hpp"
 #include "include/solvers/base/managed_node.hpp"
 #include "include/solvers/base/mutable_node.hpp"
 #include "include/solvers/base/solver.hpp"
+#include "include/solvers/base/stats.hpp"
 #include "include/solvers/base/unmanaged_node.hpp"
 #include "include/solvers/best_first.hpp"
 #include "include/solvers/bfs.hpp"
+#include "include/solvers/bit_bfs.hpp"
 #include "include/solvers/dfs.hpp"
 #include "include/solvers/dijkstra.hpp"
 #include "include/solvers/eidastar.hpp"
@@ -75,23 +91,38 @@
 #include "include/solvers/gdfs.hpp"
 #include "include/solvers/gjps.hpp"
 #include "include/solvers/gstar.hpp"
+#include "include/solvers/hdastar.hpp"
 #include "include/solvers/idastar.hpp"
 #include "include/solvers/idbest_first.hpp"
 #include "include/solvers/iddfs.hpp"
 #include "include/solvers/jps.hpp"
+#include "include/solvers/lazy_thetastar.hpp"
 #include "include/solvers/mgstar.hpp"
 #include "include/solvers/osmastar.hpp"
+#include "include/solvers/precompiled.hpp"
+#include "include/solvers/registry.hpp"
+#include "include/solvers/selector.hpp"
 #include "include/solvers/smastar.hpp"
 #include "include/types/containers/coord.hpp"
 #include "include/types/containers/existence_set.hpp"
+#include "include/types/containers/flat_map.hpp"
 #include "include/types/containers/heap.hpp"
 #include "include/types/containers/queue.hpp"
+#include "include/types/containers/rle_path.hpp"
 #include "include/types/containers/stack.hpp"
+#include "include/types/containers/waypoint_path.hpp"
+#include "include/types/pmr/accounting_resource.hpp"
+#include "include/types/pmr/backing.hpp"
+#include "include/types/pmr/concurrent_pool.hpp"
 #include "include/types/pmr/heterogeneous_pool.hpp"
 #include "include/types/pmr/homogeneous_pool.hpp"
 #include "include/types/pmr/monotonic_pool.hpp"
+#include "include/types/pmr/pool_registry.hpp"
+#include "include/types/pmr/reset_policy.hpp"
 #include "include/utils/heuristics.hpp"
 #include "include/utils/intrinsics.hpp"
+#include "include/utils/parallel.hpp"
+#include "include/utils/smoothing.hpp"
 #include "include/utils/utils.hpp"
 
 // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,397 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_COMPONENTS_HPP
+#define CHDR_COMPONENTS_HPP
+
+/**
+ * @file components.hpp
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../utils/parallel.hpp"
+#include "../utils/utils.hpp"
+#include "graph.hpp"
+#include "grid.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::mazes {
+
+    /**
+     * @nosubgrouping
+     * @class components
+     * @brief Index of the connected components of a grid or graph.
+     *
+     * @details Labels every node of a maze with the connected component it belongs to, so that whether two nodes are
+     *          connected can be answered without searching. When supplied to the `solver` front door through an
+     *          optional `components` member of `params_t`, queries between disconnected nodes return immediately,
+     *          rather than exhausting the component containing the start.\n\n
+     *
+     *          The index is a concurrent union-find (disjoint-set forest), whose parent links are only ever replaced
+     *          using compare-and-swap. The maze is split into chunks which are united in parallel, after which every
+     *          node is linked directly to its root. Queries on a freshly built index therefore take two loads.\n\n
+     *
+     *          The index may be maintained incrementally. Making a grid cell active, or adding an edge to a graph,
+     *          only unites the affected components. Removals are not tracked: the index stays conservative (it may
+     *          report two nodes as connected when they are no longer), so it never rejects a query which has a
+     *          solution. `rebuild()` restores an exact index.
+     *
+     * @code
+     *
+     * const chdr::mazes::components<index_t> index(grid);
+     *
+     * struct params {
+     *     // ...
+     *     const chdr::mazes::components<index_t>* components = &index;
+     * };
+     *
+     * @endcode
+     *
+     * References:
+     * - Anderson, R. J. and Woll, H., 1991. Wait-free Parallel Algorithms for the Union-Find Problem.
+     *   Proceedings of the 23rd Annual ACM Symposium on Theory of Computing, 370–380.
+     *
+     * @note Edges of graphs are treated as undirected.
+     * @note Queries may be made concurrently with each other, and with `insert()`.
+     *
+     * @tparam index_t          Type used for indexing nodes.
+     * @tparam IncludeDiagonals Whether diagonal neighbours of grid cells are connected. Must be `true` if any
+     *                          solver consulting the index uses `octile_neighbours`.
+     */
+    template <typename index_t, bool IncludeDiagonals = false>
+    class components final {
+
+        /** @brief Grids with fewer cells than this (per thread) are not worth splitting across threads. */
+        static constexpr size_t s_chunk_min = 4096U;
+
+        using parents_t = std::unique_ptr<std::atomic<index_t>[]>;
+
+        mutable parents_t m_parents;
+        size_t m_count;
+
+        /** @brief Dense position of each vertex, when indexing a graph. Empty when indexing a grid. */
+        std::unordered_map<index_t, index_t> m_dense;
+
+        [[nodiscard]] HOT index_t find(index_t _x) const noexcept {
+
+            // Path halving: link each visited node to its grandparent.
+            for (;;) {
+
+                auto p = m_parents[_x].load(std::memory_order_acquire);
+
+                if (p == _x) {
+                    return _x;
+                }
+
+                const auto gp = m_parents[p].load(std::memory_order_acquire);
+
+                if (gp != p) {
+                    m_parents[_x].compare_exchange_weak(p, gp, std::memory_order_acq_rel, std::memory_order_relaxed);
+                }
+
+                _x = gp;
+            }
+        }
+
+        HOT void unite(index_t _a, index_t _b) noexcept {
+
+            for (;;) {
+
+                _a = find(_a);
+                _b = find(_b);
+
+                if (_a == _b) {
+                    return;
+                }
+
+                // Always link the greater root beneath the lesser, so no cycle can form between concurrent unions.
+                if (_a < _b) {
+                    std::swap(_a, _b);
+                }
+
+                if (auto expected = _a; m_parents[_a].compare_exchange_strong(expected, _b, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    return;
+                }
+            }
+        }
+
+        void allocate(size_t _count) {
+
+            m_parents = std::make_unique<std::atomic<index_t>[]>(_count);
+            m_count   = _count;
+
+            for (size_t i = 0U; i < _count; ++i) {
+                m_parents[i].store(static_cast<index_t>(i), std::memory_order_relaxed);
+            }
+        }
+
+        void grow(size_t _count) {
+
+            if (_count > m_count) {
+
+                auto parents = std::make_unique<std::atomic<index_t>[]>(_count);
+
+                for (size_t i = 0U; i < _count; ++i) {
+                    parents[i].store(i < m_count ? m_parents[i].load(std::memory_order_relaxed) : static_cast<index_t>(i), std::memory_order_relaxed);
+                }
+
+                m_parents = std::move(parents);
+                m_count   = _count;
+            }
+        }
+
+        /**
+         * @brief Links every node directly to the root of its component.
+         */
+        void flatten() {
+
+            parallel::for_each(m_count, s_chunk_min, [this](size_t _begin, size_t _end, size_t /*_thread*/) {
+                for (auto i = _begin; i < _end; ++i) {
+                    m_parents[i].store(find(static_cast<index_t>(i)), std::memory_order_release);
+                }
+            });
+        }
+
+        [[nodiscard]] HOT index_t dense(index_t _id) const noexcept {
+
+            if (m_dense.empty()) {
+                return _id;
+            }
+
+            const auto search = m_dense.find(_id);
+            return search != m_dense.end() ? search->second : static_cast<index_t>(m_count);
+        }
+
+        index_t dense_emplace(index_t _id) {
+            return m_dense.try_emplace(_id, static_cast<index_t>(m_dense.size())).first->second;
+        }
+
+    public:
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Builds the connected components of a grid.
+         * @param [in] _grid The grid to index.
+         */
+        template <typename coord_t, typename weight_t>
+        [[maybe_unused, nodiscard]] explicit components(const grid<coord_t, weight_t>& _grid) :
+            m_parents(),
+            m_count  (0U),
+            m_dense  ()
+        {
+            rebuild(_grid);
+        }
+
+        /**
+         * @brief Builds the connected components of a graph.
+         * @param [in] _graph The graph to index.
+         */
+        template <typename scalar_t>
+        [[maybe_unused, nodiscard]] explicit components(const graph<index_t, scalar_t>& _graph) :
+            m_parents(),
+            m_count  (0U),
+            m_dense  ()
+        {
+            rebuild(_graph);
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Rebuilds the index of a grid from scratch.
+         * @param [in] _grid The grid to index.
+         */
+        template <typename coord_t, typename weight_t>
+        void rebuild(const grid<coord_t, weight_t>& _grid) {
+
+            m_dense.clear();
+            allocate(_grid.count());
+
+            /*
+             * Unite each active cell with its active neighbours. Only neighbours with a greater index are considered,
+             * as the remainder are visited from the other side.
+             */
+            parallel::for_each(m_count, s_chunk_min, [this, &_grid](size_t _begin, size_t _end, size_t /*_thread*/) {
+
+                for (auto i = _begin; i < _end; ++i) {
+
+                    if (_grid[i].is_active()) {
+
+                        for (const auto& [nActive, nCoord] : _grid.template get_neighbours<IncludeDiagonals>(static_cast<typename coord_t::value_type>(i))) {
+
+                            if (nActive) {
+
+                                if (const auto n = utils::to_1d(nCoord, _grid.size()); n > i) {
+                                    unite(static_cast<index_t>(i), static_cast<index_t>(n));
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+
+            flatten();
+        }
+
+        /**
+         * @brief Rebuilds the index of a graph from scratch.
+         * @param [in] _graph The graph to index.
+         */
+        template <typename scalar_t>
+        void rebuild(const graph<index_t, scalar_t>& _graph) {
+
+            m_dense.clear();
+
+            // Vertices are not necessarily contiguous, so assign each a dense position first:
+            std::vector<std::pair<index_t, const typename graph<index_t, scalar_t>::neighbours_t*>> vertices;
+            vertices.reserve(_graph.count());
+
+            for (const auto& [id, neighbours] : _graph) {
+
+                dense_emplace(id);
+                vertices.emplace_back(id, &neighbours);
+
+                for (const auto& edge : neighbours) {
+                    dense_emplace(edge.first);
+                }
+            }
+
+            allocate(m_dense.size());
+
+            parallel::for_each(vertices.size(), s_chunk_min, [this, &vertices](size_t _begin, size_t _end, size_t /*_thread*/) {
+
+                for (auto i = _begin; i < _end; ++i) {
+
+                    const auto from = dense(vertices[i].first);
+
+                    for (const auto& edge : *vertices[i].second) {
+                        unite(from, dense(edge.first));
+                    }
+                }
+            });
+
+            flatten();
+        }
+
+        /**
+         * @brief Updates the index after a cell of a grid becomes active.
+         *
+         * @param [in] _grid The grid, after the change.
+         * @param [in]   _id Index of the cell which became active.
+         */
+        template <typename coord_t, typename weight_t>
+        void insert(const grid<coord_t, weight_t>& _grid, index_t _id) noexcept {
+
+            if (_grid[_id].is_active()) {
+
+                for (const auto& [nActive, nCoord] : _grid.template get_neighbours<IncludeDiagonals>(_id)) {
+
+                    if (nActive) {
+                        unite(_id, static_cast<index_t>(utils::to_1d(nCoord, _grid.size())));
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Updates the index after an edge is added to a graph.
+         *
+         * @param [in] _from Vertex from which the edge originates.
+         * @param [in]   _to Vertex to which the edge leads.
+         *
+         * @warning Vertices which were not present when the index was built are added to it, which is not safe to do
+         *          concurrently with queries.
+         */
+        void link(index_t _from, index_t _to) {
+
+            const auto a = dense_emplace(_from);
+            const auto b = dense_emplace(_to);
+
+            grow(m_dense.size());
+            unite(a, b);
+        }
+
+        /**
+         * @brief Checks whether two nodes belong to the same component.
+         *
+         * @param [in] _a Index of the first node.
+         * @param [in] _b Index of the second node.
+         *
+         * @return `true` if a path may exist between the nodes, or `false` if one certainly does not.
+         */
+        [[maybe_unused, nodiscard]] HOT bool connected(index_t _a, index_t _b) const noexcept {
+
+            if (_a == _b) {
+                return true;
+            }
+
+            const auto a = dense(_a);
+            const auto b = dense(_b);
+
+            if (static_cast<size_t>(a) >= m_count || static_cast<size_t>(b) >= m_count) {
+                return false;
+            }
+
+            // Retry if the root of the first node was linked elsewhere in the meantime.
+            for (;;) {
+
+                const auto ra = find(a);
+                const auto rb = find(b);
+
+                if (ra == rb) {
+                    return true;
+                }
+
+                if (m_parents[ra].load(std::memory_order_acquire) == ra) {
+                    return false;
+                }
+            }
+        }
+
+        /**
+         * @brief Label of the component containing a node.
+         *
+         * @details Labels are only stable until the index is next modified.
+         *
+         * @param [in] _id Index of the node.
+         *
+         * @pre The node must be present in the index.
+         */
+        [[maybe_unused, nodiscard]] HOT index_t label(index_t _id) const noexcept {
+            return find(dense(_id));
+        }
+
+        /**
+         * @brief Number of nodes in the index.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t size() const noexcept { return m_count; }
+
+        /**
+         * @brief Whether diagonal neighbours of grid cells are considered connected.
+         */
+        static constexpr bool includes_diagonals = IncludeDiagonals;
+    };
+
+} //chdr::mazes
+
+#endif //CHDR_COMPONENTS_HPP
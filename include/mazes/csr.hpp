@@ -0,0 +1,285 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_CSR_HPP
+#define CHDR_CSR_HPP
+
+/**
+ * @file csr.hpp
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+#include "../utils/parallel.hpp"
+#include "../utils/utils.hpp"
+#include "graph.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::mazes {
+
+    /**
+     * @nosubgrouping
+     * @class csr
+     * @brief Immutable copy of a graph in compressed sparse row (CSR) form.
+     *
+     * @details The adjacency sets of `graph` are convenient to modify, but scattered across memory, and cannot be
+     *          split evenly between threads. A CSR copy stores the edges of every vertex contiguously in a single
+     *          array, indexed by an array of offsets, which is better suited to traversing the whole graph in
+     *          parallel.\n\n
+     *
+     *          Vertex ids need not be contiguous. Each vertex is given a dense position in `[0, count())`, which
+     *          indexes the arrays, and may be converted to and from its id using `dense()` and `id()`.
+     *
+     * @note The copy is not updated when the graph changes.
+     *
+     * @tparam index_t  Type used for indexing vertices.
+     * @tparam scalar_t Type used to store the weights of edges, or `void` if weights are not needed.
+     */
+    template <typename index_t, typename scalar_t = void>
+    class csr final {
+
+        static constexpr bool s_weighted = !std::is_void_v<scalar_t>;
+
+        /** @brief Graphs with fewer vertices than this (per thread) are not worth copying in parallel. */
+        static constexpr size_t s_chunk_min = 4096U;
+
+        using weight_t = std::conditional_t<s_weighted, scalar_t, char>;
+
+        std::unordered_map<index_t, index_t> m_dense;
+        std::pmr::vector<index_t> m_ids;
+
+        std::pmr::vector<size_t>   m_offsets;
+        std::pmr::vector<index_t>  m_targets;
+        std::pmr::vector<weight_t> m_weights;
+
+        index_t dense_emplace(index_t _id) {
+
+            const auto [it, inserted] = m_dense.try_emplace(_id, static_cast<index_t>(m_ids.size()));
+
+            if (inserted) {
+                m_ids.emplace_back(_id);
+            }
+
+            return it->second;
+        }
+
+        explicit csr(std::pmr::memory_resource* _resource) :
+            m_dense  (),
+            m_ids    (_resource),
+            m_offsets(_resource),
+            m_targets(_resource),
+            m_weights(_resource) {}
+
+    public:
+
+        /** @brief Dense position denoting a vertex which is not part of the graph. */
+        static constexpr auto null = std::numeric_limits<index_t>::max();
+
+        /**
+         * @brief Copies a graph.
+         *
+         * @param [in]      _graph The graph to copy.
+         * @param [in, out] _resource Memory resource used to store the copy.
+         */
+        template <typename graph_weight_t>
+        [[maybe_unused, nodiscard]] explicit csr(const graph<index_t, graph_weight_t>& _graph, std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            csr(_resource)
+        {
+            // Vertices are not necessarily contiguous, so assign each a dense position first:
+            std::vector<std::pair<index_t, const typename graph<index_t, graph_weight_t>::neighbours_t*>> vertices;
+            vertices.reserve(_graph.count());
+            m_dense .reserve(_graph.count());
+
+            size_t edges { 0U };
+
+            for (const auto& [id, neighbours] : _graph) {
+
+                vertices.emplace_back(dense_emplace(id), &neighbours);
+
+                for (const auto& edge : neighbours) {
+                    dense_emplace(edge.first);
+                }
+
+                edges += neighbours.size();
+            }
+
+            const auto n = m_ids.size();
+
+            m_offsets.assign(n + 1U, 0U);
+
+            for (const auto& [v, neighbours] : vertices) {
+                m_offsets[v + 1U] = neighbours->size();
+            }
+
+            for (size_t i = 0U; i < n; ++i) {
+                m_offsets[i + 1U] += m_offsets[i];
+            }
+
+            m_targets.resize(edges);
+
+            if constexpr (s_weighted) {
+                m_weights.resize(edges);
+            }
+
+            // The edges of each vertex occupy a known range, so may be copied in parallel:
+            parallel::for_each(vertices.size(), s_chunk_min, [this, &vertices](size_t _begin, size_t _end, size_t /*_thread*/) {
+
+                for (auto i = _begin; i < _end; ++i) {
+
+                    auto e = m_offsets[vertices[i].first];
+
+                    for (const auto& edge : *vertices[i].second) {
+
+                        const auto target = dense(edge.first);
+                        assert(target != null && "Every target must have been assigned a dense position.");
+
+                        m_targets[e] = target;
+
+                        if constexpr (s_weighted) {
+                            m_weights[e] = static_cast<scalar_t>(edge.second);
+                        }
+
+                        ++e;
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Copy of the graph with the direction of every edge reversed.
+         * @details Dense positions are shared with the original.
+         */
+        [[maybe_unused, nodiscard]] csr transpose() const {
+
+            csr result(m_ids.get_allocator().resource());
+
+            result.m_dense = m_dense;
+            result.m_ids   = m_ids;
+
+            const auto n = count();
+
+            result.m_offsets.assign(n + 1U, 0U);
+            result.m_targets.resize(edges());
+
+            if constexpr (s_weighted) {
+                result.m_weights.resize(edges());
+            }
+
+            for (const auto v : m_targets) {
+                ++result.m_offsets[v + 1U];
+            }
+
+            for (size_t i = 0U; i < n; ++i) {
+                result.m_offsets[i + 1U] += result.m_offsets[i];
+            }
+
+            std::vector<size_t> cursor(result.m_offsets.begin(), result.m_offsets.end() - 1);
+
+            for (size_t u = 0U; u < n; ++u) {
+                for (auto e = m_offsets[u]; e < m_offsets[u + 1U]; ++e) {
+
+                    const auto r = cursor[m_targets[e]]++;
+
+                    result.m_targets[r] = static_cast<index_t>(u);
+
+                    if constexpr (s_weighted) {
+                        result.m_weights[r] = m_weights[e];
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Reorders the edges of a vertex so that those whose weight satisfies a predicate come first.
+         *
+         * @param [in]         _v Dense position of the vertex.
+         * @param [in] _predicate Predicate taking the weight of an edge.
+         *
+         * @return Offset of the first edge which does not satisfy the predicate.
+         */
+        template <typename predicate_t>
+        size_t partition(index_t _v, const predicate_t& _predicate) noexcept {
+
+            static_assert(s_weighted, "partition() requires a weighted csr.");
+
+            auto first = m_offsets[_v];
+            auto last  = m_offsets[_v + 1U];
+
+            for (;;) {
+
+                while (first != last &&  _predicate(m_weights[first])) { ++first; }
+                while (first != last && !_predicate(m_weights[last - 1U])) { --last; }
+
+                if (first == last) {
+                    return first;
+                }
+
+                std::swap(m_targets[first], m_targets[last - 1U]);
+                std::swap(m_weights[first], m_weights[last - 1U]);
+            }
+        }
+
+        /**
+         * @brief Dense position of a vertex, or `null` if it is not part of the graph.
+         * @param [in] _id Id of the vertex.
+         */
+        [[maybe_unused, nodiscard]] HOT index_t dense(index_t _id) const noexcept {
+
+            const auto search = m_dense.find(_id);
+            return search != m_dense.end() ? search->second : null;
+        }
+
+        /**
+         * @brief Id of the vertex at a dense position.
+         * @param [in] _v Dense position of the vertex.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr index_t id(index_t _v) const noexcept { return m_ids[_v]; }
+
+        /** @brief Offset of the first edge leaving a vertex. */
+        [[maybe_unused, nodiscard]] HOT constexpr size_t begin(index_t _v) const noexcept { return m_offsets[_v]; }
+
+        /** @brief Offset past the last edge leaving a vertex. */
+        [[maybe_unused, nodiscard]] HOT constexpr size_t end(index_t _v) const noexcept { return m_offsets[_v + 1U]; }
+
+        /** @brief Number of edges leaving a vertex. */
+        [[maybe_unused, nodiscard]] HOT constexpr size_t degree(index_t _v) const noexcept { return end(_v) - begin(_v); }
+
+        /** @brief Dense position of the vertex an edge leads to. */
+        [[maybe_unused, nodiscard]] HOT constexpr index_t target(size_t _e) const noexcept { return m_targets[_e]; }
+
+        /** @brief Weight of an edge. */
+        [[maybe_unused, nodiscard]] HOT constexpr const weight_t& weight(size_t _e) const noexcept {
+
+            static_assert(s_weighted, "weight() requires a weighted csr.");
+
+            return m_weights[_e];
+        }
+
+        /** @brief Number of vertices. */
+        [[maybe_unused, nodiscard]] constexpr size_t count() const noexcept { return m_ids.size(); }
+
+        /** @brief Number of edges. */
+        [[maybe_unused, nodiscard]] constexpr size_t edges() const noexcept { return m_targets.size(); }
+    };
+
+} //chdr::mazes
+
+#endif //CHDR_CSR_HPP
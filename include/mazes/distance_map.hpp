@@ -0,0 +1,470 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_DISTANCE_MAP_HPP
+#define CHDR_DISTANCE_MAP_HPP
+
+/**
+ * @file distance_map.hpp
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+#include "../utils/parallel.hpp"
+#include "../utils/utils.hpp"
+#include "csr.hpp"
+#include "graph.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::mazes {
+
+    /**
+     * @nosubgrouping
+     * @class distance_map
+     * @brief Unit-cost distance from one or more sources to every vertex of a graph.
+     *
+     * @details Runs a parallel, level-synchronous breadth-first search over a graph, and records for each vertex its
+     *          distance (in edges) from the nearest source, and the vertex preceding it on a shortest path. This
+     *          answers whole-graph reachability and hop-count queries, which would otherwise require a search per
+     *          query.\n\n
+     *
+     *          The search is direction-optimising (Beamer et al., 2012). While the frontier is small, each level is
+     *          expanded top-down: threads scan the edges leaving the frontier, claiming unvisited vertices using an
+     *          atomic bitset, and collect them in buffers of their own. Once the edges leaving the frontier outnumber
+     *          those of the unvisited vertices by some margin, the search switches to bottom-up: each unvisited vertex
+     *          scans its incoming edges for a parent in the frontier (held as a bitmap), stopping at the first. Since
+     *          the vertices are divided between threads by whole words of the bitmap, no synchronisation is needed.
+     *          The search switches back to top-down once the frontier shrinks again.\n\n
+     *
+     *          As the adjacency sets of `graph` are not well suited to parallel traversal, a `csr` copy of the graph,
+     *          and of its transpose, is taken on construction. The copy is retained, so that `generate()` may be
+     *          called again for other sources without rebuilding it.
+     *
+     * @code
+     *
+     * chdr::mazes::distance_map<index_t> map(graph, source);
+     *
+     * if (map.reachable(target)) {
+     *     const auto hops = map.distance(target);
+     *     const auto path = map.path(target);
+     * }
+     *
+     * @endcode
+     *
+     * References:
+     * - Beamer, S., Asanović, K. and Patterson, D., 2012. Direction-Optimizing Breadth-First Search.
+     *   Proceedings of the International Conference on High Performance Computing, Networking, Storage and Analysis.
+     *
+     * @note Edges are treated as directed. Weights are ignored.
+     * @note The copy of the graph is not updated when the graph changes. Construct a new map instead.
+     *
+     * @tparam index_t  Type used for indexing vertices.
+     * @tparam scalar_t Type used to store distances.
+     */
+    template <typename index_t, typename scalar_t = uint32_t>
+    class distance_map final {
+
+    public:
+
+        /** @brief Distance of vertices which cannot be reached from any source. */
+        static constexpr scalar_t unreachable = std::numeric_limits<scalar_t>::max();
+
+    private:
+
+        /** @brief Levels (or vertices) smaller than this (per thread) are not worth processing in parallel. */
+        static constexpr size_t s_chunk_min = 4096U;
+
+        /** @brief Switch to bottom-up once the frontier has more than 1/alpha of the unexplored edges. */
+        static constexpr size_t s_alpha = 14U;
+
+        /** @brief Switch back to top-down once the frontier has fewer than 1/beta of all vertices. */
+        static constexpr size_t s_beta = 24U;
+
+        static constexpr size_t s_bits = 64U;
+
+        static constexpr auto s_null = csr<index_t>::null;
+
+        using bitmap_t = std::vector<std::atomic<uint64_t>>;
+
+        /** @brief Outgoing (forward) and incoming (transposed) edges. */
+        csr<index_t> m_out;
+        csr<index_t> m_in;
+
+        std::pmr::vector<scalar_t> m_distances;
+        std::pmr::vector<index_t>  m_parents;
+
+        [[nodiscard]] HOT static bool test(const bitmap_t& _bitmap, size_t _index) noexcept {
+            return ((_bitmap[_index / s_bits].load(std::memory_order_relaxed) >> (_index % s_bits)) & 1U) != 0U;
+        }
+
+        /**
+         * @brief Marks a vertex as visited, returning `true` if this call was the first to do so.
+         */
+        [[nodiscard]] HOT static bool claim(bitmap_t& _visited, size_t _index) noexcept {
+
+            const auto bit = static_cast<uint64_t>(1U) << (_index % s_bits);
+
+            return (_visited[_index / s_bits].fetch_or(bit, std::memory_order_relaxed) & bit) == 0U;
+        }
+
+        /**
+         * @brief Concatenates the buffers of each thread into `_result`, returning the sum of their edge counts.
+         */
+        static size_t gather(std::vector<std::pair<std::vector<index_t>, size_t>>& _locals, std::vector<index_t>& _result) {
+
+            size_t edges { 0U };
+
+            _result.clear();
+
+            for (auto& [vertices, local_edges] : _locals) {
+                _result.insert(_result.end(), vertices.begin(), vertices.end());
+                edges += local_edges;
+
+                vertices.clear();
+                local_edges = 0U;
+            }
+
+            return edges;
+        }
+
+        /**
+         * @brief Expands a level from the edges leaving the frontier.
+         * @return The number of edges leaving the next frontier.
+         */
+        size_t top_down(parallel::pool& _workers, std::vector<index_t>& _frontier, scalar_t _distance, bitmap_t& _visited, std::vector<std::pair<std::vector<index_t>, size_t>>& _locals) {
+
+            _workers.for_each(_frontier.size(), s_chunk_min, [&](size_t _begin, size_t _end, size_t _thread) {
+
+                auto& [next, edges] = _locals[_thread];
+
+                for (auto i = _begin; i < _end; ++i) {
+
+                    const auto u = _frontier[i];
+
+                    for (auto e = m_out.begin(u); e < m_out.end(u); ++e) {
+
+                        // Only the thread which claims a vertex may write to it:
+                        if (const auto v = m_out.target(e); !test(_visited, v) && claim(_visited, v)) {
+
+                            m_distances[v] = _distance;
+                            m_parents  [v] = u;
+
+                            next.emplace_back(v);
+                            edges += m_out.degree(v);
+                        }
+                    }
+                }
+            });
+
+            return gather(_locals, _frontier);
+        }
+
+        /**
+         * @brief Expands a level from the edges entering the unvisited vertices.
+         * @return The number of vertices in, and edges leaving, the next frontier.
+         */
+        std::pair<size_t, size_t> bottom_up(parallel::pool& _workers, const bitmap_t& _frontier, bitmap_t& _next, scalar_t _distance, bitmap_t& _visited) {
+
+            const auto n = m_out.count();
+
+            // Number of vertices in, and edges leaving, the part of the next frontier found by each thread:
+            std::vector<std::pair<size_t, size_t>> counts(_workers.size(), { 0U, 0U });
+
+            // Chunks are whole words, so each word of `_next` and `_visited` is only written by one thread:
+            _workers.for_each(_visited.size(), s_chunk_min / s_bits, [&](size_t _begin, size_t _end, size_t _thread) {
+
+                auto& [vertices, edges] = counts[_thread];
+
+                for (auto w = _begin; w < _end; ++w) {
+
+                    const auto unvisited = ~_visited[w].load(std::memory_order_relaxed);
+
+                    uint64_t found { 0U };
+
+                    for (size_t b = 0U; b < s_bits && (w * s_bits) + b < n; ++b) {
+
+                        if (((unvisited >> b) & 1U) != 0U) {
+
+                            const auto v = static_cast<index_t>((w * s_bits) + b);
+
+                            for (auto e = m_in.begin(v); e < m_in.end(v); ++e) {
+
+                                if (const auto u = m_in.target(e); test(_frontier, u)) {
+
+                                    m_distances[v] = _distance;
+                                    m_parents  [v] = u;
+
+                                    found |= static_cast<uint64_t>(1U) << b;
+                                    ++vertices;
+                                    edges += m_out.degree(v);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+
+                    _next   [w].store  (found, std::memory_order_relaxed);
+                    _visited[w].fetch_or(found, std::memory_order_relaxed);
+                }
+            });
+
+            std::pair<size_t, size_t> result { 0U, 0U };
+
+            for (const auto& [vertices, edges] : counts) {
+                result.first  += vertices;
+                result.second += edges;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Converts a frontier from a list of vertices to a bitmap.
+         */
+        static void to_bitmap(parallel::pool& _workers, const std::vector<index_t>& _frontier, bitmap_t& _bitmap) {
+
+            _workers.for_each(_bitmap.size(), s_chunk_min, [&_bitmap](size_t _begin, size_t _end, size_t /*_thread*/) {
+                for (auto w = _begin; w < _end; ++w) {
+                    _bitmap[w].store(0U, std::memory_order_relaxed);
+                }
+            });
+
+            _workers.for_each(_frontier.size(), s_chunk_min, [&_frontier, &_bitmap](size_t _begin, size_t _end, size_t /*_thread*/) {
+                for (auto i = _begin; i < _end; ++i) {
+                    _bitmap[_frontier[i] / s_bits].fetch_or(static_cast<uint64_t>(1U) << (_frontier[i] % s_bits), std::memory_order_relaxed);
+                }
+            });
+        }
+
+        /**
+         * @brief Converts a frontier from a bitmap to a list of vertices.
+         */
+        static void to_list(parallel::pool& _workers, const bitmap_t& _bitmap, std::vector<index_t>& _frontier, std::vector<std::pair<std::vector<index_t>, size_t>>& _locals) {
+
+            _workers.for_each(_bitmap.size(), s_chunk_min / s_bits, [&_bitmap, &_locals](size_t _begin, size_t _end, size_t _thread) {
+
+                auto& local = _locals[_thread].first;
+
+                for (auto w = _begin; w < _end; ++w) {
+
+                    if (const auto word = _bitmap[w].load(std::memory_order_relaxed); word != 0U) {
+
+                        for (size_t b = 0U; b < s_bits; ++b) {
+                            if (((word >> b) & 1U) != 0U) {
+                                local.emplace_back(static_cast<index_t>((w * s_bits) + b));
+                            }
+                        }
+                    }
+                }
+            });
+
+            gather(_locals, _frontier);
+        }
+
+    public:
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Generates the distances of a graph from a single source.
+         *
+         * @param [in]      _graph The graph to generate the distances for.
+         * @param [in]     _source The source vertex.
+         * @param [in, out] _resource Memory resource used to store the map.
+         */
+        template <typename weight_t>
+        [[maybe_unused, nodiscard]] distance_map(const graph<index_t, weight_t>& _graph, index_t _source, std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            distance_map(_graph, std::vector<index_t> { _source }, _resource) {}
+
+        /**
+         * @brief Generates the distances of a graph from the nearest of several sources.
+         *
+         * @param [in]      _graph The graph to generate the distances for.
+         * @param [in]    _sources The source vertices.
+         * @param [in, out] _resource Memory resource used to store the map.
+         */
+        template <typename weight_t>
+        [[maybe_unused, nodiscard]] distance_map(const graph<index_t, weight_t>& _graph, const std::vector<index_t>& _sources, std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            m_out      (_graph, _resource),
+            m_in       (m_out.transpose()),
+            m_distances(_resource),
+            m_parents  (_resource)
+        {
+            generate(_sources);
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Regenerates the distances from other sources, reusing the copy of the graph.
+         *
+         * @param [in] _sources The source vertices. Vertices which are not part of the graph are ignored.
+         * @param [in] _threads The most threads to use, including the calling thread.
+         */
+        void generate(const std::vector<index_t>& _sources, size_t _threads = parallel::max_threads()) {
+
+            const auto n     = m_out.count();
+            const auto words = (n + s_bits - 1U) / s_bits;
+
+            m_distances.assign(n, unreachable);
+            m_parents  .assign(n, s_null);
+
+            bitmap_t visited(words);
+            bitmap_t frontier_bits(words);
+            bitmap_t next_bits(words);
+
+            // Workers persist across every level of the search:
+            parallel::pool workers(_threads);
+
+            std::vector<std::pair<std::vector<index_t>, size_t>> locals(workers.size());
+
+            std::vector<index_t> frontier;
+
+            size_t frontier_edges { 0U };
+
+            for (const auto& source : _sources) {
+
+                if (const auto s = m_out.dense(source); s != s_null && claim(visited, s)) {
+
+                    m_distances[s] = static_cast<scalar_t>(0);
+                    m_parents  [s] = s;
+
+                    frontier.emplace_back(s);
+                    frontier_edges += m_out.degree(s);
+                }
+            }
+
+            auto unexplored_edges = m_out.edges() - frontier_edges;
+
+            auto frontier_size = frontier.size();
+            auto   last_size   = frontier_size;
+
+            bool is_bottom_up { false };
+
+            for (auto distance = static_cast<scalar_t>(1); frontier_size != 0U; ++distance) {
+
+                // Choose the direction of the next step:
+                if (!is_bottom_up) {
+
+                    if (frontier_edges > unexplored_edges / s_alpha) {
+                        to_bitmap(workers, frontier, frontier_bits);
+                        is_bottom_up = true;
+                    }
+                }
+                else if (frontier_size < n / s_beta && frontier_size < last_size) {
+                    to_list(workers, frontier_bits, frontier, locals);
+                    is_bottom_up = false;
+                }
+
+                last_size = frontier_size;
+
+                if (is_bottom_up) {
+                    std::tie(frontier_size, frontier_edges) = bottom_up(workers, frontier_bits, next_bits, distance, visited);
+                    std::swap(frontier_bits, next_bits);
+                }
+                else {
+                    frontier_edges = top_down(workers, frontier, distance, visited, locals);
+                    frontier_size  = frontier.size();
+                }
+
+                unexplored_edges -= utils::min(frontier_edges, unexplored_edges);
+            }
+        }
+
+        /**
+         * @brief Distance from the nearest source to a vertex, or `unreachable` if it cannot be reached.
+         * @param [in] _id The vertex.
+         */
+        [[maybe_unused, nodiscard]] HOT scalar_t distance(index_t _id) const noexcept {
+
+            const auto v = m_out.dense(_id);
+            return v != s_null ? m_distances[v] : unreachable;
+        }
+
+        /**
+         * @brief Checks whether a vertex can be reached from any source.
+         * @param [in] _id The vertex.
+         */
+        [[maybe_unused, nodiscard]] HOT bool reachable(index_t _id) const noexcept {
+            return distance(_id) != unreachable;
+        }
+
+        /**
+         * @brief The vertex preceding another on a shortest path from the nearest source.
+         *
+         * @param [in] _id The vertex.
+         *
+         * @return The preceding vertex, or `_id` itself if it is a source.
+         *
+         * @pre The vertex must be reachable.
+         */
+        [[maybe_unused, nodiscard]] HOT index_t parent(index_t _id) const noexcept {
+
+            assert(reachable(_id) && "The vertex must be reachable.");
+
+            return m_out.id(m_parents[m_out.dense(_id)]);
+        }
+
+        /**
+         * @brief A shortest path from the nearest source to a vertex.
+         *
+         * @param [in] _id The vertex.
+         *
+         * @return The vertices of the path, from the source to `_id` (inclusive), or an empty path if the vertex
+         *         cannot be reached.
+         */
+        [[maybe_unused, nodiscard]] std::vector<index_t> path(index_t _id) const {
+
+            std::vector<index_t> result;
+
+            if (auto v = m_out.dense(_id); v != s_null && m_distances[v] != unreachable) {
+
+                result.reserve(static_cast<size_t>(m_distances[v]) + 1U);
+
+                for (;; v = m_parents[v]) {
+
+                    result.emplace_back(m_out.id(v));
+
+                    if (m_parents[v] == v) {
+                        break;
+                    }
+                }
+
+                std::reverse(result.begin(), result.end());
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Number of vertices in the map.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t size() const noexcept { return m_out.count(); }
+    };
+
+} //chdr::mazes
+
+#endif //CHDR_DISTANCE_MAP_HPP
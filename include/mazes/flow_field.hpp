@@ -0,0 +1,315 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_FLOW_FIELD_HPP
+#define CHDR_FLOW_FIELD_HPP
+
+/**
+ * @file flow_field.hpp
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+#include "../utils/parallel.hpp"
+#include "../utils/utils.hpp"
+#include "grid.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::mazes {
+
+    /**
+     * @nosubgrouping
+     * @class flow_field
+     * @brief Distance and direction to the nearest goal, for every cell of a grid.
+     *
+     * @details Runs a single search outwards from one or more goals, and records for each reachable cell its distance
+     *          to the nearest goal, and the direction of the neighbour which leads towards it. Any number of agents
+     *          heading for the same goals can then follow the field, at a cost of O(1) per step, rather than each
+     *          running a search of its own.\n\n
+     *
+     *          As every move within a grid has unit cost, the search is a breadth-first wavefront, which is
+     *          equivalent to a reverse Dijkstra's algorithm. Large wavefronts are expanded in parallel: each thread
+     *          claims cells using an atomic bitset, so every cell is written by exactly one thread.\n\n
+     *
+     *          Directions are stored as a base-3 number with one digit per axis (0, 1 and 2 denote a step of -1, 0 and
+     *          +1), in the same encoding used by `rle_path`. Goals and unreachable cells are given the null direction.
+     *
+     * @code
+     *
+     * const chdr::mazes::flow_field<coord_t> field(grid, { goal_a, goal_b });
+     *
+     * for (auto& agent : agents) {
+     *     agent.position = field.next(agent.position);
+     * }
+     *
+     * @endcode
+     *
+     * @note Edges are assumed to be undirected, which holds for all grids.
+     *
+     * @tparam coord_t          Type representing coordinates.
+     * @tparam scalar_t         Type used to store distances.
+     * @tparam IncludeDiagonals Whether agents may move diagonally.
+     */
+    template <typename coord_t, typename scalar_t = uint32_t, bool IncludeDiagonals = false>
+    class flow_field final {
+
+        static constexpr size_t Kd = std::tuple_size_v<coord_t>;
+
+        static_assert(Kd <= 20U, "flow_field supports at most 20 dimensions.");
+
+    public:
+
+        /**
+         * @brief Integral type used to store a direction.
+         * @details Each direction is a base-3 number with one digit per axis, so its width is chosen to fit 3^Kd values.
+         */
+        using direction_type = std::conditional_t<(Kd <=  5U), uint8_t,
+                               std::conditional_t<(Kd <= 10U), uint16_t,
+                                                               uint32_t>>;
+
+        /** @brief Distance of cells from which no goal can be reached. */
+        static constexpr scalar_t unreachable = std::numeric_limits<scalar_t>::max();
+
+        /** @brief Direction of goals, and of cells from which no goal can be reached. */
+        static constexpr auto none = static_cast<direction_type>((utils::powui<uint64_t>(3U, Kd) - 1U) / 2U);
+
+    private:
+
+        using value_t = typename coord_t::value_type;
+
+        /** @brief Wavefronts smaller than this (per thread) are not worth expanding in parallel. */
+        static constexpr size_t s_chunk_min = 4096U;
+
+        coord_t m_size;
+
+        std::pmr::vector<scalar_t>       m_distances;
+        std::pmr::vector<direction_type> m_directions;
+
+        [[nodiscard]] HOT static constexpr direction_type encode(const coord_t& _from, const coord_t& _to) noexcept {
+
+            direction_type result { 0U };
+            direction_type place  { 1U };
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                result += static_cast<direction_type>(static_cast<direction_type>(utils::sign<int64_t>(static_cast<int64_t>(_to[i]) - static_cast<int64_t>(_from[i])) + 1) * place);
+                place  *= static_cast<direction_type>(3U);
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Marks a cell as visited, returning `true` if this call was the first to do so.
+         */
+        [[nodiscard]] HOT static bool claim(std::vector<std::atomic<uint64_t>>& _visited, size_t _index) noexcept {
+
+            const auto bit = static_cast<uint64_t>(1U) << (_index % 64U);
+
+            return (_visited[_index / 64U].fetch_or(bit, std::memory_order_relaxed) & bit) == 0U;
+        }
+
+        /**
+         * @brief Expands part of a wavefront, appending each newly claimed cell to `_next`.
+         */
+        template <typename weight_t>
+        HOT void expand(const grid<coord_t, weight_t>& _grid, const std::vector<size_t>& _frontier, size_t _begin, size_t _end, scalar_t _distance, std::vector<std::atomic<uint64_t>>& _visited, std::vector<size_t>& _next) {
+
+            for (auto i = _begin; i < _end; ++i) {
+
+                const auto curr_coord = utils::to_nd(static_cast<value_t>(_frontier[i]), m_size);
+
+                for (const auto& [nActive, nCoord] : _grid.template get_neighbours<IncludeDiagonals>(curr_coord)) {
+
+                    if (nActive) {
+
+                        // Only the thread which claims a cell may write to it:
+                        if (const auto n = utils::to_1d(nCoord, m_size); claim(_visited, n)) {
+
+                            m_distances [n] = _distance;
+                            m_directions[n] = encode(nCoord, curr_coord);
+
+                            _next.emplace_back(n);
+                        }
+                    }
+                }
+            }
+        }
+
+    public:
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Generates the flow field of a grid towards a single goal.
+         *
+         * @param [in]     _grid The grid to generate the field for.
+         * @param [in]     _goal The goal.
+         * @param [in, out] _resource Memory resource used to store the field.
+         */
+        template <typename weight_t>
+        [[maybe_unused, nodiscard]] flow_field(const grid<coord_t, weight_t>& _grid, const coord_t& _goal, std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            m_size      (_grid.size()),
+            m_distances (_resource),
+            m_directions(_resource)
+        {
+            generate(_grid, std::vector<coord_t> { _goal });
+        }
+
+        /**
+         * @brief Generates the flow field of a grid towards the nearest of several goals.
+         *
+         * @param [in]     _grid The grid to generate the field for.
+         * @param [in]    _goals The goals.
+         * @param [in, out] _resource Memory resource used to store the field.
+         */
+        template <typename weight_t>
+        [[maybe_unused, nodiscard]] flow_field(const grid<coord_t, weight_t>& _grid, const std::vector<coord_t>& _goals, std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            m_size      (_grid.size()),
+            m_distances (_resource),
+            m_directions(_resource)
+        {
+            generate(_grid, _goals);
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Regenerates the field, for instance after the grid or goals have changed.
+         *
+         * @param [in]  _grid The grid to generate the field for.
+         * @param [in] _goals The goals. Inactive goals are ignored.
+         */
+        template <typename weight_t>
+        void generate(const grid<coord_t, weight_t>& _grid, const std::vector<coord_t>& _goals) {
+
+            m_size = _grid.size();
+
+            const auto count = _grid.count();
+
+            m_distances .assign(count, unreachable);
+            m_directions.assign(count, none);
+
+            std::vector<std::atomic<uint64_t>> visited((count + 63U) / 64U);
+
+            std::vector<size_t> frontier;
+
+            for (const auto& goal : _goals) {
+
+                const auto g = utils::to_1d(goal, m_size);
+
+                if (_grid[g].is_active() && claim(visited, g)) {
+                    m_distances[g] = static_cast<scalar_t>(0);
+                    frontier.emplace_back(g);
+                }
+            }
+
+            // Workers persist across every level of the wavefront:
+            parallel::pool workers;
+
+            std::vector<std::vector<size_t>> next(workers.size());
+
+            for (auto distance = static_cast<scalar_t>(1); !frontier.empty(); ++distance) {
+
+                for (auto& local : next) {
+                    local.clear();
+                }
+
+                workers.for_each(frontier.size(), s_chunk_min, [this, &_grid, &frontier, &visited, &next, distance](size_t _begin, size_t _end, size_t _thread) {
+                    expand(_grid, frontier, _begin, _end, distance, visited, next[_thread]);
+                });
+
+                // Concatenate the next wavefront:
+                frontier.clear();
+
+                for (const auto& local : next) {
+                    frontier.insert(frontier.end(), local.begin(), local.end());
+                }
+            }
+        }
+
+        /**
+         * @brief Distance from a cell to the nearest goal, or `unreachable` if no goal can be reached from it.
+         * @param [in] _coord The cell.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr scalar_t distance(const coord_t& _coord) const noexcept {
+            return m_distances[utils::to_1d(_coord, m_size)];
+        }
+
+        /**
+         * @brief Direction in which to step from a cell towards the nearest goal.
+         * @param [in] _coord The cell.
+         * @return The direction, or `none` if the cell is a goal, or no goal can be reached from it.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr direction_type direction(const coord_t& _coord) const noexcept {
+            return m_directions[utils::to_1d(_coord, m_size)];
+        }
+
+        /**
+         * @brief Checks whether a goal can be reached from a cell.
+         * @param [in] _coord The cell.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr bool reachable(const coord_t& _coord) const noexcept {
+            return distance(_coord) != unreachable;
+        }
+
+        /**
+         * @brief The next cell on the way from a cell to the nearest goal.
+         *
+         * @param [in] _coord The cell.
+         *
+         * @return The neighbour to step to, or `_coord` itself if it is a goal, or no goal can be reached from it.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr coord_t next(const coord_t& _coord) const noexcept {
+
+            coord_t result = _coord;
+
+            auto code = direction(_coord);
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                result[i] = static_cast<value_t>(result[i] + static_cast<value_t>(static_cast<int>(code % 3U) - 1));
+                code /= 3U;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Distances of every cell, indexed by their position in the grid.
+         */
+        [[maybe_unused, nodiscard]] constexpr const std::pmr::vector<scalar_t>& distances() const noexcept { return m_distances; }
+
+        /**
+         * @brief Directions of every cell, indexed by their position in the grid.
+         */
+        [[maybe_unused, nodiscard]] constexpr const std::pmr::vector<direction_type>& directions() const noexcept { return m_directions; }
+
+        /**
+         * @brief Size of the grid the field was generated for.
+         */
+        [[maybe_unused, nodiscard]] constexpr const coord_t& size() const noexcept { return m_size; }
+    };
+
+} //chdr::mazes
+
+#endif //CHDR_FLOW_FIELD_HPP
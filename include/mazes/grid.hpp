@@ -348,7 +348,7 @@ namespace chdr::mazes {
 
             size_t count = 0U;
 
-            for (const auto& [nActive, _] : get_neighbours(_index)) {
+            for (const auto& [nActive, _] : get_neighbours(static_cast<typename coord_t::value_type>(_index))) {
 
                 if (nActive) {
                     if (++count > 2U) {
@@ -807,7 +807,7 @@ namespace chdr::mazes {
         [[nodiscard]] constexpr bool is_transitory(size_t _index) const noexcept {
             size_t count = 0U;
 
-            for (const auto& [nActive, _] : get_neighbours(_index)) {
+            for (const auto& [nActive, _] : get_neighbours(static_cast<typename coord_t::value_type>(_index))) {
 
                 if (nActive) {
                     if (++count > 2U) {
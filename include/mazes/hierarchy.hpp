@@ -0,0 +1,851 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_HIERARCHY_HPP
+#define CHDR_HIERARCHY_HPP
+
+/**
+ * @file hierarchy.hpp
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+#include "../types/containers/heap.hpp"
+#include "../utils/parallel.hpp"
+#include "../utils/utils.hpp"
+#include "graph.hpp"
+#include "grid.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::mazes {
+
+    /**
+     * @nosubgrouping
+     * @class hierarchy
+     * @brief Hierarchical abstraction of a grid, for Hierarchical Pathfinding A* (HPA*).
+     *
+     * @details HPA* (Botea et al., 2004) partitions a grid into equally-sized clusters. Wherever two adjacent clusters
+     *          share a contiguous run of traversable cells along their common border (an "entrance"), one or two
+     *          "transitions" are placed across it. The cells either side of a transition become nodes of an abstract
+     *          graph, connected to each other by an inter-cluster edge, and to every other node of the same cluster
+     *          by an intra-cluster edge weighted with the length of the shortest path between them inside the cluster.\n\n
+     *
+     *          A query connects its start and end to the abstract graph, searches the (much smaller) abstract graph,
+     *          and returns the abstract path. Each segment of the abstract path lies within a single cluster, and is
+     *          only refined into grid cells when requested using `refine()`, so long routes can be followed without
+     *          ever materialising the complete low-level path.\n\n
+     *
+     *          Intra-cluster distances are computed in parallel across clusters during construction. When the grid is
+     *          edited, `update()` rebuilds only the cluster containing the edited cell and those sharing a border with
+     *          it.\n\n
+     *
+     *          Nodes of the abstract graph are identified by the index of their cell in the grid, so the graph
+     *          returned by `abstract_graph()` may also be searched directly using any solver, with `params_t::size` set to the
+     *          size of the grid.
+     *
+     * @code
+     *
+     * const chdr::mazes::hierarchy<coord_t, weight_t, index_t, scalar_t> hpa(grid, { 32U, 32U });
+     *
+     * const auto route = hpa.find(start, end); // Abstract path, from start to end.
+     *
+     * std::vector<coord_t> cells;
+     * for (size_t i = 1U; i < route.size(); ++i) {
+     *     hpa.refine(route[i - 1U], route[i], cells); // Refine one segment at a time, as needed.
+     * }
+     *
+     * @endcode
+     *
+     * References:
+     * - Botea, A., Müller, M. and Schaeffer, J., 2004. Near Optimal Hierarchical Path-Finding.
+     *   Journal of Game Development, 1 (1), 7–28.
+     *
+     * @note Paths are near-optimal. Transitions restrict where the path may cross between clusters.
+     * @note Queries may be made concurrently, provided that `update()` is not called at the same time.
+     *
+     * @tparam coord_t          Type representing coordinates.
+     * @tparam weight_t         Type representing node weights of the grid.
+     * @tparam index_t          Type used for indexing nodes of the abstract graph.
+     * @tparam scalar_t         Type used for edge weights of the abstract graph.
+     * @tparam IncludeDiagonals Whether paths may move diagonally. Must match the solvers used with the abstract graph.
+     */
+    template <typename coord_t, typename weight_t, typename index_t = size_t, typename scalar_t = uint32_t, bool IncludeDiagonals = false>
+    class hierarchy final {
+
+    public:
+
+        using  grid_t = grid<coord_t, weight_t>;
+        using graph_t = graph<index_t, scalar_t>;
+
+    private:
+
+        using value_t = typename coord_t::value_type;
+
+        static constexpr size_t Kd = std::tuple_size_v<coord_t>;
+
+        /** @brief Entrances at least this wide are given a transition at each end, rather than one in the middle. */
+        static constexpr size_t s_entrance_split = 6U;
+
+        static constexpr scalar_t s_unreachable = std::numeric_limits<scalar_t>::max();
+
+        /** @brief A pair of adjacent cells, the first in a cluster, and the second in its neighbour along an axis. */
+        using transition_t = std::pair<index_t, index_t>;
+
+        using edge_list_t = std::vector<std::tuple<index_t, index_t, scalar_t>>;
+
+        /** @brief Open set entry of the abstract search. */
+        struct node final {
+
+            index_t  m_index;
+            scalar_t m_gScore;
+            scalar_t m_fScore;
+
+            [[nodiscard]] HOT friend constexpr bool operator < (const node& _a, const node& _b) noexcept {
+                return _a.m_fScore == _b.m_fScore ?
+                       _a.m_gScore >  _b.m_gScore :
+                       _a.m_fScore >  _b.m_fScore;
+            }
+        };
+
+        /** @brief An axis-aligned region of the grid. The upper bound is exclusive. */
+        struct region final {
+            coord_t lo;
+            coord_t hi;
+        };
+
+        const grid_t& m_grid;
+
+        coord_t m_cluster_size;
+        coord_t m_clusters;
+         size_t m_cluster_count;
+
+        std::vector<std::vector<transition_t>> m_faces; // Transitions to the next cluster along each axis: [cluster * Kd + axis].
+        std::vector<std::vector<index_t>>      m_nodes; // Abstract nodes within each cluster: [cluster].
+
+        graph_t m_graph;
+
+        [[nodiscard]] constexpr region bounds(size_t _cluster) const noexcept {
+
+            const auto c = utils::to_nd(static_cast<value_t>(_cluster), m_clusters);
+
+            region result {};
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                result.lo[i] = static_cast<value_t>(c[i] * m_cluster_size[i]);
+                result.hi[i] = utils::min(static_cast<value_t>(result.lo[i] + m_cluster_size[i]), m_grid.size()[i]);
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] static constexpr bool inside(const region& _region, const coord_t& _coord) noexcept {
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                if (_coord[i] < _region.lo[i] || _coord[i] >= _region.hi[i]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] static constexpr size_t local(const region& _region, const coord_t& _coord) noexcept {
+
+            coord_t offset {};
+            coord_t extent {};
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                offset[i] = static_cast<value_t>(_coord[i]     - _region.lo[i]);
+                extent[i] = static_cast<value_t>(_region.hi[i] - _region.lo[i]);
+            }
+
+            return static_cast<size_t>(utils::to_1d(offset, extent));
+        }
+
+        [[nodiscard]] static constexpr coord_t global(const region& _region, size_t _local) noexcept {
+
+            coord_t extent {};
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                extent[i] = static_cast<value_t>(_region.hi[i] - _region.lo[i]);
+            }
+
+            auto result = utils::to_nd(static_cast<value_t>(_local), extent);
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                result[i] = static_cast<value_t>(result[i] + _region.lo[i]);
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] constexpr coord_t coord_of(index_t _index) const noexcept {
+            return utils::to_nd(static_cast<value_t>(_index), m_grid.size());
+        }
+
+        [[nodiscard]] constexpr index_t index_of(const coord_t& _coord) const noexcept {
+            return static_cast<index_t>(utils::to_1d(_coord, m_grid.size()));
+        }
+
+        /**
+         * @brief Breadth-first search from a cell, restricted to a region.
+         *
+         * @param [in]      _region The region to search within.
+         * @param [in]        _from The cell to search from. Must lie within `_region`.
+         * @param [out]   _distance Distance to each cell of the region, by local index.
+         * @param [out]    _parents (optional) Parent of each cell of the region, by local index.
+         */
+        void flood(const region& _region, const coord_t& _from, std::vector<scalar_t>& _distance, std::vector<size_t>* _parents = nullptr) const {
+
+            size_t volume { 1U };
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                volume *= static_cast<size_t>(_region.hi[i] - _region.lo[i]);
+            }
+
+            _distance.assign(volume, s_unreachable);
+
+            if (_parents != nullptr) {
+                _parents->assign(volume, std::numeric_limits<size_t>::max());
+            }
+
+            std::vector<size_t> frontier;
+            frontier.reserve(volume);
+
+            const auto origin = local(_region, _from);
+
+            _distance[origin] = static_cast<scalar_t>(0);
+            frontier.emplace_back(origin);
+
+            for (size_t head = 0U; head < frontier.size(); ++head) {
+
+                const auto curr = frontier[head];
+
+                for (const auto& [nActive, nCoord] : m_grid.template get_neighbours<IncludeDiagonals>(global(_region, curr))) {
+
+                    if (nActive && inside(_region, nCoord)) {
+
+                        if (const auto n = local(_region, nCoord); _distance[n] == s_unreachable) {
+
+                            _distance[n] = static_cast<scalar_t>(_distance[curr] + static_cast<scalar_t>(1));
+
+                            if (_parents != nullptr) {
+                                (*_parents)[n] = curr;
+                            }
+
+                            frontier.emplace_back(n);
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Finds the entrances between a cluster and its neighbour along an axis, and places their transitions.
+         */
+        void build_face(size_t _cluster, size_t _axis) {
+
+            auto& transitions = m_faces[(_cluster * Kd) + _axis];
+            transitions.clear();
+
+            const auto c = utils::to_nd(static_cast<value_t>(_cluster), m_clusters);
+
+            if (static_cast<size_t>(c[_axis]) + 1U >= static_cast<size_t>(m_clusters[_axis])) {
+                return; // No neighbour along this axis.
+            }
+
+            // The border layer of this cluster, facing its neighbour:
+            auto face = bounds(_cluster);
+            face.lo[_axis] = static_cast<value_t>(face.hi[_axis] - 1U);
+
+            if constexpr (Kd == 1U) {
+
+                coord_t a = face.lo;
+                coord_t b = a;
+                ++b[_axis];
+
+                if (m_grid[a].is_active() && m_grid[b].is_active()) {
+                    transitions.emplace_back(index_of(a), index_of(b));
+                }
+            }
+            else {
+
+                // Entrances are scanned as runs along the lowest axis other than '_axis':
+                const size_t run_axis = _axis == 0U ? 1U : 0U;
+
+                const auto emit = [&](const coord_t& _first, size_t _length) ALWAYS_INLINE {
+
+                    const auto place = [&](size_t _offset) ALWAYS_INLINE {
+
+                        coord_t a = _first;
+                        a[run_axis] = static_cast<value_t>(a[run_axis] + _offset);
+
+                        coord_t b = a;
+                        ++b[_axis];
+
+                        transitions.emplace_back(index_of(a), index_of(b));
+                    };
+
+                    if (_length < s_entrance_split) {
+                        place(_length / 2U);
+                    }
+                    else {
+                        place(0U);
+                        place(_length - 1U);
+                    }
+                };
+
+                coord_t curr = face.lo;
+                coord_t first {};
+                size_t  length { 0U };
+
+                for (bool done = false; !done;) {
+
+                    coord_t next = curr;
+                    ++next[_axis];
+
+                    if (m_grid[curr].is_active() && m_grid[next].is_active()) {
+                        if (length++ == 0U) {
+                            first = curr;
+                        }
+                    }
+                    else if (length != 0U) {
+                        emit(first, length);
+                        length = 0U;
+                    }
+
+                    // Advance, ending the current run at the end of each row:
+                    done = true;
+
+                    for (size_t i = 0U; i < Kd; ++i) {
+
+                        if (++curr[i] < face.hi[i]) {
+                            done = false;
+                            break;
+                        }
+
+                        curr[i] = face.lo[i];
+
+                        if (i == run_axis && length != 0U) {
+                            emit(first, length);
+                            length = 0U;
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Collects the abstract nodes of a cluster from the transitions on each of its borders.
+         */
+        void build_nodes(size_t _cluster) {
+
+            auto& nodes = m_nodes[_cluster];
+            nodes.clear();
+
+            const auto c = utils::to_nd(static_cast<value_t>(_cluster), m_clusters);
+
+            for (size_t i = 0U; i < Kd; ++i) {
+
+                for (const auto& [a, b] : m_faces[(_cluster * Kd) + i]) {
+                    static_cast<void>(b);
+                    nodes.emplace_back(a);
+                }
+
+                if (c[i] > 0U) {
+
+                    auto neighbour = c;
+                    --neighbour[i];
+
+                    for (const auto& [a, b] : m_faces[(static_cast<size_t>(utils::to_1d(neighbour, m_clusters)) * Kd) + i]) {
+                        static_cast<void>(a);
+                        nodes.emplace_back(b);
+                    }
+                }
+            }
+
+            std::sort(nodes.begin(), nodes.end());
+            nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+        }
+
+        /**
+         * @brief Computes the intra-cluster edges of a cluster.
+         */
+        void build_edges(size_t _cluster, edge_list_t& _edges) const {
+
+            const auto& nodes = m_nodes[_cluster];
+            const auto  box   = bounds(_cluster);
+
+            std::vector<scalar_t> distance;
+
+            for (size_t i = 0U; i < nodes.size(); ++i) {
+
+                flood(box, coord_of(nodes[i]), distance);
+
+                for (size_t j = i + 1U; j < nodes.size(); ++j) {
+
+                    if (const auto d = distance[local(box, coord_of(nodes[j]))]; d != s_unreachable) {
+                        _edges.emplace_back(nodes[i], nodes[j], d);
+                    }
+                }
+            }
+        }
+
+        void link(const edge_list_t& _edges) {
+
+            for (const auto& [a, b, d] : _edges) {
+                m_graph.add(a, { b, d });
+                m_graph.add(b, { a, d });
+            }
+        }
+
+        void link_face(size_t _cluster, size_t _axis) {
+
+            for (const auto& [a, b] : m_faces[(_cluster * Kd) + _axis]) {
+                m_graph.add(a, { b, static_cast<scalar_t>(1) });
+                m_graph.add(b, { a, static_cast<scalar_t>(1) });
+            }
+        }
+
+        void unlink(index_t _node) {
+
+            if (m_graph.contains(_node)) {
+
+                const auto edges = m_graph.get_neighbours(_node); // Copy, as removal invalidates the original.
+
+                for (const auto& [n, d] : edges) {
+                    m_graph.remove(n,     { _node, d });
+                    m_graph.remove(_node, {     n, d });
+                }
+            }
+        }
+
+        void build() {
+
+            m_faces.assign(m_cluster_count * Kd, {});
+            m_nodes.assign(m_cluster_count, {});
+
+            m_graph.clear();
+
+            for (size_t c = 0U; c < m_cluster_count; ++c) {
+                for (size_t i = 0U; i < Kd; ++i) {
+                    build_face(c, i);
+                }
+            }
+
+            for (size_t c = 0U; c < m_cluster_count; ++c) {
+
+                build_nodes(c);
+
+                for (size_t i = 0U; i < Kd; ++i) {
+                    link_face(c, i);
+                }
+            }
+
+            // Compute intra-cluster distances in parallel:
+            std::vector<edge_list_t> edges(parallel::threads_for(m_cluster_count, 1U, parallel::max_threads()));
+
+            parallel::for_each(m_cluster_count, 1U, [this, &edges](size_t _begin, size_t _end, size_t _thread) {
+                for (auto c = _begin; c < _end; ++c) {
+                    build_edges(c, edges[_thread]);
+                }
+            });
+
+            for (const auto& list : edges) {
+                link(list);
+            }
+        }
+
+    public:
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Builds the hierarchy of a grid.
+         *
+         * @param [in]         _grid The grid to abstract. Must outlive the hierarchy.
+         * @param [in] _cluster_size Size of each cluster along each axis. Every element must be at least 1.
+         * @param [in, out] _resource Memory resource used by the abstract graph.
+         */
+        [[maybe_unused, nodiscard]] hierarchy(const grid_t& _grid, const coord_t& _cluster_size, std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            m_grid         (_grid),
+            m_cluster_size (_cluster_size),
+            m_clusters     (),
+            m_cluster_count(1U),
+            m_faces        (),
+            m_nodes        (),
+            m_graph        (_resource)
+        {
+            for (size_t i = 0U; i < Kd; ++i) {
+                assert(m_cluster_size[i] > 0U && "Cluster size must be non-zero.");
+
+                m_clusters[i]    = static_cast<value_t>((m_grid.size()[i] + m_cluster_size[i] - 1U) / m_cluster_size[i]);
+                m_cluster_count *= static_cast<size_t>(m_clusters[i]);
+            }
+
+            build();
+        }
+
+        ~hierarchy() = default;
+
+        hierarchy           (const hierarchy&) = delete;
+        hierarchy& operator=(const hierarchy&) = delete;
+        hierarchy           (hierarchy&&)      = delete;
+        hierarchy& operator=(hierarchy&&)      = delete;
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Updates the hierarchy after a cell of the grid has been edited.
+         *
+         * @details Only the cluster containing the cell, and the clusters sharing a border with it, are rebuilt.
+         *          Call once per edited cell, or once per cluster when editing many cells in the same cluster.
+         *
+         * @param [in] _cell The cell which was edited.
+         */
+        [[maybe_unused]] void update(const coord_t& _cell) {
+
+            const auto cluster = cluster_of(_cell);
+            const auto c       = utils::to_nd(static_cast<value_t>(cluster), m_clusters);
+
+            // Clusters whose abstract nodes may change:
+            std::vector<size_t> affected { cluster };
+
+            for (size_t i = 0U; i < Kd; ++i) {
+
+                if (c[i] > 0U) {
+                    auto n = c; --n[i];
+                    affected.emplace_back(static_cast<size_t>(utils::to_1d(n, m_clusters)));
+                }
+                if (static_cast<size_t>(c[i]) + 1U < static_cast<size_t>(m_clusters[i])) {
+                    auto n = c; ++n[i];
+                    affected.emplace_back(static_cast<size_t>(utils::to_1d(n, m_clusters)));
+                }
+            }
+
+            for (const auto& a : affected) {
+                for (const auto& n : m_nodes[a]) {
+                    unlink(n);
+                }
+            }
+
+            // Rebuild the borders of the edited cluster:
+            for (size_t i = 0U; i < Kd; ++i) {
+
+                build_face(cluster, i);
+
+                if (c[i] > 0U) {
+                    auto n = c; --n[i];
+                    build_face(static_cast<size_t>(utils::to_1d(n, m_clusters)), i);
+                }
+            }
+
+            for (const auto& a : affected) {
+                build_nodes(a);
+            }
+
+            // Restore inter-cluster edges on every border of the affected clusters:
+            std::vector<size_t> faces;
+
+            for (const auto& a : affected) {
+
+                const auto ac = utils::to_nd(static_cast<value_t>(a), m_clusters);
+
+                for (size_t i = 0U; i < Kd; ++i) {
+
+                    faces.emplace_back((a * Kd) + i);
+
+                    if (ac[i] > 0U) {
+                        auto n = ac; --n[i];
+                        faces.emplace_back((static_cast<size_t>(utils::to_1d(n, m_clusters)) * Kd) + i);
+                    }
+                }
+            }
+
+            std::sort(faces.begin(), faces.end());
+            faces.erase(std::unique(faces.begin(), faces.end()), faces.end());
+
+            for (const auto& f : faces) {
+                link_face(f / Kd, f % Kd);
+            }
+
+            // Restore intra-cluster edges:
+            edge_list_t edges;
+
+            for (const auto& a : affected) {
+                build_edges(a, edges);
+            }
+
+            link(edges);
+        }
+
+        /**
+         * @brief Index of the cluster containing a cell.
+         * @param [in] _cell The cell.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t cluster_of(const coord_t& _cell) const noexcept {
+
+            coord_t c {};
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                c[i] = static_cast<value_t>(_cell[i] / m_cluster_size[i]);
+            }
+
+            return static_cast<size_t>(utils::to_1d(c, m_clusters));
+        }
+
+        /**
+         * @brief Number of clusters.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t clusters() const noexcept { return m_cluster_count; }
+
+        /**
+         * @brief Abstract nodes within a cluster, as indices of the grid.
+         * @param [in] _cluster Index of the cluster.
+         */
+        [[maybe_unused, nodiscard]] constexpr const std::vector<index_t>& nodes(size_t _cluster) const noexcept { return m_nodes[_cluster]; }
+
+        /**
+         * @brief The abstract graph.
+         */
+        [[maybe_unused, nodiscard]] constexpr const graph_t& abstract_graph() const noexcept { return m_graph; }
+
+        /**
+         * @brief Searches the abstract graph for a route between two cells.
+         *
+         * @details The start and end are connected to the abstract nodes of their clusters, without modifying the
+         *          abstract graph, which is then searched using A*.
+         *
+         * @param [in] _start The cell to route from.
+         * @param [in]   _end The cell to route to.
+         *
+         * @return The abstract path, ordered from `_start` to `_end` (inclusive). Consecutive coordinates either lie
+         *         within the same cluster, or are adjacent. Empty if no route exists.
+         *
+         * @see refine()
+         */
+        [[maybe_unused, nodiscard]] std::vector<coord_t> find(const coord_t& _start, const coord_t& _end) const {
+
+            std::vector<coord_t> result;
+
+            if (const region all { coord_t{}, m_grid.size() };
+                !inside(all, _start) || !m_grid[_start].is_active() ||
+                !inside(all, _end  ) || !m_grid[_end  ].is_active()
+            ) {
+                return result;
+            }
+
+            const auto s = index_of(_start);
+            const auto e = index_of(_end);
+
+            if (s == e) {
+                result.emplace_back(_end);
+                return result;
+            }
+
+            // Connect the start and end to their clusters:
+            const auto s_cluster = cluster_of(_start);
+            const auto e_cluster = cluster_of(_end);
+            const auto s_region  = bounds(s_cluster);
+            const auto e_region  = bounds(e_cluster);
+
+            std::vector<scalar_t> s_distance;
+            std::vector<scalar_t> e_distance;
+
+            flood(s_region, _start, s_distance);
+            flood(e_region, _end,   e_distance);
+
+            const auto h = [this, &_end](index_t _index) ALWAYS_INLINE {
+
+                const auto coord = coord_of(_index);
+
+                scalar_t sum { 0 };
+                scalar_t max { 0 };
+
+                for (size_t i = 0U; i < Kd; ++i) {
+                    const auto d = static_cast<scalar_t>(coord[i] > _end[i] ? coord[i] - _end[i] : _end[i] - coord[i]);
+                    sum = static_cast<scalar_t>(sum + d);
+                    max = utils::max(max, d);
+                }
+
+                return IncludeDiagonals ? max : sum;
+            };
+
+            std::pmr::monotonic_buffer_resource resource;
+
+            std::pmr::unordered_map<index_t, std::pair<scalar_t, index_t>> records(&resource); // Index -> (g-score, parent).
+
+            heap<node> open(&resource);
+
+            const auto relax = [&](index_t _from, index_t _to, scalar_t _gScore) ALWAYS_INLINE {
+
+                if (const auto [it, inserted] = records.try_emplace(_to, _gScore, _from); inserted || _gScore < it->second.first) {
+                    it->second = { _gScore, _from };
+                    open.emplace(node { _to, _gScore, static_cast<scalar_t>(_gScore + h(_to)) });
+                }
+            };
+
+            records.try_emplace(s, static_cast<scalar_t>(0), s);
+            open.emplace(node { s, static_cast<scalar_t>(0), h(s) });
+
+            bool found = false;
+
+            while (!open.empty()) {
+
+                const auto curr = open.top();
+                open.pop();
+
+                if (curr.m_gScore != records.find(curr.m_index)->second.first) {
+                    continue; // Stale entry.
+                }
+
+                if (curr.m_index == e) {
+                    found = true;
+                    break;
+                }
+
+                if (curr.m_index == s) {
+
+                    for (const auto& n : m_nodes[s_cluster]) {
+                        if (const auto d = s_distance[local(s_region, coord_of(n))]; d != s_unreachable) {
+                            relax(s, n, d);
+                        }
+                    }
+
+                    if (s_cluster == e_cluster) {
+                        if (const auto d = s_distance[local(e_region, _end)]; d != s_unreachable) {
+                            relax(s, e, d);
+                        }
+                    }
+                }
+
+                if (m_graph.contains(curr.m_index)) {
+                    for (const auto& [n, d] : m_graph.get_neighbours(curr.m_index)) {
+                        relax(curr.m_index, n, static_cast<scalar_t>(curr.m_gScore + d));
+                    }
+                }
+
+                if (const auto c = coord_of(curr.m_index); inside(e_region, c)) {
+                    if (const auto d = e_distance[local(e_region, c)]; d != s_unreachable) {
+                        relax(curr.m_index, e, static_cast<scalar_t>(curr.m_gScore + d));
+                    }
+                }
+            }
+
+            if (found) {
+
+                for (auto i = e; i != s; i = records.find(i)->second.second) {
+                    result.emplace_back(coord_of(i));
+                }
+                result.emplace_back(_start);
+
+                std::reverse(result.begin(), result.end());
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Refines one segment of an abstract path into grid cells.
+         *
+         * @details Segments within a cluster are refined using a breadth-first search restricted to that cluster.
+         *          Segments between clusters are a single step.
+         *
+         * @param [in]   _from The first coordinate of the segment.
+         * @param [in]     _to The second coordinate of the segment.
+         * @param [out] _output Container to append the cells of the segment to, excluding `_from` and including `_to`.
+         *
+         * @return `true` if the segment could be refined, otherwise `false`.
+         *
+         * @see find()
+         */
+        template <typename path_t>
+        [[maybe_unused]] bool refine(const coord_t& _from, const coord_t& _to, path_t& _output) const {
+
+            if (_from == _to) {
+                return true;
+            }
+
+            if (const auto cluster = cluster_of(_from); cluster == cluster_of(_to)) {
+
+                const auto box = bounds(cluster);
+
+                std::vector<scalar_t> distance;
+                std::vector<size_t>   parents;
+
+                flood(box, _from, distance, &parents);
+
+                const auto target = local(box, _to);
+
+                if (distance[target] == s_unreachable) {
+                    return false;
+                }
+
+                const auto offset = _output.size();
+
+                for (auto i = target; distance[i] != static_cast<scalar_t>(0); i = parents[i]) {
+                    _output.push_back(global(box, i));
+                }
+
+                std::reverse(_output.begin() + static_cast<std::ptrdiff_t>(offset), _output.end());
+            }
+            else {
+                _output.push_back(_to);
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Finds and fully refines a path between two cells.
+         *
+         * @param [in] _start The cell to route from.
+         * @param [in]   _end The cell to route to.
+         *
+         * @return The path, ordered from `_start` to `_end` (inclusive). Empty if no route exists.
+         */
+        [[maybe_unused, nodiscard]] std::vector<coord_t> solve(const coord_t& _start, const coord_t& _end) const {
+
+            const auto route = find(_start, _end);
+
+            std::vector<coord_t> result;
+
+            if (!route.empty()) {
+
+                result.emplace_back(route.front());
+
+                for (size_t i = 1U; i < route.size(); ++i) {
+                    static_cast<void>(refine(route[i - 1U], route[i], result));
+                }
+            }
+
+            return result;
+        }
+    };
+
+} //chdr::mazes
+
+#endif //CHDR_HIERARCHY_HPP
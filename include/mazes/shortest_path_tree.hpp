@@ -0,0 +1,437 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_SHORTEST_PATH_TREE_HPP
+#define CHDR_SHORTEST_PATH_TREE_HPP
+
+/**
+ * @file shortest_path_tree.hpp
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+#include "../utils/parallel.hpp"
+#include "../utils/utils.hpp"
+#include "csr.hpp"
+#include "graph.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::mazes {
+
+    /**
+     * @nosubgrouping
+     * @class shortest_path_tree
+     * @brief Weighted distance from one or more sources to every vertex of a graph.
+     *
+     * @details Computes the full shortest-path tree of a weighted graph using parallel delta-stepping (Meyer and
+     *          Sanders, 2003), and records for each vertex its distance from the nearest source, and the vertex
+     *          preceding it on a shortest path.\n\n
+     *
+     *          Dijkstra's algorithm settles one vertex at a time, in order of distance, which leaves nothing to do in
+     *          parallel. Delta-stepping relaxes this ordering: tentative distances are kept in buckets of width
+     *          `delta`, and every vertex of the lowest non-empty bucket is expanded at once, in parallel. Edges no
+     *          heavier than `delta` (light edges) may add vertices back to the current bucket, so these are relaxed
+     *          repeatedly until the bucket stays empty. Heavier edges cannot, so are relaxed only once, after the
+     *          bucket is settled. Distances are lowered using compare-and-swap, and each thread collects the vertices
+     *          it lowers in a buffer of its own, before they are sorted into their buckets.\n\n
+     *
+     *          Small values of `delta` approach Dijkstra's algorithm (little parallelism, little wasted work), while
+     *          large values approach Bellman-Ford (much parallelism, many repeated relaxations). By default, `delta`
+     *          is the heaviest weight divided by the average degree, as suggested by the authors.\n\n
+     *
+     *          As the adjacency sets of `graph` are not well suited to parallel traversal, a `csr` copy of the graph
+     *          is taken on construction, with the light edges of each vertex placed before its heavy edges. The copy
+     *          is retained, so that `generate()` may be called again for other sources without rebuilding it.
+     *
+     * @code
+     *
+     * chdr::mazes::shortest_path_tree<index_t, scalar_t> tree(graph, source);
+     *
+     * for (const auto& target : targets) {
+     *     const auto cost = tree.distance(target);
+     * }
+     *
+     * @endcode
+     *
+     * References:
+     * - Meyer, U. and Sanders, P., 2003. Delta-Stepping: A Parallelizable Shortest Path Algorithm.
+     *   Journal of Algorithms, 49 (1), 114–152.
+     *
+     * @note Edges are treated as directed.
+     * @warning Weights must not be negative. Weights of zero may produce cycles in the tree, in which case `parent()`
+     *          and `path()` are unreliable, although distances are not affected.
+     *
+     * @tparam index_t  Type used for indexing vertices.
+     * @tparam scalar_t Type used to store weights and distances.
+     */
+    template <typename index_t, typename scalar_t>
+    class shortest_path_tree final {
+
+    public:
+
+        /** @brief Distance of vertices which cannot be reached from any source. */
+        static constexpr scalar_t unreachable = std::numeric_limits<scalar_t>::max();
+
+    private:
+
+        /** @brief Buckets (or vertices) smaller than this (per thread) are not worth processing in parallel. */
+        static constexpr size_t s_chunk_min = 4096U;
+
+        static constexpr auto s_null = csr<index_t, scalar_t>::null;
+
+        using request_t = std::pair<size_t, index_t>;
+
+        csr<index_t, scalar_t> m_graph;
+
+        /** @brief Offset past the last light edge of each vertex. */
+        std::pmr::vector<size_t> m_light_end;
+
+        scalar_t m_delta;
+
+        std::unique_ptr<std::atomic<scalar_t>[]> m_distances;
+        std::unique_ptr<std::atomic< index_t>[]> m_parents;
+
+        [[nodiscard]] HOT constexpr size_t bucket(scalar_t _distance) const noexcept {
+            return static_cast<size_t>(_distance / m_delta);
+        }
+
+        /**
+         * @brief Lowers the distance of a vertex, recording it in `_requests` if successful.
+         */
+        HOT void relax(index_t _v, scalar_t _distance, std::vector<request_t>& _requests) noexcept {
+
+            auto current = m_distances[_v].load(std::memory_order_relaxed);
+
+            while (_distance < current) {
+
+                if (m_distances[_v].compare_exchange_weak(current, _distance, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    _requests.emplace_back(bucket(_distance), _v);
+                    break;
+                }
+            }
+        }
+
+        /**
+         * @brief Relaxes either the light or the heavy edges of each vertex of `_vertices`, in parallel.
+         */
+        template <bool Light>
+        void relax_all(parallel::pool& _workers, const std::vector<index_t>& _vertices, std::vector<std::vector<request_t>>& _requests) {
+
+            _workers.for_each(_vertices.size(), s_chunk_min, [&](size_t _begin, size_t _end, size_t _thread) {
+
+                auto& requests = _requests[_thread];
+
+                for (auto i = _begin; i < _end; ++i) {
+
+                    const auto u = _vertices[i];
+                    const auto d = m_distances[u].load(std::memory_order_relaxed);
+
+                    const auto first = Light ? m_graph.begin(u) : m_light_end[u];
+                    const auto last  = Light ? m_light_end[u]   : m_graph.end(u);
+
+                    for (auto e = first; e < last; ++e) {
+                        relax(m_graph.target(e), d + m_graph.weight(e), requests);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Sorts the vertices whose distances were lowered into their buckets.
+         */
+        static void distribute(std::vector<std::vector<request_t>>& _requests, std::vector<std::vector<index_t>>& _buckets) {
+
+            for (auto& requests : _requests) {
+
+                for (const auto& [b, v] : requests) {
+
+                    if (b >= _buckets.size()) {
+                        _buckets.resize(b + 1U);
+                    }
+
+                    _buckets[b].emplace_back(v);
+                }
+
+                requests.clear();
+            }
+        }
+
+        /**
+         * @brief Chooses the width of the buckets, and places the light edges of each vertex before its heavy edges.
+         */
+        void partition(scalar_t _delta) {
+
+            const auto n = m_graph.count();
+
+            if (_delta <= static_cast<scalar_t>(0)) {
+
+                auto heaviest = static_cast<scalar_t>(0);
+
+                for (size_t e = 0U; e < m_graph.edges(); ++e) {
+                    heaviest = utils::max(heaviest, m_graph.weight(e));
+                }
+
+                const auto degree = utils::max(static_cast<scalar_t>(m_graph.edges() / utils::max(n, static_cast<size_t>(1U))), static_cast<scalar_t>(1));
+
+                _delta = heaviest / degree;
+
+                if (_delta <= static_cast<scalar_t>(0)) {
+                    _delta = static_cast<scalar_t>(1);
+                }
+            }
+
+            m_delta = _delta;
+
+            m_light_end.resize(n);
+
+            parallel::for_each(n, s_chunk_min, [this](size_t _begin, size_t _end, size_t /*_thread*/) {
+                for (auto v = _begin; v < _end; ++v) {
+                    m_light_end[v] = m_graph.partition(static_cast<index_t>(v), [this](const scalar_t& _weight) { return _weight <= m_delta; });
+                }
+            });
+        }
+
+    public:
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Generates the shortest-path tree of a graph from a single source.
+         *
+         * @param [in]      _graph The graph to generate the tree for.
+         * @param [in]     _source The source vertex.
+         * @param [in]      _delta Width of the buckets, or zero to choose one automatically. (optional)
+         * @param [in, out] _resource Memory resource used to store the copy of the graph.
+         */
+        [[maybe_unused, nodiscard]] shortest_path_tree(const graph<index_t, scalar_t>& _graph, index_t _source, scalar_t _delta = static_cast<scalar_t>(0), std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            shortest_path_tree(_graph, std::vector<index_t> { _source }, _delta, _resource) {}
+
+        /**
+         * @brief Generates the shortest-path tree of a graph from the nearest of several sources.
+         *
+         * @param [in]      _graph The graph to generate the tree for.
+         * @param [in]    _sources The source vertices.
+         * @param [in]      _delta Width of the buckets, or zero to choose one automatically. (optional)
+         * @param [in, out] _resource Memory resource used to store the copy of the graph.
+         */
+        [[maybe_unused, nodiscard]] shortest_path_tree(const graph<index_t, scalar_t>& _graph, const std::vector<index_t>& _sources, scalar_t _delta = static_cast<scalar_t>(0), std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            m_graph    (_graph, _resource),
+            m_light_end(_resource),
+            m_delta    (_delta),
+            m_distances(std::make_unique<std::atomic<scalar_t>[]>(m_graph.count())),
+            m_parents  (std::make_unique<std::atomic< index_t>[]>(m_graph.count()))
+        {
+            partition(_delta);
+            generate(_sources);
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Regenerates the tree from other sources, reusing the copy of the graph.
+         * @param [in] _sources The source vertices. Vertices which are not part of the graph are ignored.
+         */
+        void generate(const std::vector<index_t>& _sources) {
+
+            const auto n = m_graph.count();
+
+            // Workers persist across every phase of the search:
+            parallel::pool workers;
+
+            workers.for_each(n, s_chunk_min, [this](size_t _begin, size_t _end, size_t /*_thread*/) {
+                for (auto v = _begin; v < _end; ++v) {
+                    m_distances[v].store(unreachable, std::memory_order_relaxed);
+                    m_parents  [v].store(s_null,      std::memory_order_relaxed);
+                }
+            });
+
+            std::vector<std::vector<index_t>> buckets(1U);
+
+            for (const auto& source : _sources) {
+
+                if (const auto s = m_graph.dense(source); s != s_null) {
+                    m_distances[s].store(static_cast<scalar_t>(0), std::memory_order_relaxed);
+                    m_parents  [s].store(s,                        std::memory_order_relaxed);
+                    buckets[0U].emplace_back(s);
+                }
+            }
+
+            std::vector<std::vector<request_t>> requests(workers.size());
+
+            // Expansion (and bucket) a vertex was last expanded in, to skip duplicate entries:
+            std::vector<size_t> expanded(n, 0U);
+            std::vector<size_t>  settled(n, 0U);
+
+            std::vector<index_t> frontier;
+            std::vector<index_t>   bucket_vertices;
+            std::vector<index_t>   pending;
+
+            size_t expansion { 0U };
+
+            for (size_t i = 0U; i < buckets.size(); ++i) {
+
+                bucket_vertices.clear();
+
+                // Relax light edges until the bucket stays empty:
+                while (!buckets[i].empty()) {
+
+                    ++expansion;
+
+                    std::swap(pending, buckets[i]);
+                    buckets[i].clear();
+
+                    frontier.clear();
+
+                    for (const auto v : pending) {
+
+                        // Skip vertices which have since moved to a lower bucket, or appear more than once:
+                        if (bucket(m_distances[v].load(std::memory_order_relaxed)) == i && expanded[v] != expansion) {
+
+                            expanded[v] = expansion;
+                            frontier.emplace_back(v);
+
+                            if (settled[v] != i + 1U) {
+                                settled[v] = i + 1U;
+                                bucket_vertices.emplace_back(v);
+                            }
+                        }
+                    }
+
+                    pending.clear();
+
+                    relax_all<true>(workers, frontier, requests);
+                    distribute(requests, buckets);
+                }
+
+                // Then relax heavy edges of every vertex settled in the bucket, once:
+                relax_all<false>(workers, bucket_vertices, requests);
+                distribute(requests, buckets);
+
+                std::vector<index_t>().swap(buckets[i]);
+            }
+
+            // Choose a parent for every vertex, from any edge lying on a shortest path:
+            workers.for_each(n, s_chunk_min, [this](size_t _begin, size_t _end, size_t /*_thread*/) {
+
+                for (auto u = _begin; u < _end; ++u) {
+
+                    if (const auto d = m_distances[u].load(std::memory_order_relaxed); d != unreachable) {
+
+                        for (auto e = m_graph.begin(static_cast<index_t>(u)); e < m_graph.end(static_cast<index_t>(u)); ++e) {
+
+                            const auto v = m_graph.target(e);
+
+                            if (d + m_graph.weight(e) == m_distances[v].load(std::memory_order_relaxed)) {
+
+                                auto expected = s_null;
+                                m_parents[v].compare_exchange_strong(expected, static_cast<index_t>(u), std::memory_order_relaxed, std::memory_order_relaxed);
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Distance from the nearest source to a vertex, or `unreachable` if it cannot be reached.
+         * @param [in] _id The vertex.
+         */
+        [[maybe_unused, nodiscard]] HOT scalar_t distance(index_t _id) const noexcept {
+
+            const auto v = m_graph.dense(_id);
+            return v != s_null ? m_distances[v].load(std::memory_order_relaxed) : unreachable;
+        }
+
+        /**
+         * @brief Checks whether a vertex can be reached from any source.
+         * @param [in] _id The vertex.
+         */
+        [[maybe_unused, nodiscard]] HOT bool reachable(index_t _id) const noexcept {
+            return distance(_id) != unreachable;
+        }
+
+        /**
+         * @brief The vertex preceding another on a shortest path from the nearest source.
+         *
+         * @param [in] _id The vertex.
+         *
+         * @return The preceding vertex, or `_id` itself if it is a source.
+         *
+         * @pre The vertex must be reachable.
+         */
+        [[maybe_unused, nodiscard]] HOT index_t parent(index_t _id) const noexcept {
+
+            assert(reachable(_id) && "The vertex must be reachable.");
+
+            return m_graph.id(m_parents[m_graph.dense(_id)].load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief A shortest path from the nearest source to a vertex.
+         *
+         * @param [in] _id The vertex.
+         *
+         * @return The vertices of the path, from the source to `_id` (inclusive), or an empty path if the vertex
+         *         cannot be reached.
+         */
+        [[maybe_unused, nodiscard]] std::vector<index_t> path(index_t _id) const {
+
+            std::vector<index_t> result;
+
+            if (auto v = m_graph.dense(_id); v != s_null && m_distances[v].load(std::memory_order_relaxed) != unreachable) {
+
+                for (;;) {
+
+                    result.emplace_back(m_graph.id(v));
+
+                    const auto p = m_parents[v].load(std::memory_order_relaxed);
+
+                    if (p == v) {
+                        break;
+                    }
+
+                    v = p;
+                }
+
+                std::reverse(result.begin(), result.end());
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Width of the buckets.
+         */
+        [[maybe_unused, nodiscard]] constexpr scalar_t delta() const noexcept { return m_delta; }
+
+        /**
+         * @brief Number of vertices in the tree.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t size() const noexcept { return m_graph.count(); }
+    };
+
+} //chdr::mazes
+
+#endif //CHDR_SHORTEST_PATH_TREE_HPP
@@ -0,0 +1,217 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_STATISTICS_HPP
+#define CHDR_STATISTICS_HPP
+
+/**
+ * @file statistics.hpp
+ */
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "../utils/utils.hpp"
+#include "graph.hpp"
+#include "grid.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::mazes {
+
+    /**
+     * @nosubgrouping
+     * @class statistics
+     * @brief Summary of the structure of a grid or graph, used to select a solver for it.
+     *
+     * @details Gathered in a single pass over the maze, which visits each active node and its neighbours once. The
+     *          result describes the maze as a whole, and is intended to be computed once and reused for every query
+     *          made against the same maze, in the same way as `components`.\n\n
+     *
+     *          The degree of a node is its number of active neighbours, excluding diagonals. A node of degree two is a
+     *          corridor: a search entering it has only one way to continue, so a heuristic cannot guide it.
+     *
+     * @code
+     *
+     * const chdr::mazes::statistics stats(grid);
+     *
+     * chdr::solvers::options<scalar_t, coord_t> options;
+     * options.statistics = &stats;
+     *
+     * const auto result = chdr::solve("auto", grid, start, end, options);
+     *
+     * @endcode
+     *
+     * @note The statistics are not updated if the maze changes. Construct them again to reflect the change.
+     *
+     * @see solvers::selector
+     */
+    class statistics final {
+
+        size_t m_count;
+        size_t m_active;
+        size_t m_edges;
+        size_t m_rank;
+        bool   m_uniform;
+
+        /** @brief Number of active nodes with each degree, indexed by degree. */
+        std::vector<size_t> m_degrees;
+
+        void record(size_t _degree) {
+
+            if (_degree >= m_degrees.size()) {
+                m_degrees.resize(_degree + 1U, 0U);
+            }
+
+            ++m_degrees[_degree];
+            ++m_active;
+
+            m_edges += _degree;
+        }
+
+    public:
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Gathers the statistics of a grid.
+         *
+         * @details Grids are uniform, as every step between neighbouring cells has the same cost.
+         *
+         * @param [in] _grid The grid to summarise.
+         */
+        template <typename coord_t, typename weight_t>
+        [[maybe_unused, nodiscard]] explicit statistics(const grid<coord_t, weight_t>& _grid) :
+            m_count  (_grid.count()),
+            m_active (0U),
+            m_edges  (0U),
+            m_rank   (std::tuple_size_v<coord_t>),
+            m_uniform(true),
+            m_degrees(std::tuple_size_v<coord_t> * 2U + 1U, 0U)
+        {
+            using index_t = typename coord_t::value_type;
+
+            for (size_t i = 0U; i < m_count; ++i) {
+
+                if (_grid[i].is_active()) {
+
+                    size_t degree = 0U;
+
+                    for (const auto& [active, coord] : _grid.get_neighbours(static_cast<index_t>(i))) {
+                        degree += active ? 1U : 0U;
+                    }
+
+                    record(degree);
+                }
+            }
+        }
+
+        /**
+         * @brief Gathers the statistics of a graph.
+         *
+         * @details Graphs have no spatial rank, which is reported as zero. A graph is uniform if all of its edges have
+         *          the same cost.
+         *
+         * @param [in] _graph The graph to summarise.
+         */
+        template <typename index_t, typename scalar_t>
+        [[maybe_unused, nodiscard]] explicit statistics(const graph<index_t, scalar_t>& _graph) :
+            m_count  (_graph.count()),
+            m_active (0U),
+            m_edges  (0U),
+            m_rank   (0U),
+            m_uniform(true),
+            m_degrees()
+        {
+            bool     first = true;
+            scalar_t cost {};
+
+            for (const auto& [id, neighbours] : _graph) {
+
+                for (const auto& [n, distance] : neighbours) {
+
+                    if (first) {
+                        cost  = distance;
+                        first = false;
+                    }
+                    else if (!(distance == cost)) {
+                        m_uniform = false;
+                    }
+                }
+
+                record(neighbours.size());
+            }
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Retrieves the number of nodes in the maze, active or not.
+         * @return The number of nodes.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t count() const noexcept { return m_count; }
+
+        /**
+         * @brief Retrieves the number of active nodes in the maze.
+         * @return The number of active nodes.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t active() const noexcept { return m_active; }
+
+        /**
+         * @brief Retrieves the number of spatial dimensions of the maze.
+         * @return The rank of a grid, or zero for a graph.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t rank() const noexcept { return m_rank; }
+
+        /**
+         * @brief Whether every edge of the maze has the same cost.
+         * @return `true` if the maze is uniform, otherwise `false`.
+         */
+        [[maybe_unused, nodiscard]] constexpr bool uniform() const noexcept { return m_uniform; }
+
+        /**
+         * @brief Retrieves the proportion of nodes which are inactive.
+         * @return The obstacle density of the maze, between 0 and 1.
+         */
+        [[maybe_unused, nodiscard]] constexpr double density() const noexcept {
+            return m_count != 0U ? 1.0 - (static_cast<double>(m_active) / static_cast<double>(m_count)) : 0.0;
+        }
+
+        /**
+         * @brief Retrieves the proportion of active nodes which have exactly two active neighbours.
+         * @return The corridor ratio of the maze, between 0 and 1.
+         */
+        [[maybe_unused, nodiscard]] constexpr double corridor_ratio() const noexcept {
+            return m_active != 0U && m_degrees.size() > 2U ? static_cast<double>(m_degrees[2U]) / static_cast<double>(m_active) : 0.0;
+        }
+
+        /**
+         * @brief Retrieves the mean number of active neighbours of an active node.
+         * @return The mean degree of the maze.
+         */
+        [[maybe_unused, nodiscard]] constexpr double mean_degree() const noexcept {
+            return m_active != 0U ? static_cast<double>(m_edges) / static_cast<double>(m_active) : 0.0;
+        }
+
+        /**
+         * @brief Retrieves the distribution of the degrees of the active nodes.
+         * @return A vector holding the number of active nodes with each degree, indexed by degree.
+         */
+        [[maybe_unused, nodiscard]] constexpr const std::vector<size_t>& degrees() const noexcept { return m_degrees; }
+    };
+
+} //chdr::mazes
+
+#endif //CHDR_STATISTICS_HPP
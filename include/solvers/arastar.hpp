@@ -0,0 +1,309 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_ARASTAR_HPP
+#define CHDR_ARASTAR_HPP
+
+/**
+ * @file arastar.hpp
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../types/containers/heap.hpp"
+#include "../utils/utils.hpp"
+#include "base/solver.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::solvers {
+
+    /**
+     * @addtogroup Solvers
+     * @brief Graph traversal and pathfinding algorithms.
+     * @{
+     * @addtogroup Single-Target
+     * @brief Solvers which route to a single destination.
+     * @{
+     * @addtogroup SingleTargetCommon Common
+     * @brief General-purpose solvers.
+     * @{
+     */
+
+    /**
+     * @struct arastar
+     * @brief Anytime Repairing A* (ARA*) search algorithm.
+     * @details ARA* (Likhachev et al., 2003) is an anytime variant of weighted A*. A first, suboptimal solution is
+     *          found quickly using a heavily-inflated heuristic. The inflation is then decreased and the search is
+     *          repaired rather than restarted: nodes whose cost improved after they were expanded are carried into
+     *          the next iteration through an "inconsistent" (INCONS) list, so that each iteration only re-expands
+     *          the part of the search space affected by the change in inflation.\n\n
+     *
+     *          The initial inflation is taken from `params_t::weight`, and halves its excess over 1 each iteration
+     *          until the search is optimal with respect to the heuristic. The search is typically bounded using a
+     *          `budget`. When the budget runs out, the best path found so far is returned, and `solver::search()`
+     *          reports `search_status::exhausted`.
+     *
+     * Advantages:
+     * - Produces a usable path early, then improves it as time allows.
+     * - Reuses search effort between iterations, unlike repeated weighted A* searches.
+     * - Each published path is within a known factor (the current inflation) of optimal.
+     *
+     * Limitations:
+     * - Maintains per-node state for the whole search space, which is sized to the maze on demand.
+     * - Higher constant time factor than A* when the search is allowed to run to completion.
+     * - An inflation of 1 (the default `weight`) degenerates into a single A* search.
+     *
+     * Further Reading:
+     * - <a href="https://en.wikipedia.org/wiki/Anytime_A*">Wikipedia Article</a>
+     *
+     * References:
+     * - Likhachev, M., Gordon, G. and Thrun, S., 2003. ARA*: Anytime A* with Provable Bounds on Sub-Optimality.
+     *   Advances in Neural Information Processing Systems, 16, 767–774.
+     *
+     * @note The path is optimal if the search is not interrupted and the heuristic is admissible.
+     * @tparam params_t Type containing the search parameters.
+     */
+    template<typename params_t>
+    struct [[maybe_unused]] arastar final {
+
+        friend class solver<arastar, params_t>;
+
+    private:
+
+        using  index_t = typename params_t:: index_type;
+        using scalar_t = typename params_t::scalar_type;
+        using  coord_t = typename params_t:: coord_type;
+        using solver_t = solver<arastar, params_t>;
+
+        /** @brief Inflation below which the search is considered optimal. */
+        static constexpr double s_epsilon_tolerance = 1.0 / 16.0;
+
+        struct node final {
+
+            index_t  m_index;
+            scalar_t m_gScore;
+            scalar_t m_fScore;
+
+            [[nodiscard]] HOT friend constexpr bool operator < (const node& _a, const node& _b) noexcept {
+                return _a.m_fScore == _b.m_fScore ?
+                       _a.m_gScore >  _b.m_gScore :
+                       _a.m_fScore >  _b.m_fScore;
+            }
+        };
+
+        struct state final {
+
+            scalar_t m_gScore = std::numeric_limits<scalar_t>::max();
+             index_t m_parent = std::numeric_limits< index_t>::max();
+
+            /*
+             * Iteration stamps. Comparing against the current iteration avoids
+             * having to clear the table between iterations.
+             */
+            uint32_t m_closed = 0U;
+            uint32_t m_incons = 0U;
+            uint32_t m_queued = 0U;
+        };
+
+        using state_table_t = std::pmr::vector<state>;
+
+        HOT static constexpr void ensure(state_table_t& _states, index_t _index, size_t _total) {
+
+            if (UNLIKELY(static_cast<size_t>(_index) >= _states.size())) {
+                _states.resize(utils::min(utils::max(static_cast<size_t>(_index) + 1U, _states.size() * 2U), _total));
+            }
+        }
+
+        [[nodiscard]] HOT static constexpr scalar_t f(scalar_t _gScore, const coord_t& _coord, double _epsilon, const params_t& _params) noexcept {
+            return _gScore + static_cast<scalar_t>(static_cast<double>(_params.h(_coord, _params.end)) * _epsilon);
+        }
+
+        template <typename open_set_t>
+        HOT static constexpr void push(open_set_t& _open, node&& _node) {
+
+            if constexpr (params_t::lazy_sorting::value) {
+                _open.emplace_nosort(std::move(_node));
+            }
+            else {
+                _open.emplace(std::move(_node));
+            }
+        }
+
+        [[nodiscard]] static auto backtrack(const state_table_t& _states, index_t _s, index_t _e, const params_t& _params) {
+
+            std::vector<coord_t> result{};
+
+            for (auto i = _e; i != _s; i = _states[i].m_parent) {
+                result.emplace_back(utils::to_nd(i, _params.size));
+            }
+
+            if constexpr (params_t::reverse_equivalence::value) {
+                std::reverse(result.begin(), result.end());
+            }
+
+            return result;
+        }
+
+        template <typename open_set_t>
+        [[nodiscard]] HOT static auto solve_internal(open_set_t& _open, state_table_t& _states, size_t _total, const params_t& _params, monitor<params_t>& _monitor) {
+
+            const auto s = static_cast<index_t>(utils::to_1d(_params.start, _params.size));
+            const auto e = static_cast<index_t>(utils::to_1d(_params.end,   _params.size));
+
+            auto epsilon = utils::max(static_cast<double>(_params.weight), 1.0);
+
+            ensure(_states, utils::max(s, e), _total);
+            _states[s].m_gScore = static_cast<scalar_t>(0);
+            _states[s].m_parent = s;
+
+            push(_open, { s, static_cast<scalar_t>(0), f(static_cast<scalar_t>(0), _params.start, epsilon, _params) });
+
+            std::pmr::vector<index_t> incons(_params.heterogeneous_pmr);
+            std::pmr::vector<index_t> queued(_params.heterogeneous_pmr);
+
+            std::vector<coord_t> result{};
+
+            bool exhausted = false;
+
+            for (uint32_t iteration = 1U; !exhausted; ++iteration) {
+
+                // Improve path:
+                while (LIKELY(!_open.empty())) {
+
+                    const auto& top = _open.top();
+                    const auto& top_state = _states[top.m_index];
+
+                    // Discard stale entries:
+                    if (top.m_gScore != top_state.m_gScore || top_state.m_closed == iteration) {
+                        _open.pop();
+                        continue;
+                    }
+
+                    if (_states[e].m_gScore <= top.m_fScore) {
+                        break;
+                    }
+
+                    if (_monitor.poll()) {
+                        exhausted = true;
+                        break;
+                    }
+
+                    const auto curr(top);
+                    _open.pop();
+
+                    _states[curr.m_index].m_closed = iteration;
+
+                    for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
+
+                        if (const auto& n = solver_t::get_data(n_data, _params); n.active) {
+
+                            ensure(_states, n.index, _total);
+
+                            auto& n_state = _states[n.index];
+
+                            if (const auto g = static_cast<scalar_t>(curr.m_gScore + n.distance); g < n_state.m_gScore) {
+
+                                n_state.m_gScore = g;
+                                n_state.m_parent = curr.m_index;
+
+                                if (n_state.m_closed != iteration) {
+                                    push(_open, { n.index, g, f(g, n.coord, epsilon, _params) });
+                                    _monitor.generate(_open.size());
+                                }
+                                else if (n_state.m_incons != iteration) {
+                                    n_state.m_incons = iteration;
+                                    incons.emplace_back(n.index);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // Publish the improved solution (if any):
+                if (_states[e].m_gScore != std::numeric_limits<scalar_t>::max()) {
+                    result = backtrack(_states, s, e, _params);
+                    _monitor.reach(_states[e].m_gScore);
+                }
+
+                if (exhausted || epsilon <= 1.0 || (_open.empty() && incons.empty())) {
+                    break;
+                }
+
+                // Decrease inflation:
+                epsilon = epsilon - 1.0 > s_epsilon_tolerance ? 1.0 + ((epsilon - 1.0) * 0.5) : 1.0;
+
+                // Move INCONS into OPEN and update all priorities under the new inflation:
+                queued.clear();
+
+                for (const auto& i : incons) {
+                    _states[i].m_queued = iteration;
+                    queued.emplace_back(i);
+                }
+
+                for (const auto& item : _open) {
+
+                    if (auto& item_state = _states[item.m_index];
+                        item.m_gScore == item_state.m_gScore &&
+                        item_state.m_closed != iteration &&
+                        item_state.m_queued != iteration
+                    ) {
+                        item_state.m_queued = iteration;
+                        queued.emplace_back(item.m_index);
+                    }
+                }
+
+                _open.clear();
+                incons.clear();
+
+                for (const auto& i : queued) {
+                    const auto g = _states[i].m_gScore;
+                    push(_open, { i, g, f(g, utils::to_nd(i, _params.size), epsilon, _params) });
+                }
+            }
+
+            return result;
+        }
+
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
+
+            const auto capacity = solver_t::solver_utils::determine_capacity(_params);
+            const auto total    = utils::product<size_t>(_params.size);
+
+            state_table_t states(_params.heterogeneous_pmr);
+            try {
+                states.reserve(utils::min(capacity, total));
+            }
+            catch (...) {} // NOLINT(*-empty-catch)
+
+            heap<node> open(_params.heterogeneous_pmr);
+            try {
+                open.reserve(capacity / 8U);
+            }
+            catch (...) {} // NOLINT(*-empty-catch)
+
+            return solve_internal(open, states, total, _params, _monitor);
+        }
+    };
+
+    /**
+     * @}
+     * @}
+     * @}
+     */
+
+} //chdr::solvers
+
+#endif //CHDR_ARASTAR_HPP
@@ -0,0 +1,363 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_BUDGET_HPP
+#define CHDR_BUDGET_HPP
+
+/**
+ * @file budget.hpp
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "../../utils/utils.hpp"
+#include "stats.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::solvers {
+
+    /**
+     * @enum search_status
+     * @brief Outcome of a search.
+     */
+    enum class search_status : uint8_t {
+
+        /** @brief The search has not yet completed, and may be resumed. */
+        in_progress,
+
+        /** @brief A path to the destination was found. */
+        found,
+
+        /** @brief The search space was exhausted without finding a path to the destination. */
+        failed,
+
+        /** @brief The search was interrupted by its budget before it could complete. */
+        exhausted
+    };
+
+    /**
+     * @struct budget
+     * @brief Limits on the resources a single search may consume.
+     *
+     * @details A budget is supplied to a solver through an optional `budget` member of `params_t`. Solvers report each
+     *          node expansion to a `monitor`, which interrupts the search once any limit is reached. Members left at
+     *          their default values impose no limit.
+     *
+     * @code
+     *
+     * std::atomic<bool> cancel { false };
+     *
+     * struct params {
+     *     ...
+     *     chdr::solvers::budget budget;
+     * };
+     *
+     * const params args { ..., { 100000U, std::chrono::steady_clock::now() + std::chrono::milliseconds(4), 64U * 1024U * 1024U, &cancel } };
+     *
+     * const auto result = chdr::solvers::solver<chdr::solvers::astar, params>::search(args);
+     *
+     * if (result.status == chdr::solvers::search_status::exhausted) {
+     *     ...
+     * }
+     *
+     * @endcode
+     *
+     * @see monitor
+     */
+    struct budget final {
+
+        /** @brief Maximum number of node expansions. */
+        size_t expansions = std::numeric_limits<size_t>::max();
+
+        /** @brief Point in time after which the search is interrupted. */
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+        /** @brief Maximum number of bytes held by the memory resources of `params_t`, combined. */
+        size_t bytes = std::numeric_limits<size_t>::max();
+
+        /** @brief An external flag which, when set, interrupts the search. (optional) */
+        const std::atomic<bool>* cancel = nullptr;
+    };
+
+    /**
+     * @class budget_exhausted
+     * @brief Thrown by `monitor::expand()` to unwind a search which has exceeded its budget.
+     *
+     * @details This exception is caught by the `solver` front door and converted into `search_status::exhausted`.
+     *          It does not escape a call to `solver::solve()` or `solver::search()`.
+     */
+    class budget_exhausted final : public std::exception {
+
+    public:
+
+        [[nodiscard]] const char* what() const noexcept override { return "Search budget exhausted."; }
+    };
+
+    /**
+     * @class monitor
+     * @brief Enforces the `budget` of a single search.
+     *
+     * @details A monitor is created by the `solver` front door for each query, and is passed to the solver, which calls
+     *          `expand()` once per node expansion. The expansion count is compared on every call, while the more costly
+     *          checks (wall clock, cancellation flag and pool footprints) are made on the first expansion, and every
+     *          `s_interval` expansions thereafter.\n\n
+     *          If `params_t` has no `budget` member, budget checks are no-ops and compile out entirely. Likewise,
+     *          the `search_stats` counters are only maintained when `CHDR_DIAGNOSTICS` is enabled.
+     *
+     * @tparam params_t Type containing the search parameters.
+     *
+     * @see budget
+     */
+    template <typename params_t>
+    class monitor final {
+
+        template <typename T, typename = void>
+        struct has_budget : std::false_type {};
+
+        template <typename T>
+        struct has_budget<T, std::void_t<decltype(std::declval<T>().budget)>> : std::true_type {};
+
+        template <typename T, typename = void>
+        struct has_method_footprint : std::false_type {};
+
+        template <typename T>
+        struct has_method_footprint<T, std::void_t<decltype(std::declval<const T&>().footprint())>> : std::true_type {};
+
+#if CHDR_DIAGNOSTICS == 1
+
+        template <typename T, typename = void>
+        struct has_diagnostic_data : std::false_type {};
+
+        template <typename T>
+        struct has_diagnostic_data<T, std::void_t<decltype(std::declval<T&>().__get_diagnostic_data().peak_allocated)>> : std::true_type {};
+
+#endif //CHDR_DIAGNOSTICS == 1
+
+        /** @brief Interval (in expansions) between checks of the deadline, cancellation flag and byte budget. */
+        static constexpr size_t s_interval = 256U;
+
+        [[maybe_unused]] const params_t& m_params;
+
+        size_t m_expanded;
+        size_t m_checkpoint;
+        bool   m_exhausted;
+
+        std::optional<typename params_t::scalar_type> m_cost;
+
+#if CHDR_DIAGNOSTICS == 1
+        search_stats m_stats;
+#endif //CHDR_DIAGNOSTICS == 1
+
+        template <typename resource_t>
+        [[nodiscard]] static constexpr size_t footprint_of([[maybe_unused]] const resource_t* _resource) noexcept {
+
+            if constexpr (has_method_footprint<resource_t>::value) {
+                return _resource != nullptr ? _resource->footprint() : 0U;
+            }
+            else {
+                return 0U;
+            }
+        }
+
+#if CHDR_DIAGNOSTICS == 1
+
+        template <typename resource_t>
+        [[nodiscard]] static constexpr size_t peak_of([[maybe_unused]] resource_t* _resource) noexcept {
+
+            if constexpr (has_diagnostic_data<resource_t>::value) {
+                return _resource != nullptr ? _resource->__get_diagnostic_data().peak_allocated : 0U;
+            }
+            else {
+                return 0U;
+            }
+        }
+
+#endif //CHDR_DIAGNOSTICS == 1
+
+        [[nodiscard]] bool check() noexcept {
+
+            const auto& limits = m_params.budget;
+
+            m_checkpoint = utils::min(m_expanded + s_interval, limits.expansions);
+
+            m_exhausted = m_expanded >= limits.expansions ||
+                (limits.cancel != nullptr && limits.cancel->load(std::memory_order_relaxed)) ||
+                (limits.deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= limits.deadline) ||
+                (limits.bytes != std::numeric_limits<size_t>::max() && footprint() > limits.bytes);
+
+            return m_exhausted;
+        }
+
+    public:
+
+        /**
+         * @brief Whether the searches monitored by this type are subject to a budget.
+         */
+        static constexpr bool enabled = has_budget<params_t>::value;
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Constructs a monitor for a single search.
+         * @param [in] _params The parameters of the search. Must outlive the monitor.
+         */
+        [[nodiscard]] explicit constexpr monitor(const params_t& _params) noexcept :
+            m_params    (_params),
+            m_expanded  (0U),
+            m_checkpoint(0U),
+            m_exhausted (false),
+            m_cost      ()
+#if CHDR_DIAGNOSTICS == 1
+          , m_stats     ()
+#endif //CHDR_DIAGNOSTICS == 1
+        {
+            if constexpr (enabled) {
+                m_checkpoint = utils::min(static_cast<size_t>(1U), m_params.budget.expansions); // Poll on the first expansion.
+            }
+        }
+
+        ~monitor() = default;
+
+        monitor           (const monitor&) = delete;
+        monitor& operator=(const monitor&) = delete;
+        monitor           (monitor&&)      = delete;
+        monitor& operator=(monitor&&)      = delete;
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Records a node expansion, and polls the budget if a checkpoint has been reached.
+         *
+         * @return `true` if the budget has been exhausted, `false` otherwise.
+         *
+         * @see expand()
+         */
+        [[nodiscard]] HOT bool poll() noexcept {
+
+#if CHDR_DIAGNOSTICS == 1
+            ++m_stats.expanded;
+#endif //CHDR_DIAGNOSTICS == 1
+
+            if constexpr (enabled) {
+                if (UNLIKELY(++m_expanded >= m_checkpoint)) {
+                    return check();
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Records a node expansion, and interrupts the search if its budget has been exhausted.
+         *
+         * @throws budget_exhausted if the budget has been exhausted.
+         *
+         * @see poll()
+         */
+        HOT void expand() {
+
+            if (UNLIKELY(poll())) {
+                throw budget_exhausted();
+            }
+        }
+
+        /**
+         * @brief Records a node being pushed to the open set.
+         * @param _open_size Size of the open set after the push.
+         */
+        HOT constexpr void generate([[maybe_unused]] size_t _open_size) noexcept {
+
+#if CHDR_DIAGNOSTICS == 1
+            ++m_stats.generated;
+            m_stats.peak_open = utils::max(m_stats.peak_open, _open_size);
+#endif //CHDR_DIAGNOSTICS == 1
+        }
+
+        /**
+         * @brief Records a node being added to the closed set.
+         */
+        HOT constexpr void close() noexcept {
+
+#if CHDR_DIAGNOSTICS == 1
+            ++m_stats.closed;
+#endif //CHDR_DIAGNOSTICS == 1
+        }
+
+        /**
+         * @brief Records the cost of the path to the goal, as held by the solver when reaching it.
+         *
+         * @details Called by solvers which track the cost of each node (such as the g-score of `astar`). A later call
+         *          replaces the cost of an earlier one, so anytime solvers may report each improvement.
+         *
+         * @param _cost Total cost of the path from the start to the goal.
+         */
+        HOT constexpr void reach(typename params_t::scalar_type _cost) noexcept { m_cost = _cost; }
+
+        /**
+         * @brief Whether the budget was exhausted during the search.
+         */
+        [[nodiscard]] constexpr bool exhausted() const noexcept { return m_exhausted; }
+
+        /**
+         * @brief Cost of the path to the goal, if reported by the solver.
+         * @see reach()
+         */
+        [[nodiscard]] constexpr const std::optional<typename params_t::scalar_type>& cost() const noexcept { return m_cost; }
+
+        /**
+         * @brief Combined footprint of the memory resources of `params_t`, in bytes.
+         *
+         * @details Only resources which expose a `footprint()` method, such as the pools provided by this library,
+         *          contribute to the total.
+         */
+        [[nodiscard]] constexpr size_t footprint() const noexcept {
+            return footprint_of(m_params.    monotonic_pmr) +
+                   footprint_of(m_params.heterogeneous_pmr) +
+                   footprint_of(m_params.  homogeneous_pmr);
+        }
+
+#if CHDR_DIAGNOSTICS == 1
+
+        /**
+         * @brief Statistics gathered for the search so far.
+         *
+         * @details Per-pool figures are read from the memory resources at the time of the call, so this should
+         *          be called before the resources are reset.
+         */
+        [[nodiscard]] search_stats stats() const noexcept {
+
+            auto result = m_stats;
+
+            result.    monotonic_peak_bytes = peak_of(m_params.    monotonic_pmr);
+            result.heterogeneous_peak_bytes = peak_of(m_params.heterogeneous_pmr);
+            result.  homogeneous_peak_bytes = peak_of(m_params.  homogeneous_pmr);
+
+            return result;
+        }
+
+#endif //CHDR_DIAGNOSTICS == 1
+    };
+
+} //chdr::solvers
+
+#endif //CHDR_BUDGET_HPP
@@ -13,12 +13,21 @@
  * @file solver.hpp
  */
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <limits>
+#include <optional>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "../../utils/heuristics.hpp"
+#include "../../utils/parallel.hpp"
+#include "../../utils/smoothing.hpp"
 #include "../../utils/utils.hpp"
+#include "budget.hpp"
+#include "stats.hpp"
 
 // ReSharper disable once CppUnusedIncludeDirective
 #include <iostream>
@@ -27,6 +36,38 @@
 
 namespace chdr::solvers {
 
+    /**
+     * @struct search_result
+     * @brief The outcome of a call to `solver::search()`.
+     *
+     * @tparam params_t Type containing the search parameters.
+     */
+    template <typename params_t>
+    struct search_result final {
+
+        /** @brief Status of the search. */
+        search_status status;
+
+        /** @brief The resulting path. Empty if no path was found. */
+        std::vector<typename params_t::coord_type> path;
+
+        /**
+         * @brief Total cost of the path, from `params_t::start` to `params_t::end`.
+         *
+         * @details Taken from the cost which the solver holds for the goal when reaching it (such as the g-score of
+         *          `astar`), so that no additional pass over the path is made. Empty if no path was found, or if the
+         *          solver does not track the cost of its nodes (such as `bfs`, `dfs` and `flood`).
+         */
+        std::optional<typename params_t::scalar_type> cost;
+
+#if CHDR_DIAGNOSTICS == 1
+
+        /** @brief Statistics describing the work performed by the search. */
+        search_stats stats;
+
+#endif //CHDR_DIAGNOSTICS == 1
+    };
+
     /**
      * @nosubgrouping
      * @class solver
@@ -68,7 +109,10 @@ namespace chdr::solvers {
      *
      *     const scalar_type weight       = ...; // 1
      *     const      size_t capacity     = ...; // 0
-     *     const      size_t memoryLimit  = ...; // MAX
+     *     const      size_t memory_limit = ...; // MAX. Bytes which memory-bounded solvers may allocate. See `accounting_resource`.
+     *     chdr::solvers::budget budget;            // (optional) See `budget`.
+     *     const chdr::mazes::components<...>* components; // (optional) See `mazes::components`.
+     *     const      size_t threads      = ...; // (optional) Threads used by parallel solvers. 0 uses every core.
      * };
      *
      * // Invoke with chosen algorithm and parameters. Here, A* is used:
@@ -342,6 +386,100 @@ namespace chdr::solvers {
             template <typename T>
             static constexpr bool has_subscript_operator_v = has_subscript_operator<T>::value;
 
+            /**
+             * @struct has_context
+             * @brief A utility trait for determining whether a solver provides a resumable `context`.
+             *
+             * @tparam T The solver type to be inspected.
+             */
+            template <typename T, typename = void>
+            struct has_context : std::false_type {};
+
+            template <typename T>
+            struct has_context<T, std::void_t<typename T::context>> : std::true_type {};
+
+            /**
+             * @brief Determines whether the specified solver provides a resumable `context`.
+             *
+             * @tparam T The solver type being evaluated.
+             *
+             * @return true, if the given solver has a nested `context` class. Otherwise, false.
+             */
+            template <typename T>
+            static constexpr bool has_context_v = has_context<T>::value;
+
+            /**
+             * @struct has_components
+             * @brief A utility trait for determining whether a parameters type provides a `components` index.
+             *
+             * @tparam T The parameters type to be inspected.
+             */
+            template <typename T, typename = void>
+            struct has_components : std::false_type {};
+
+            template <typename T>
+            struct has_components<T, std::void_t<decltype(std::declval<T>().components->connected(
+                std::declval<typename T::index_type>(),
+                std::declval<typename T::index_type>()
+            ))>> : std::true_type {};
+
+            /**
+             * @brief Checks whether a path may exist between two nodes, by consulting the optional `components` index.
+             *
+             * @param [in] _params The parameters of the search.
+             * @param [in]      _s Index of the start node.
+             * @param [in]      _e Index of the end node.
+             *
+             * @return `false` if the nodes are known to be disconnected. Otherwise, `true`.
+             */
+            [[nodiscard]] HOT static bool reachable([[maybe_unused]] const params_t& _params, [[maybe_unused]] typename params_t::index_type _s, [[maybe_unused]] typename params_t::index_type _e) noexcept {
+
+                if constexpr (has_components<params_t>::value) {
+
+                    if constexpr (!is_graph_v<decltype(_params.maze)>) {
+                        static_assert(std::decay_t<decltype(*_params.components)>::includes_diagonals || !params_t::octile_neighbours::value,
+                            "A components index which excludes diagonals cannot be used with octile_neighbours.");
+                    }
+
+                    return _params.components == nullptr || _params.components->connected(_s, _e);
+                }
+                else {
+                    return true;
+                }
+            }
+
+            /**
+             * @struct has_threads
+             * @brief A utility trait for determining whether a parameters type specifies a number of `threads`.
+             *
+             * @tparam T The parameters type to be inspected.
+             */
+            template <typename T, typename = void>
+            struct has_threads : std::false_type {};
+
+            template <typename T>
+            struct has_threads<T, std::void_t<decltype(static_cast<size_t>(std::declval<T>().threads))>> : std::true_type {};
+
+            /**
+             * @brief Determines the number of threads a parallel solver should use.
+             *
+             * @param [in] _params The parameters of the search.
+             *
+             * @return The optional `threads` member of the parameters if it is present and non-zero. Otherwise, the
+             *         number of hardware threads (at least one).
+             */
+            [[nodiscard]] static size_t determine_threads([[maybe_unused]] const params_t& _params) noexcept {
+
+                if constexpr (has_threads<params_t>::value) {
+
+                    if (_params.threads != 0U) {
+                        return static_cast<size_t>(_params.threads);
+                    }
+                }
+
+                return parallel::max_threads();
+            }
+
             /**
              * @brief Estimates the preallocation quota for a given solve.
              *
@@ -529,100 +667,80 @@ namespace chdr::solvers {
             }
 
             /**
-             * @brief Constructs a reverse path from a given node to its root in a tree or graph structure.
+             * @brief Writes the path from a given node to its root into an output range, in the order of traversal.
              *
-             * @details This function iteratively backtracks from the specified node `_node` to its root
-             *          through its parent pointers, converting each node's index into a coordinate
-             *          using the dimensions provided in `_size`. The resulting path is stored in reverse order,
-             *          where the first element corresponds to the root node and the last element corresponds
-             *          to the provided `_node`. The depth of the path is dynamically determined during the
-             *          traversal process.
+             * @details This function walks the parent pointers of `_node` exactly once, passing the index of each
+             *          node to `_transform` and writing the result to `_out`. The root node is not included.
+             *          No memory is allocated.
              *
-             * @param [in] _node The node to begin backtracking from. This is assumed to be part of a structure
-             *                   where nodes possess a parent pointer (`m_parent`) for traversal.
-             * @param [in] _size The coordinate dimensions, used to convert an index to n-dimensional coordinates.
+             * @param [in]  _node The node to begin backtracking from. This is assumed to be part of a structure
+             *                    where nodes possess a parent pointer (`m_parent`) for traversal.
+             * @param [out]  _out The beginning of the destination range.
+             * @param [in] _transform Callable converting a node index into the value to be written. (i.e. a coordinate)
              *
-             * @return A vector of n-dimensional coordinates representing the path from the root node
-             *         to the provided `_node`.
+             * @return Output iterator to the element past the last element written.
+             *
+             * @warning The destination range must be large enough to hold the path.
              */
-            template<typename node_t, typename coord_t>
-            static constexpr auto rbacktrack(const node_t& _node, const coord_t& _size) {
+            template <typename node_t, typename OutputIt, typename transform_t>
+            HOT static constexpr OutputIt rbacktrack_noreverse_into(const node_t& _node, OutputIt _out, transform_t&& _transform) {
 
-                std::vector<coord_t> result{};
-
-                {
-                    size_t depth = 0U;
-                    for (const auto* RESTRICT t = &_node; t->m_parent != nullptr; t = static_cast<const node_t*>(t->m_parent)) {
-                        ++depth;
-                    }
-
-                    result.resize(depth);
-                }
-
-                size_t i = 0U;
                 for (const auto* RESTRICT t = &_node; t->m_parent != nullptr; t = static_cast<const node_t*>(t->m_parent)) {
-                    result[(result.size() - 1U) - i] = utils::to_nd(static_cast<typename coord_t::value_type>(t->m_index), _size);
-                    ++i;
+                    *_out = _transform(t->m_index);
+                    ++_out;
                 }
 
-                return result;
+                return _out;
             }
 
             /**
-             * @brief Constructs a path from a given node to its root in a tree or graph structure.
+             * @brief Writes the path from a given node to its root into an output range, in reverse order.
              *
-             * @details This function iteratively backtracks from the specified node `_node` to its root
-             *          through its parent pointers, converting each node's index into a coordinate
-             *          using the dimensions provided in `_size`.
-             *          The depth of the path is dynamically determined during the traversal process.
+             * @details This function walks the parent pointers of `_node` exactly once, writing the path to `_out`,
+             *          and then reverses the written range in place. The first element of the range therefore
+             *          corresponds to the node nearest the root, and the last element to `_node`. The root node is not
+             *          included. No memory is allocated.
              *
-             * @param [in] _node The node to begin backtracking from. This is assumed to be part of a structure
-             *                   where nodes possess a parent pointer (`m_parent`) for traversal.
-             * @param [in] _size The coordinate dimensions, used to convert an index to n-dimensional coordinates.
+             * @param [in]  _node The node to begin backtracking from. This is assumed to be part of a structure
+             *                    where nodes possess a parent pointer (`m_parent`) for traversal.
+             * @param [out]  _out The beginning of the destination range. Must be a bidirectional iterator.
+             * @param [in] _transform Callable converting a node index into the value to be written. (i.e. a coordinate)
              *
-             * @return A vector of n-dimensional coordinates representing the path from the root node
-             *         to the provided `_node`.
+             * @return Iterator to the element past the last element written.
+             *
+             * @warning The destination range must be large enough to hold the path.
              */
-            template<typename node_t, typename coord_t>
-            static constexpr auto rbacktrack_noreverse(const node_t& _node, const coord_t& _size) {
+            template <typename node_t, typename BidirIt, typename transform_t>
+            HOT static constexpr BidirIt rbacktrack_into(const node_t& _node, BidirIt _out, transform_t&& _transform) {
 
-                std::vector<coord_t> result{};
+                const auto last = rbacktrack_noreverse_into(_node, _out, std::forward<transform_t>(_transform));
+                std::reverse(_out, last);
 
-                for (const auto* RESTRICT t = &_node; t->m_parent != nullptr; t = static_cast<const node_t*>(t->m_parent)) {
-                    result.emplace_back(utils::to_nd(static_cast<typename coord_t::value_type>(t->m_index), _size));
-                }
-
-                return result;
+                return last;
             }
 
             /**
              * @brief Constructs a reverse path from a given node to its root in a tree or graph structure.
              *
-             * @details This function iteratively backtracks from the specified node `_node` to its root
-             *          through its parent pointers, converting each node's index into a coordinate
-             *          using the dimensions provided in `_size`. The resulting path is stored in reverse order,
-             *          where the first element corresponds to the root node and the last element corresponds
-             *          to the provided `_node`. The depth of the path is static, provided using the `_depth` parameter.
+             * @details This function backtracks from the specified node `_node` to its root through its parent
+             *          pointers in a single pass, converting each node's index into a coordinate using the dimensions
+             *          provided in `_size`. The resulting path is stored in reverse order, where the first element
+             *          corresponds to the root node and the last element corresponds to the provided `_node`.
              *
              * @param [in] _node The node to begin backtracking from. This is assumed to be part of a structure
              *                   where nodes possess a parent pointer (`m_parent`) for traversal.
              * @param [in] _size The coordinate dimensions, used to convert an index to n-dimensional coordinates.
              *
-             * @param _depth The depth of the hierarchy, which determines the length of the resulting vector.
+             * @param _depth Expected depth of the hierarchy, used to reserve the resulting vector. (optional)
              *
              * @return A vector of n-dimensional coordinates representing the path from the root node
              *         to the provided `_node`.
              */
             template<typename node_t, typename coord_t>
-            static constexpr auto rbacktrack(const node_t& _node, const coord_t& _size, size_t _depth) {
+            static constexpr auto rbacktrack(const node_t& _node, const coord_t& _size, size_t _depth = 0U) {
 
-                std::vector<coord_t> result(_depth);
-
-                size_t i = 0U;
-                for (const auto* RESTRICT t = &_node; t->m_parent != nullptr; t = static_cast<const node_t*>(t->m_parent)) {
-                    result[(result.size() - 1U) - i] = utils::to_nd(static_cast<typename coord_t::value_type>(t->m_index), _size);
-                    ++i;
-                }
+                auto result = rbacktrack_noreverse(_node, _size, _depth);
+                std::reverse(result.begin(), result.end());
 
                 return result;
             }
@@ -630,28 +748,28 @@ namespace chdr::solvers {
             /**
              * @brief Constructs a path from a given node to its root in a tree or graph structure.
              *
-             * @details This function iteratively backtracks from the specified node `_node` to its root
-             *          through its parent pointers, converting each node's index into a coordinate
-             *          using the dimensions provided in `_size`.
-             *          The depth of the path is static, provided using the `_depth` parameter.
+             * @details This function backtracks from the specified node `_node` to its root through its parent
+             *          pointers in a single pass, converting each node's index into a coordinate using the dimensions
+             *          provided in `_size`.
              *
              * @param [in] _node The node to begin backtracking from. This is assumed to be part of a structure
              *                   where nodes possess a parent pointer (`m_parent`) for traversal.
              * @param [in] _size The coordinate dimensions, used to convert an index to n-dimensional coordinates.
-            *
-             * @param _depth The depth of the hierarchy, which determines the length of the resulting vector.
              *
-             * @return A vector of n-dimensional coordinates representing the path from the root node
-             *         to the provided `_node`.
+             * @param _depth Expected depth of the hierarchy, used to reserve the resulting vector. (optional)
+             *
+             * @return A vector of n-dimensional coordinates representing the path from the provided `_node`
+             *         to the root node.
              */
             template<typename node_t, typename coord_t>
-            static constexpr auto rbacktrack_noreverse(const node_t& _node, const coord_t& _size, size_t _depth) {
+            static constexpr auto rbacktrack_noreverse(const node_t& _node, const coord_t& _size, size_t _depth = 0U) {
 
-                std::vector<coord_t> result(_depth);
+                std::vector<coord_t> result{};
+                result.reserve(_depth);
 
-                for (const auto* RESTRICT t = &_node; t->m_parent != nullptr; t = static_cast<const node_t*>(t->m_parent)) {
-                    result.emplace_back(utils::to_nd(static_cast<typename coord_t::value_type>(t->m_index), _size));
-                }
+                rbacktrack_noreverse_into(_node, std::back_inserter(result), [&_size](const auto& _index) ALWAYS_INLINE {
+                    return utils::to_nd(static_cast<typename coord_t::value_type>(_index), _size);
+                });
 
                 return result;
             }
@@ -797,6 +915,60 @@ namespace chdr::solvers {
             }
         }
 
+        /**
+         * @brief Runs a query against the solver, taking care of validation and clean-up.
+         *
+         * @details Invokes `_function` if both `params_t::start` and `params_t::end` refer to active nodes which are not
+         *          known to be disconnected (see `mazes::components`). Afterwards, the memory resources are reset
+         *          (unless `params_t::no_cleanup` is set), even if an exception was thrown. The first exception to
+         *          occur is rethrown once clean-up is complete.
+         *
+         * @param [in]   _params The parameters of the search.
+         * @param [in] _function Callable performing the query. Receives `true` if the start and end are the same node.
+         */
+        template <typename function_t>
+        static void guarded_run(const params_t& _params, function_t&& _function) {
+
+            std::exception_ptr exception { nullptr };
+
+            /*
+             * Run solver:
+             */
+
+            try {
+
+                const auto s = static_cast<typename params_t::index_type>(utils::to_1d(_params.start, _params.size));
+                const auto e = static_cast<typename params_t::index_type>(utils::to_1d(_params.end,   _params.size));
+
+                if (_params.maze.contains(s) && _params.maze[s].is_active() &&
+                    _params.maze.contains(e) && _params.maze[e].is_active() &&
+                    solver_utils::reachable(_params, s, e)
+                ) {
+                    _function(s == e);
+                }
+            }
+            catch (...) { // NOLINT(*-empty-catch)
+
+                // ReSharper disable once CppDFAUnusedValue
+                exception = std::current_exception();
+            }
+
+            // Reset memory resources:
+            if constexpr (!params_t::no_cleanup::value) {
+                try {
+                    solver_utils::reset_resources(_params);
+                }
+                catch (...) { // NOLINT(*-empty-catch)
+                    if (exception == nullptr) { exception = std::current_exception(); }
+                }
+            }
+
+            // Report first exception to occur:
+            if (exception != nullptr) {
+                std::rethrow_exception(exception);
+            }
+        }
+
     public:
 
         /**
@@ -851,7 +1023,11 @@ namespace chdr::solvers {
         }
 
         /**
-         * @brief Executes the solver with the provided parameters.
+         * @brief Executes the solver with the provided parameters, reporting the outcome of the search.
+         *
+         * @details Unlike `solve()`, the result distinguishes between a search which failed to find a path and a search
+         *          which was interrupted by its `budget`. Solvers which are able to produce a path before completing the
+         *          search (such as `arastar`) may return a non-empty path alongside `search_status::exhausted`.
          *
          * @param [in] _params The parameters object to solve with.
          *
@@ -861,57 +1037,302 @@ namespace chdr::solvers {
          *          If you intend for this function to trigger a reset of these parameters, you must provide them as a type where the `reset()` method
          *          is visible.
          *
-         * @return A std::vector containing the result of the search. If the search fails, the vector will be empty.
+         * @return A `search_result` containing the status of the search and the resulting path.
          *
+         * @see budget
          * @see solve
          */
         [[maybe_unused, nodiscard]]
 #if __cplusplus >= 202003L
         constexpr
 #endif // __cplusplus >= 202003L
-        static auto solve(const params_t& _params) {
+        static auto search(const params_t& _params) {
 
-            std::vector<typename params_t::coord_type> result{};
+            search_result<params_t> result {};
+            result.status = search_status::failed;
 
-            std::exception_ptr exception { nullptr };
+            guarded_run(_params, [&_params, &result](const bool _trivial) {
 
-            /*
-             * Run solver:
-             */
+                monitor<params_t> monitor(_params);
 
-            try {
+                try {
+                    if (!_trivial) {
+                        result.path = solver_t<params_t>::invoke(_params, monitor);
+                    }
+                    else {
+                        result.path = { _params.end };
+                        monitor.reach(static_cast<typename params_t::scalar_type>(0));
+                    }
+                }
+                catch (const budget_exhausted&) {} // NOLINT(*-empty-catch)
 
-                const auto s = static_cast<typename params_t::index_type>(utils::to_1d(_params.start, _params.size));
-                const auto e = static_cast<typename params_t::index_type>(utils::to_1d(_params.end,   _params.size));
+                if (monitor.exhausted()) {
+                    result.status = search_status::exhausted;
+                }
+                else if (!result.path.empty()) {
+                    result.status = search_status::found;
+                }
 
-                if (_params.maze.contains(s) && _params.maze[s].is_active() &&
-                    _params.maze.contains(e) && _params.maze[e].is_active()
-                ) {
-                    result = s != e ?
-                        solver_t<params_t>::invoke(_params) :
-                        std::vector<typename params_t::coord_type> { _params.end };
+                if (!result.path.empty()) {
+                    result.cost = monitor.cost();
                 }
-            }
-            catch (...) { // NOLINT(*-empty-catch)
 
-                // ReSharper disable once CppDFAUnusedValue
-                exception = std::current_exception();
-            }
+#if CHDR_DIAGNOSTICS == 1
+                result.stats = monitor.stats();
+#endif //CHDR_DIAGNOSTICS == 1
+            });
+
+            return result;
+        }
+
+        /**
+         * @brief Executes the solver with the provided parameters.
+         *
+         * @param [in] _params The parameters object to solve with.
+         *
+         * @remarks Calling this will reset the state of `monotonic_pmr`, `heterogeneous_pmr`, and `homogeneous_pmr`, if they have a visible method `reset()`.
+         *
+         * @warning Aliasing the polymorphic memory resources as other types may hide the `reset()` method from this function.
+         *          If you intend for this function to trigger a reset of these parameters, you must provide them as a type where the `reset()` method
+         *          is visible.
+         *
+         * @return A std::vector containing the result of the search. If the search fails, or its budget is exhausted, the vector will be empty.
+         *
+         * @see search
+         */
+        [[maybe_unused, nodiscard]]
+#if __cplusplus >= 202003L
+        constexpr
+#endif // __cplusplus >= 202003L
+        static auto solve(const params_t& _params) {
+
+            std::vector<typename params_t::coord_type> result {};
+
+            guarded_run(_params, [&_params, &result](const bool _trivial) {
+
+                monitor<params_t> monitor(_params);
 
-            // Reset memory resources:
-            if constexpr (!params_t::no_cleanup::value) {
                 try {
-                    solver_utils::reset_resources(_params);
+                    result = !_trivial ?
+                        solver_t<params_t>::invoke(_params, monitor) :
+                        std::vector<typename params_t::coord_type> { _params.end };
                 }
-                catch (...) { // NOLINT(*-empty-catch)
-                    if (exception == nullptr) { exception = std::current_exception(); }
+                catch (const budget_exhausted&) {} // NOLINT(*-empty-catch)
+            });
+
+            return result;
+        }
+
+        /**
+         * @brief Solves a query, writing the resulting path into a caller-provided range.
+         *
+         * @details For solvers which provide a resumable `context` (such as `astar`, `gstar`, `bfs` and `dijkstra`),
+         *          the path is written directly from the search tree, so that no result vector is allocated.
+         *          Other solvers fall back to copying the result of `solve()`.\n\n
+         *
+         *          The path is written in the same order as returned by `solve()`. If `params_t::reverse_equivalence`
+         *          is enabled, the path may be reversed in place after being written, so `_out` should be a
+         *          bidirectional iterator, such as a pointer into a buffer.
+         *
+         * @param [in] _params The parameters of the search.
+         * @param [out]   _out The beginning of the destination range. Must be large enough to hold the path.
+         *
+         * @return Output iterator to the element past the last element written. Equal to `_out` if no path was found.
+         */
+        template <typename OutputIt>
+        [[maybe_unused]] static OutputIt solve_into(const params_t& _params, OutputIt _out) {
+
+            guarded_run(_params, [&_params, &_out](const bool _trivial) {
+
+                if (_trivial) {
+                    *_out = _params.end;
+                    ++_out;
                 }
-            }
+                else if constexpr (solver_utils::template has_context_v<solver_t<params_t>>) {
 
-            // Report first exception to occur:
-            if (exception != nullptr) {
-                std::rethrow_exception(exception);
-            }
+                    typename solver_t<params_t>::context ctx(_params);
+
+                    if (ctx.step() == search_status::found) {
+                        _out = ctx.path(_out);
+                    }
+                }
+                else {
+
+                    monitor<params_t> monitor(_params);
+
+                    try {
+                        for (const auto& coord : solver_t<params_t>::invoke(_params, monitor)) {
+                            *_out = coord;
+                            ++_out;
+                        }
+                    }
+                    catch (const budget_exhausted&) {} // NOLINT(*-empty-catch)
+                }
+            });
+
+            return _out;
+        }
+
+        /**
+         * @brief Solves a query, writing the node indices of the resulting path into a caller-provided range.
+         *
+         * @details Equivalent to `solve_into()`, but writes the index of each node rather than its coordinate.
+         *          For solvers which provide a resumable `context`, the conversion of indices into coordinates
+         *          is skipped entirely.
+         *
+         * @param [in] _params The parameters of the search.
+         * @param [out]   _out The beginning of the destination range. Must be large enough to hold the path.
+         *
+         * @return Output iterator to the element past the last element written. Equal to `_out` if no path was found.
+         *
+         * @see solve_into()
+         */
+        template <typename OutputIt>
+        [[maybe_unused]] static OutputIt solve_indices(const params_t& _params, OutputIt _out) {
+
+            using index_t = typename params_t::index_type;
+
+            guarded_run(_params, [&_params, &_out](const bool _trivial) {
+
+                if (_trivial) {
+                    *_out = static_cast<index_t>(utils::to_1d(_params.end, _params.size));
+                    ++_out;
+                }
+                else if constexpr (solver_utils::template has_context_v<solver_t<params_t>>) {
+
+                    typename solver_t<params_t>::context ctx(_params);
+
+                    if (ctx.step() == search_status::found) {
+                        _out = ctx.indices(_out);
+                    }
+                }
+                else {
+
+                    monitor<params_t> monitor(_params);
+
+                    try {
+                        for (const auto& coord : solver_t<params_t>::invoke(_params, monitor)) {
+                            *_out = static_cast<index_t>(utils::to_1d(coord, _params.size));
+                            ++_out;
+                        }
+                    }
+                    catch (const budget_exhausted&) {} // NOLINT(*-empty-catch)
+                }
+            });
+
+            return _out;
+        }
+
+        /**
+         * @brief Solves a query, encoding the resulting path into a compact path container.
+         *
+         * @details For solvers which provide a resumable `context`, coordinates are pushed into the container while
+         *          walking the search tree, so that the full coordinate vector is never built. Other solvers encode
+         *          the result of `solve()`.
+         *
+         * @code
+         *
+         * const auto path = chdr::solvers::solver<chdr::solvers::astar, params>::solve_as<chdr::rle_path<coord_t>>(args);
+         *
+         * @endcode
+         *
+         * @tparam path_t A default-constructible container with `push_back()`, `clear()` and `reverse()` methods,
+         *                such as `rle_path` or `waypoint_path`.
+         *
+         * @param [in] _params The parameters of the search.
+         *
+         * @return The encoded path, in the same order as returned by `solve()`. Empty if no path was found.
+         *
+         * @see rle_path
+         * @see waypoint_path
+         */
+        template <typename path_t>
+        [[maybe_unused, nodiscard]] static path_t solve_as(const params_t& _params) {
+
+            path_t result {};
+
+            guarded_run(_params, [&_params, &result](const bool _trivial) {
+
+                if (_trivial) {
+                    result.push_back(_params.end);
+                }
+                else if constexpr (solver_utils::template has_context_v<solver_t<params_t>>) {
+
+                    typename solver_t<params_t>::context ctx(_params);
+
+                    if (ctx.step() == search_status::found) {
+                        ctx.encode(result);
+                    }
+                }
+                else {
+
+                    monitor<params_t> monitor(_params);
+
+                    try {
+                        for (const auto& coord : solver_t<params_t>::invoke(_params, monitor)) {
+                            result.push_back(coord);
+                        }
+                    }
+                    catch (const budget_exhausted&) {} // NOLINT(*-empty-catch)
+                }
+            });
+
+            return result;
+        }
+
+        /**
+         * @brief Solves a query on a grid, and smooths the resulting path using line-of-sight tests.
+         *
+         * @details The path is found as by `solve()`, and redundant vertices are then removed in place, in the same
+         *          call and before the memory resources are reset. Smoothing itself does not allocate.\n\n
+         *
+         *          By default, greedy shortcutting is used (see `smoothing::shortcut()`). If `StringPull` is set, the
+         *          path is instead pulled taut by repeated passes in alternating directions (see `smoothing::string_pull()`).
+         *
+         * @tparam StringPull Whether to pull the path taut, rather than applying a single greedy pass.
+         *
+         * @param [in] _params The parameters of the search. `params_t::maze` must be a `mazes::grid`.
+         *
+         * @return The smoothed path, in the same order as returned by `solve()`. Consecutive coordinates are not
+         *         necessarily adjacent. If the search fails, or its budget is exhausted, the vector will be empty.
+         *
+         * @see smoothing
+         */
+        template <bool StringPull = false>
+        [[maybe_unused, nodiscard]] static auto solve_smoothed(const params_t& _params) {
+
+            static_assert(!solver_utils::template is_graph_v<decltype(_params.maze)>, "Path smoothing requires a grid maze.");
+
+            std::vector<typename params_t::coord_type> result {};
+
+            guarded_run(_params, [&_params, &result](const bool _trivial) {
+
+                if (_trivial) {
+                    result.emplace_back(_params.end);
+                }
+                else {
+
+                    monitor<params_t> monitor(_params);
+
+                    try {
+                        result = solver_t<params_t>::invoke(_params, monitor);
+                    }
+                    catch (const budget_exhausted&) {} // NOLINT(*-empty-catch)
+
+                    if (!monitor.exhausted()) {
+
+                        if constexpr (StringPull) {
+                            static_cast<void>(smoothing::string_pull(_params.maze, result));
+                        }
+                        else {
+                            static_cast<void>(smoothing::shortcut(_params.maze, result));
+                        }
+                    }
+                    else {
+                        result.clear();
+                    }
+                }
+            });
 
             return result;
         }
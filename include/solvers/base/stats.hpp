@@ -0,0 +1,60 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_STATS_HPP
+#define CHDR_STATS_HPP
+
+/**
+ * @file stats.hpp
+ */
+
+#include <cstddef>
+
+namespace chdr::solvers {
+
+    /**
+     * @struct search_stats
+     * @brief Counters describing the work performed by a single search.
+     *
+     * @details Statistics are gathered by the `monitor` of a search, and are reported through `search_result` by
+     *          `solver::search()`. They are only collected when `CHDR_DIAGNOSTICS` is enabled, otherwise all
+     *          counting compiles out and this structure is absent from `search_result`.\n\n
+     *
+     *          Pool figures are taken from the diagnostic counters of the memory resources supplied in `params_t`,
+     *          and are zero for resources which do not provide them.
+     *
+     * @see monitor
+     * @see search_result
+     */
+    struct search_stats final {
+
+        /** @brief Number of nodes expanded. */
+        size_t expanded = 0U;
+
+        /** @brief Number of nodes pushed to the open set. */
+        size_t generated = 0U;
+
+        /** @brief Largest size reached by the open set. */
+        size_t peak_open = 0U;
+
+        /** @brief Number of nodes added to the closed set. */
+        size_t closed = 0U;
+
+        /** @brief Peak number of bytes allocated from `params_t::monotonic_pmr`. */
+        size_t monotonic_peak_bytes = 0U;
+
+        /** @brief Peak number of bytes allocated from `params_t::heterogeneous_pmr`. */
+        size_t heterogeneous_peak_bytes = 0U;
+
+        /** @brief Peak number of bytes allocated from `params_t::homogeneous_pmr`. */
+        size_t homogeneous_peak_bytes = 0U;
+    };
+
+} //chdr::solvers
+
+#endif //CHDR_STATS_HPP
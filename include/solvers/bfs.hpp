@@ -14,6 +14,9 @@
  */
 
 #include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
 #include <vector>
 
 #include "../types/containers/existence_set.hpp"
@@ -76,75 +79,295 @@ namespace chdr::solvers {
         using solver_t = solver<bfs, params_t>;
         using     node = unmanaged_node<index_t>;
 
-        template <typename open_set_t, typename closed_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
-            constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
+            context ctx(_params);
+            static_cast<void>(ctx.advance(std::numeric_limits<size_t>::max(), _monitor));
 
-            const auto&   end = do_reverse ? _params.start : _params.end;
-            const auto& start = do_reverse ? _params.end   : _params.start;
+            return ctx.path();
+        }
 
-            const auto s = utils::to_1d(start, _params.size);
-            const auto e = utils::to_1d(end,   _params.size);
+    public:
+
+        /**
+         * @class context
+         * @brief A resumable breadth-first search.
+         *
+         * @details Holds the complete state of a search (open set, closed set and nodes) between calls to `step()`,
+         *          allowing a search to be amortised over several frames. A context may be resumed on any thread,
+         *          provided that calls to `step()` are not made concurrently.\n\n
+         *
+         *          Once complete, the path may be retrieved as a vector using `path()`, or written into a caller-provided
+         *          buffer using `path(OutputIt)` or `indices(OutputIt)`, which do not allocate.
+         *
+         * @code
+         *
+         * chdr::solvers::bfs<params>::context ctx(args);
+         *
+         * while (ctx.step(1000U) == chdr::solvers::search_status::in_progress) {
+         *     ... // Do other work.
+         * }
+         *
+         * const auto& path = ctx.path();
+         *
+         * @endcode
+         *
+         * @warning The parameters, maze and memory resources must outlive the context. Unlike `solver::solve()`, the
+         *          memory resources are not reset when the search completes.
+         */
+        class context final {
+
+            friend bfs;
+
+            const params_t& m_params;
+
+            monitor<params_t> m_monitor;
+
+            size_t m_capacity;
+            index_t m_e;
+
+            existence_set<> m_closed;
+            queue<node>     m_open;
+
+            search_status m_status;
+            node m_goal;
+
+            template <typename monitor_t>
+            [[nodiscard]] HOT search_status advance(size_t _max_expansions, monitor_t& _monitor) {
+
+                // Main loop:
+                for (size_t expansions = 0U; LIKELY(expansions < _max_expansions);) {
+
+                    if (UNLIKELY(m_open.empty())) {
+                        return m_status = search_status::failed;
+                    }
 
-              _open.emplace(s);
-            _closed.emplace(s);
+                    auto curr(std::move(m_open.top()));
+                    m_open.pop();
 
-            // Main loop:
-            while (LIKELY(!_open.empty())) {
+                    if (curr.m_index != m_e) { // SEARCH FOR SOLUTION...
 
-                auto curr(std::move(_open.top()));
-                _open.pop();
+                        _monitor.expand();
+                        ++expansions;
 
-                if (curr.m_index != e) { // SEARCH FOR SOLUTION...
+                        node* RESTRICT curr_ptr(nullptr);
 
-                    node* RESTRICT curr_ptr(nullptr);
+                        for (const auto& n_data : m_params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
 
-                    for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
+                            if (const auto& n = solver_t::get_data(n_data, m_params); n.active) {
 
-                        if (const auto& n = solver_t::get_data(n_data, _params); n.active) {
+                                // Check if node is not already visited:
+                                if (!m_closed.contains(n.index)) {
+                                    solver_t::solver_utils::preallocate_emplace(m_closed, n.index, m_capacity, m_params.maze.count());
+                                    _monitor.close();
 
-                            // Check if node is not already visited:
-                            if (!_closed.contains(n.index)) {
-                                solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                    if (curr_ptr == nullptr) {
+                                        curr_ptr = new (m_params.monotonic_pmr->allocate(sizeof(node), alignof(node))) node(std::move(curr));
+                                    }
 
-                                if (curr_ptr == nullptr) {
-                                    curr_ptr = new (_params.monotonic_pmr->allocate(sizeof(node), alignof(node))) node(std::move(curr));
+                                    m_open.emplace(n.index, curr_ptr);
+                                    _monitor.generate(m_open.size());
                                 }
-
-                                _open.emplace(n.index, curr_ptr);
                             }
                         }
                     }
+                    else { // SOLUTION REACHED...
+
+                        m_open   = queue<node>{};
+                        m_closed = existence_set<>{};
+
+                        m_goal = std::move(curr);
+
+                        return m_status = search_status::found;
+                    }
                 }
-                else { // SOLUTION REACHED...
 
-                    _open   =   open_set_t{};
-                    _closed = closed_set_t{};
+                return m_status;
+            }
+
+            template <bool Reverse = params_t::reverse_equivalence::value, typename OutputIt, typename transform_t>
+            HOT OutputIt write(OutputIt _out, transform_t&& _transform) const {
+
+                if (m_status == search_status::found) {
 
-                    if constexpr (params_t::reverse_equivalence::value) {
-                        return solver_t::solver_utils::rbacktrack(curr, _params.size);
+                    if (m_goal.m_parent == nullptr) { // Start and end are the same node.
+                        *_out = _transform(m_goal.m_index);
+                        ++_out;
+                    }
+                    else if constexpr (Reverse) {
+                        _out = solver_t::solver_utils::rbacktrack_into(m_goal, _out, std::forward<transform_t>(_transform));
                     }
                     else {
-                        return solver_t::solver_utils::rbacktrack_noreverse(curr, _params.size);
+                        _out = solver_t::solver_utils::rbacktrack_noreverse_into(m_goal, _out, std::forward<transform_t>(_transform));
                     }
                 }
+
+                return _out;
             }
 
-            return std::vector<coord_t>{};
-        }
+        public:
+
+            /**
+             * @name Constructors
+             * @{
+             */
+
+            /**
+             * @brief Begins a search.
+             * @param [in] _params The parameters of the search. Must outlive the context.
+             */
+            [[nodiscard]] explicit context(const params_t& _params) :
+                m_params  (_params),
+                m_monitor (_params),
+                m_capacity(solver_t::solver_utils::determine_capacity(_params)),
+                m_e       (0U),
+                m_closed  (_params.monotonic_pmr),
+                m_open    (_params.heterogeneous_pmr),
+                m_status  (search_status::in_progress),
+                m_goal    ()
+            {
+                constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
+
+                const auto&   end = do_reverse ? _params.start : _params.end;
+                const auto& start = do_reverse ? _params.end   : _params.start;
+
+                const auto s = static_cast<index_t>(utils::to_1d(start, _params.size));
+                m_e          = static_cast<index_t>(utils::to_1d(end,   _params.size));
+
+                if (!_params.maze.contains(s) || !_params.maze[s].is_active() ||
+                    !_params.maze.contains(m_e) || !_params.maze[m_e].is_active()
+                ) {
+                    m_status = search_status::failed;
+                }
+                else if (s == m_e) {
+                    m_goal   = node(m_e);
+                    m_status = search_status::found;
+                }
+                else {
+                    m_closed.reserve(m_capacity);
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+                      m_open.emplace(s);
+                    m_closed.emplace(s);
+                }
+            }
 
-            const auto capacity = solver_t::solver_utils::determine_capacity(_params);
+            ~context() = default;
+
+            context           (const context&) = delete;
+            context& operator=(const context&) = delete;
+            context           (context&&)      = delete;
+            context& operator=(context&&)      = delete;
+
+            /**
+             * @}
+             */
+
+            /**
+             * @brief Advances the search.
+             *
+             * @param _max_expansions Maximum number of nodes to expand before returning. (optional)
+             *
+             * @return `search_status::in_progress` if the search is incomplete. Otherwise, the final status of the search.
+             */
+            [[maybe_unused]] HOT search_status step(size_t _max_expansions = std::numeric_limits<size_t>::max()) {
+
+                if (m_status == search_status::in_progress) {
+                    try {
+                        static_cast<void>(advance(_max_expansions, m_monitor));
+                    }
+                    catch (const budget_exhausted&) {
+                        m_status = search_status::exhausted;
+                    }
+                }
 
-            existence_set closed(_params.monotonic_pmr);
-            closed.reserve(capacity);
+                return m_status;
+            }
 
-            queue<node> open(_params.heterogeneous_pmr);
+            /**
+             * @brief Status of the search.
+             */
+            [[maybe_unused, nodiscard]] constexpr search_status status() const noexcept { return m_status; }
 
-            return solve_internal(open, closed, capacity, _params);
-        }
+            /**
+             * @brief The resulting path. Empty unless the search has completed successfully.
+             *
+             * @see path(OutputIt)
+             */
+            [[maybe_unused, nodiscard]] std::vector<coord_t> path() const {
+
+                std::vector<coord_t> result{};
+
+                if (m_status == search_status::found) {
+
+                    if (m_goal.m_parent == nullptr) {
+                        result.emplace_back(m_params.end);
+                    }
+                    else if constexpr (params_t::reverse_equivalence::value) {
+                        result = solver_t::solver_utils::rbacktrack(m_goal, m_params.size);
+                    }
+                    else {
+                        result = solver_t::solver_utils::rbacktrack_noreverse(m_goal, m_params.size);
+                    }
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Writes the resulting path into a caller-provided range, without allocating.
+             *
+             * @details Nothing is written unless the search has completed successfully. The path is written in the
+             *          same order as returned by `path()`. If `params_t::reverse_equivalence` is enabled, the path is
+             *          reversed in place after being written, so `_out` must be a bidirectional iterator.
+             *
+             * @param [out] _out The beginning of the destination range, i.e. a pointer into a buffer of sufficient size.
+             *
+             * @return Output iterator to the element past the last element written.
+             */
+            template <typename OutputIt>
+            [[maybe_unused]] OutputIt path(OutputIt _out) const {
+
+                return write(_out, [this](index_t _index) ALWAYS_INLINE {
+                    return utils::to_nd(static_cast<typename coord_t::value_type>(_index), m_params.size);
+                });
+            }
+
+            /**
+             * @brief Writes the node indices of the resulting path into a caller-provided range, without allocating.
+             *
+             * @details Equivalent to `path(OutputIt)`, but skips the conversion of each index into a coordinate.
+             *
+             * @param [out] _out The beginning of the destination range, i.e. a pointer into a buffer of sufficient size.
+             *
+             * @return Output iterator to the element past the last element written.
+             */
+            template <typename OutputIt>
+            [[maybe_unused]] OutputIt indices(OutputIt _out) const {
+                return write(_out, [](index_t _index) ALWAYS_INLINE { return _index; });
+            }
+
+            /**
+             * @brief Encodes the resulting path into a compact path container, such as `rle_path` or `waypoint_path`.
+             *
+             * @details Coordinates are pushed to `_path` while walking the search tree, so that no intermediate
+             *          coordinate vector is built. The encoded path has the same order as `path()`.
+             *
+             * @param [out] _path The container to encode the path into. It is cleared before encoding.
+             */
+            template <typename path_t>
+            [[maybe_unused]] void encode(path_t& _path) const {
+
+                _path.clear();
+
+                static_cast<void>(write<false>(std::back_inserter(_path), [this](index_t _index) ALWAYS_INLINE {
+                    return utils::to_nd(static_cast<typename coord_t::value_type>(_index), m_params.size);
+                }));
+
+                if constexpr (params_t::reverse_equivalence::value) {
+                    _path.reverse();
+                }
+            }
+        };
     };
 
     /**
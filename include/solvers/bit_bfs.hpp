@@ -0,0 +1,489 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_BIT_BFS_HPP
+#define CHDR_BIT_BFS_HPP
+
+/**
+ * @file bit_bfs.hpp
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+#include "../utils/utils.hpp"
+#include "base/solver.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::solvers {
+
+    /**
+     * @addtogroup Solvers
+     * @brief Graph traversal and pathfinding algorithms.
+     * @{
+     * @addtogroup Single-Target
+     * @brief Solvers which route to a single destination.
+     * @{
+     * @addtogroup SingleTargetCommon Common
+     * @brief General-purpose solvers.
+     * @{
+     */
+
+    /**
+     * @struct bit_bfs
+     * @brief Bit-parallel breadth-first search.
+     * @details A breadth-first search for grids which expands 64 cells of the wavefront at once. The frontier and the
+     *          set of unvisited cells are stored as bitsets, so that the next wavefront may be computed as\n\n
+     *
+     *          `next = (frontier shifted one step along each axis, in each direction) & unvisited`\n\n
+     *
+     *          using only shifts and masks of 64-bit words.\n\n
+     *
+     *          The grid is divided into tiles of 64 cells (8x8 in two dimensions, 4x4x4 in three), each stored in a
+     *          single word, so that the number of words a wavefront touches is proportional to its surface in any
+     *          orientation. A step within a tile is a shift of its word, and a step across the edge of a tile carries
+     *          in the opposite face of the neighbouring tile. Only tiles bordering the frontier are processed, and
+     *          each tile is read from the grid the first time the search reaches it.\n\n
+     *
+     *          Rather than a parent per cell, the depth of each visited cell is stored modulo 3 in two further
+     *          bitsets. Neighbouring cells differ in depth by at most one, so the path is recovered by a backward pass
+     *          from the end, stepping each time to any visited neighbour one level shallower.
+     *
+     * Advantages:
+     * - Expands up to 64 cells per operation, which is much faster than `bfs` on open maps.
+     * - Stores a few bits per cell, rather than a node per cell.
+     * - Only reads the parts of the grid which the search reaches.
+     *
+     * Limitations:
+     * - Only applicable to grids. Weights are ignored, as for all grid solvers.
+     * - Offers less benefit over `bfs` in narrow corridors (such as those of mazes), where tiles are mostly blocked.
+     * - Each wavefront counts as a single expansion towards a `budget`.
+     *
+     * Further Reading:
+     * - <a href="https://en.wikipedia.org/wiki/Breadth-first_search">Wikipedia Article</a>
+     *
+     * @note If the search space is uniform-cost, the resulting path is optimal.
+     * @tparam params_t Type containing the search parameters.
+     *
+     * @see bfs
+     */
+    template<typename params_t>
+    struct [[maybe_unused]] bit_bfs final {
+
+        friend class solver<bit_bfs, params_t>;
+
+    private:
+
+        using  index_t = typename params_t::index_type;
+        using  coord_t = typename params_t::coord_type;
+        using solver_t = solver<bit_bfs, params_t>;
+
+        static_assert(!solver_t::solver_utils::template is_graph_v<decltype(std::declval<params_t>().maze)>, "bit_bfs requires a grid maze.");
+
+        using   word_t = uint64_t;
+        using bitset_t = std::pmr::vector<word_t>;
+
+        static constexpr size_t Kd     = std::tuple_size_v<coord_t>;
+        static constexpr size_t s_bits = 64U;
+
+        using tile_coord_t = std::array<size_t, Kd>;
+
+        /**
+         * @brief Arrangement of the cells of a grid into tiles of 64 cells, each stored in a single word.
+         */
+        struct layout final {
+
+            std::array<size_t, Kd> log2;        // Log2 of the extent of a tile along each axis.
+            std::array<size_t, Kd> cell_stride; // Distance between neighbouring cells of a tile, in bits.
+            std::array<size_t, Kd> tiles;       // Number of tiles along each axis.
+            std::array<size_t, Kd> tile_stride; // Distance between neighbouring tiles, in words.
+            std::array<word_t, Kd> low;         // Cells on the lower face of a tile.
+            std::array<word_t, Kd> high;        // Cells on the upper face of a tile.
+
+            size_t count;
+
+            explicit constexpr layout(const coord_t& _size) noexcept :
+                log2       (),
+                cell_stride(),
+                tiles      (),
+                tile_stride(),
+                low        (),
+                high       (),
+                count      (1U)
+            {
+                // Share the six bits of a position within a tile between the axes:
+                for (size_t i = 0U; i < 6U; ++i) {
+                    ++log2[i % Kd];
+                }
+
+                size_t stride { 1U };
+
+                for (size_t a = 0U; a < Kd; ++a) {
+
+                    cell_stride[a] = stride;
+                    stride <<= log2[a];
+
+                    tiles      [a] = (static_cast<size_t>(_size[a]) + extent(a) - 1U) >> log2[a];
+                    tile_stride[a] = count;
+                    count         *= tiles[a];
+                }
+
+                for (size_t bit = 0U; bit < s_bits; ++bit) {
+                    for (size_t a = 0U; a < Kd; ++a) {
+
+                        const auto local = (bit / cell_stride[a]) & (extent(a) - 1U);
+
+                        if (local == 0U)              { low [a] |= static_cast<word_t>(1U) << bit; }
+                        if (local == extent(a) - 1U) { high[a] |= static_cast<word_t>(1U) << bit; }
+                    }
+                }
+            }
+
+            [[nodiscard]] HOT constexpr size_t extent(size_t _axis) const noexcept {
+                return static_cast<size_t>(1U) << log2[_axis];
+            }
+
+            /**
+             * @brief Shift which carries the upper face of a tile onto the lower face of the next (and vice versa).
+             */
+            [[nodiscard]] HOT constexpr size_t carry(size_t _axis) const noexcept {
+                return (extent(_axis) - 1U) * cell_stride[_axis];
+            }
+
+            /**
+             * @brief Position of a cell within the bitsets.
+             */
+            [[nodiscard]] HOT constexpr size_t position(const coord_t& _coord) const noexcept {
+
+                size_t tile  { 0U };
+                size_t local { 0U };
+
+                for (size_t a = 0U; a < Kd; ++a) {
+                    tile  += (static_cast<size_t>(_coord[a]) >> log2[a]) * tile_stride[a];
+                    local += (static_cast<size_t>(_coord[a]) & (extent(a) - 1U)) * cell_stride[a];
+                }
+
+                return (tile * s_bits) + local;
+            }
+
+            [[nodiscard]] HOT constexpr tile_coord_t tile_coord(size_t _tile) const noexcept {
+
+                tile_coord_t result{};
+
+                for (size_t a = 0U; a < Kd; ++a) {
+                    result[a] = _tile % tiles[a];
+                    _tile    /= tiles[a];
+                }
+
+                return result;
+            }
+        };
+
+        [[nodiscard]] HOT static constexpr bool test(const bitset_t& _bitset, size_t _position) noexcept {
+            return ((_bitset[_position / s_bits] >> (_position % s_bits)) & 1U) != 0U;
+        }
+
+        /**
+         * @brief A tile of `_bitset`, dilated by one cell along each of its first `_axes` axes in turn.
+         * @details Dilating along each axis in turn also reaches diagonal neighbours.
+         */
+        [[nodiscard]] HOT static constexpr word_t dilate(const bitset_t& _bitset, const layout& _layout, size_t _axes, size_t _tile, tile_coord_t _tc) noexcept {
+
+            if (_axes == 0U) {
+                return _bitset[_tile];
+            }
+
+            const auto a = _axes - 1U;
+
+            const auto centre = dilate(_bitset, _layout, a, _tile, _tc);
+
+            auto result = centre |
+                ((centre << _layout.cell_stride[a]) & ~_layout.low [a]) |
+                ((centre >> _layout.cell_stride[a]) & ~_layout.high[a]);
+
+            if (const auto c = _tc[a]; c > 0U) {
+                _tc[a] = c - 1U;
+                result |= (dilate(_bitset, _layout, a, _tile - _layout.tile_stride[a], _tc) >> _layout.carry(a)) & _layout.low[a];
+                _tc[a] = c;
+            }
+
+            if (const auto c = _tc[a]; c + 1U < _layout.tiles[a]) {
+                _tc[a] = c + 1U;
+                result |= (dilate(_bitset, _layout, a, _tile + _layout.tile_stride[a], _tc) << _layout.carry(a)) & _layout.high[a];
+                _tc[a] = c;
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief The cells of a tile which neighbour a cell of `_bitset`.
+         */
+        [[nodiscard]] HOT static constexpr word_t neighbours(const bitset_t& _bitset, const layout& _layout, size_t _tile, const tile_coord_t& _tc) noexcept {
+
+            if constexpr (params_t::octile_neighbours::value) {
+                return dilate(_bitset, _layout, Kd, _tile, _tc);
+            }
+            else {
+
+                const auto centre = _bitset[_tile];
+
+                word_t result { 0U };
+
+                for (size_t a = 0U; a < Kd; ++a) {
+
+                    result |= ((centre << _layout.cell_stride[a]) & ~_layout.low [a]) |
+                              ((centre >> _layout.cell_stride[a]) & ~_layout.high[a]);
+
+                    if (_tc[a] > 0U) {
+                        result |= (_bitset[_tile - _layout.tile_stride[a]] >> _layout.carry(a)) & _layout.low[a];
+                    }
+
+                    if (_tc[a] + 1U < _layout.tiles[a]) {
+                        result |= (_bitset[_tile + _layout.tile_stride[a]] << _layout.carry(a)) & _layout.high[a];
+                    }
+                }
+
+                return result;
+            }
+        }
+
+        /**
+         * @brief Reads the traversable cells of a tile from the grid.
+         */
+        [[nodiscard]] static word_t load(const layout& _layout, size_t _tile, const params_t& _params) noexcept {
+
+            const auto tc = _layout.tile_coord(_tile);
+
+            word_t result { 0U };
+
+            for (size_t bit = 0U; bit < s_bits; ++bit) {
+
+                coord_t coord{};
+                bool inside { true };
+
+                for (size_t a = 0U; a < Kd; ++a) {
+
+                    const auto c = (tc[a] << _layout.log2[a]) + ((bit / _layout.cell_stride[a]) & (_layout.extent(a) - 1U));
+
+                    inside  &= c < static_cast<size_t>(_params.size[a]);
+                    coord[a] = static_cast<typename coord_t::value_type>(c);
+                }
+
+                if (inside && _params.maze[utils::to_1d(coord, _params.size)].is_active()) {
+                    result |= static_cast<word_t>(1U) << bit;
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief The depth of a visited cell, modulo 3.
+         */
+        [[nodiscard]] HOT static constexpr size_t depth(const std::array<bitset_t, 2U>& _depths, size_t _position) noexcept {
+            return test(_depths[0U], _position) ? 1U : test(_depths[1U], _position) ? 2U : 0U;
+        }
+
+        [[nodiscard]] static auto backtrack(const layout& _layout, const std::array<bitset_t, 2U>& _depths, const bitset_t& _visited, size_t _root, size_t _target, size_t _level, const params_t& _params) {
+
+            std::vector<coord_t> result{};
+            result.reserve(_level);
+
+            for (auto curr = _target; curr != _root; --_level) {
+
+                result.emplace_back(utils::to_nd(static_cast<index_t>(curr), _params.size));
+
+                // Step to any visited neighbour one level shallower:
+                for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(static_cast<index_t>(curr))) {
+
+                    if (const auto& n = solver_t::get_data(n_data, _params); n.active) {
+
+                        if (const auto p = _layout.position(n.coord); test(_visited, p) && depth(_depths, p) == (_level - 1U) % 3U) {
+                            curr = n.index;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if constexpr (params_t::reverse_equivalence::value) {
+                std::reverse(result.begin(), result.end());
+            }
+
+            return result;
+        }
+
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
+
+            constexpr bool do_reverse = params_t::reverse_equivalence::value;
+
+            const auto& root_coord   = do_reverse ? _params.end   : _params.start;
+            const auto& target_coord = do_reverse ? _params.start : _params.end;
+
+            const auto root   = utils::to_1d(  root_coord, _params.size);
+            const auto target = utils::to_1d(target_coord, _params.size);
+
+            if (root == target) {
+                return std::vector<coord_t> { _params.end };
+            }
+
+            const layout tiles(_params.size);
+
+            auto* resource = _params.monotonic_pmr;
+
+            bitset_t unvisited(tiles.count, 0U, resource);
+            bitset_t   visited(tiles.count, 0U, resource);
+            bitset_t  frontier(tiles.count, 0U, resource);
+            bitset_t      next(tiles.count, 0U, resource);
+
+            std::array<bitset_t, 2U> depths { bitset_t(tiles.count, 0U, resource), bitset_t(tiles.count, 0U, resource) };
+
+            // Level at which each tile was last queued for expansion, or 0 if it has not yet been read from the grid:
+            std::pmr::vector<size_t> queued(tiles.count, 0U, resource);
+
+            std::pmr::vector<size_t> curr_tiles(resource);
+            std::pmr::vector<size_t> next_tiles(resource);
+            std::pmr::vector<size_t> candidates(resource);
+
+            // Offsets of the tiles which may border a tile of the frontier (including the tile itself):
+            std::vector<std::array<int, Kd>> directions;
+
+            for (size_t code = 0U; code < utils::powui<size_t>(3U, Kd); ++code) {
+
+                std::array<int, Kd> direction{};
+
+                size_t magnitude { 0U };
+
+                for (size_t a = 0U, c = code; a < Kd; ++a, c /= 3U) {
+                    direction[a] = static_cast<int>(c % 3U) - 1;
+                    magnitude   += direction[a] != 0 ? 1U : 0U;
+                }
+
+                if (params_t::octile_neighbours::value || magnitude <= 1U) {
+                    directions.emplace_back(direction);
+                }
+            }
+
+            const auto target_position = tiles.position(target_coord);
+
+            {
+                const auto p = tiles.position(root_coord);
+                const auto t = p / s_bits;
+
+                  visited[t] = static_cast<word_t>(1U) << (p % s_bits);
+                unvisited[t] = load(tiles, t, _params) & ~visited[t];
+                 frontier[t] = visited[t];
+                   queued[t] = 1U;
+
+                curr_tiles.emplace_back(t);
+            }
+
+            for (size_t level = 1U; !curr_tiles.empty(); ++level) {
+
+                _monitor.expand();
+
+                // Gather the tiles bordering the frontier, reading each from the grid on first contact:
+                candidates.clear();
+
+                for (const auto t : curr_tiles) {
+
+                    const auto tc = tiles.tile_coord(t);
+
+                    for (const auto& direction : directions) {
+
+                        auto n = t;
+                        bool inside { true };
+
+                        for (size_t a = 0U; a < Kd && inside; ++a) {
+
+                            if (direction[a] < 0) {
+                                inside = tc[a] > 0U;
+                                n     -= tiles.tile_stride[a];
+                            }
+                            else if (direction[a] > 0) {
+                                inside = tc[a] + 1U < tiles.tiles[a];
+                                n     += tiles.tile_stride[a];
+                            }
+                        }
+
+                        if (inside && queued[n] != level + 1U) {
+
+                            if (queued[n] == 0U) {
+                                unvisited[n] = load(tiles, n, _params);
+                            }
+
+                            queued[n] = level + 1U;
+                            candidates.emplace_back(n);
+                        }
+                    }
+                }
+
+                // Expand the wavefront:
+                const auto plane = level % 3U;
+
+                next_tiles.clear();
+
+                for (const auto t : candidates) {
+
+                    if (unvisited[t] != 0U) {
+
+                        if (const auto bits = neighbours(frontier, tiles, t, tiles.tile_coord(t)) & unvisited[t]; bits != 0U) {
+
+                                 next[t]  =  bits;
+                            unvisited[t] &= ~bits;
+                              visited[t] |=  bits;
+
+                            if (plane != 0U) {
+                                depths[plane - 1U][t] |= bits;
+                            }
+
+                            next_tiles.emplace_back(t);
+                        }
+                    }
+                }
+
+                if (test(visited, target_position)) {
+                    return backtrack(tiles, depths, visited, root, target, level, _params);
+                }
+
+                // Replace the frontier with the new wavefront:
+                for (const auto t : curr_tiles) {
+                    frontier[t] = 0U;
+                }
+
+                for (const auto t : next_tiles) {
+                    frontier[t] = next[t];
+                        next[t] = 0U;
+                }
+
+                std::swap(curr_tiles, next_tiles);
+            }
+
+            return std::vector<coord_t>{};
+        }
+    };
+
+    /**
+     * @}
+     * @}
+     * @}
+     */
+
+} //chdr::solvers
+
+#endif //CHDR_BIT_BFS_HPP
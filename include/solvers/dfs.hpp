@@ -75,7 +75,7 @@ namespace chdr::solvers {
         using     node = unmanaged_node<index_t>;
 
         template <typename open_set_t, typename closed_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto s = utils::to_1d(_params.start, _params.size);
             const auto e = utils::to_1d(_params.end,   _params.size);
@@ -91,6 +91,8 @@ namespace chdr::solvers {
 
                 if (curr.m_index != e) { // SEARCH FOR SOLUTION...
 
+                    _monitor.expand();
+
                     node* RESTRICT curr_ptr(nullptr);
 
                     for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
@@ -100,12 +102,14 @@ namespace chdr::solvers {
                             // Check if node is not already visited:
                             if (!_closed.contains(n.index)) {
                                 solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                _monitor.close();
 
                                 if (curr_ptr == nullptr) {
                                     curr_ptr = new (_params.monotonic_pmr->allocate(sizeof(node), alignof(node))) node(std::move(curr));
                                 }
 
                                 _open.emplace(n.index, curr_ptr);
+                                _monitor.generate(_open.size());
                             }
                         }
                     }
@@ -122,7 +126,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -131,7 +135,7 @@ namespace chdr::solvers {
 
             stack<node> open(_params.heterogeneous_pmr);
 
-            return solve_internal(open, closed, capacity, _params);
+            return solve_internal(open, closed, capacity, _params, _monitor);
         }
     };
 
@@ -14,6 +14,8 @@
  */
 
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <vector>
 
 #include "base/solver.hpp"
@@ -140,90 +142,322 @@ namespace chdr::solvers {
                 m_data.reserve(_capacity);
             }
 
+            /**
+             * @brief Retrieves the path from a node to the source.
+             * @param _coord Coordinate of the node.
+             * @return The path, beginning at `_coord` and ending at the source. Empty if the node was not reached.
+             */
             HOT auto get(coord_t _coord) const {
 
                 std::vector<coord_t> result;
+                get(_coord, std::back_inserter(result));
 
-                if (const auto search = m_data.find(static_cast<index_t>(utils::to_1d(_coord, m_size))); search != m_data.end()) {
+                return result;
+            }
 
-                    result.emplace_back(_coord);
+            /**
+             * @brief Writes the path from a node to the source into a caller-provided range, without allocating.
+             * @param _coord Coordinate of the node.
+             * @param [out] _out The beginning of the destination range.
+             * @return Output iterator to the element past the last element written.
+             */
+            template <typename OutputIt>
+            HOT OutputIt get(coord_t _coord, OutputIt _out) const {
+
+                return write(static_cast<index_t>(utils::to_1d(_coord, m_size)), _out, [this](index_t _index) ALWAYS_INLINE {
+                    return utils::to_nd(_index, m_size);
+                });
+            }
+
+            /**
+             * @brief Writes the node indices of the path from a node to the source into a caller-provided range.
+             * @param _index Index of the node.
+             * @param [out] _out The beginning of the destination range.
+             * @return Output iterator to the element past the last element written.
+             */
+            template <typename OutputIt>
+            HOT OutputIt indices(index_t _index, OutputIt _out) const {
+                return write(_index, _out, [](index_t _i) ALWAYS_INLINE { return _i; });
+            }
+
+            /**
+             * @brief Whether a node was reached by the search.
+             * @param _index Index of the node.
+             */
+            [[nodiscard]] HOT bool contains(index_t _index) const {
+                return m_data.find(_index) != m_data.end();
+            }
+
+        private:
+
+            template <typename OutputIt, typename transform_t>
+            HOT OutputIt write(index_t _index, OutputIt _out, transform_t&& _transform) const {
+
+                if (const auto search = m_data.find(_index); search != m_data.end()) {
+
+                    *_out = _transform(_index);
+                    ++_out;
 
                     for (const auto* RESTRICT t = search->second.m_parent; t != nullptr; t = t->m_parent) {
-                        result.emplace_back(utils::to_nd(t->m_index, m_size));
+                        *_out = _transform(t->m_index);
+                        ++_out;
                     }
                 }
 
-                return result;
+                return _out;
             }
         };
 
-        template <typename open_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
+
+            context ctx(_params);
+            static_cast<void>(ctx.advance(std::numeric_limits<size_t>::max(), _monitor));
+
+            return ctx.path();
+        }
+
+    public:
 
-            const auto e = utils::to_1d(_params.end, _params.size);
+        /**
+         * @class context
+         * @brief A resumable Dijkstra search.
+         *
+         * @details Holds the complete state of a search (open set and shortest-path tree) between calls to `step()`,
+         *          allowing a search to be amortised over several frames. A context may be resumed on any thread,
+         *          provided that calls to `step()` are not made concurrently.\n\n
+         *
+         *          The shortest-path tree is grown from `params_t::end` until the search space is exhausted. The path
+         *          from `params_t::start` may then be retrieved as a vector using `path()`, or written into a
+         *          caller-provided buffer using `path(OutputIt)` or `indices(OutputIt)`, which do not allocate.
+         *
+         * @code
+         *
+         * chdr::solvers::dijkstra<params>::context ctx(args);
+         *
+         * while (ctx.step(1000U) == chdr::solvers::search_status::in_progress) {
+         *     ... // Do other work.
+         * }
+         *
+         * const auto& path = ctx.path();
+         *
+         * @endcode
+         *
+         * @warning The parameters, maze and memory resources must outlive the context. Unlike `solver::solve()`, the
+         *          memory resources are not reset when the search completes.
+         */
+        class context final {
 
-            _open.emplace_nosort(e, static_cast<scalar_t>(0));
+            friend dijkstra;
 
-            multi_result result(_params.size, _params.capacity);
+            const params_t& m_params;
 
-            // Main loop:
-            while (LIKELY(!_open.empty())) {
+            monitor<params_t> m_monitor;
 
-                auto _ = std::move(_open.top());
-                _open.pop();
+            heap<node>   m_open;
+            multi_result m_result;
 
-                auto& curr = result.m_data.emplace(_.m_index, std::move(_)).first->second;
+            index_t m_s;
 
-                for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
+            search_status m_status;
 
-                    if (const auto& n = solver_t::get_data(n_data, _params); n.active) {
+            template <typename monitor_t>
+            [[nodiscard]] HOT search_status advance(size_t _max_expansions, monitor_t& _monitor) {
 
-                        auto g = curr.m_gScore + n.distance;
+                // Main loop:
+                for (size_t expansions = 0U; LIKELY(expansions < _max_expansions);) {
+
+                    if (UNLIKELY(m_open.empty())) {
+
+                        if (const auto goal = m_result.m_data.find(m_s); goal != m_result.m_data.end()) {
+                            _monitor.reach(goal->second.m_gScore);
+                            return m_status = search_status::found;
+                        }
+
+                        return m_status = search_status::failed;
+                    }
+
+                    auto _ = std::move(m_open.top());
+                    m_open.pop();
+
+                    const auto [entry, inserted] = m_result.m_data.emplace(_.m_index, std::move(_));
+
+                    // Skip nodes which have already been settled:
+                    if (!inserted) {
+                        continue;
+                    }
 
-                        if (const auto search = result.m_data.find(n.index); search != result.m_data.end()) {
+                    auto& curr = entry->second;
 
-                            if (auto& child = search->second; g < child.m_gScore) {
+                    _monitor.expand();
+                    ++expansions;
 
-                                child.m_gScore = g;
-                                child.m_parent = &curr;
+                    for (const auto& n_data : m_params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
 
+                        if (const auto& n = solver_t::get_data(n_data, m_params); n.active) {
+
+                            auto g = curr.m_gScore + n.distance;
+
+                            if (const auto search = m_result.m_data.find(n.index); search != m_result.m_data.end()) {
+
+                                if (auto& child = search->second; g < child.m_gScore) {
+
+                                    child.m_gScore = g;
+                                    child.m_parent = &curr;
+
+                                    if constexpr (params_t::lazy_sorting::value) {
+                                        m_open.emplace_nosort(child);
+                                    }
+                                    else {
+                                        m_open.emplace(child);
+                                    }
+
+                                    _monitor.generate(m_open.size());
+                                }
+                            }
+                            else {
                                 if constexpr (params_t::lazy_sorting::value) {
-                                    _open.emplace_nosort(child);
+                                    m_open.emplace_nosort(n.index, g, &curr);
                                 }
                                 else {
-                                    _open.emplace(child);
+                                    m_open.emplace(n.index, g, &curr);
                                 }
-                            }
-                        }
-                        else {
-                            if constexpr (params_t::lazy_sorting::value) {
-                                _open.emplace_nosort(n.index, g, &curr);
-                            }
-                            else {
-                                _open.emplace(n.index, g, &curr);
+
+                                _monitor.generate(m_open.size());
                             }
                         }
                     }
                 }
+
+                return m_status;
             }
 
-            // TODO: return multi_result instead of std::vector<coord_t>.
-            return result.get(_params.start);
-        }
+        public:
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+            /**
+             * @name Constructors
+             * @{
+             */
 
-            const auto capacity = solver_t::solver_utils::determine_capacity(_params);
+            /**
+             * @brief Begins a search.
+             * @param [in] _params The parameters of the search. Must outlive the context.
+             */
+            [[nodiscard]] explicit context(const params_t& _params) :
+                m_params (_params),
+                m_monitor(_params),
+                m_open   (_params.heterogeneous_pmr),
+                m_result (_params.size, _params.capacity),
+                m_s      (static_cast<index_t>(utils::to_1d(_params.start, _params.size))),
+                m_status (search_status::in_progress)
+            {
+                const auto e = static_cast<index_t>(utils::to_1d(_params.end, _params.size));
+
+                if (!_params.maze.contains(m_s) || !_params.maze[m_s].is_active() ||
+                    !_params.maze.contains(e) || !_params.maze[e].is_active()
+                ) {
+                    m_status = search_status::failed;
+                }
+                else {
+                    try {
+                        m_open.reserve(solver_t::solver_utils::determine_capacity(_params) / 8U);
+                    }
+                    catch (...) {} // NOLINT(*-empty-catch)
 
-            heap<node> open(_params.heterogeneous_pmr);
-            try {
-                open.reserve(capacity / 8U);
+                    m_open.emplace_nosort(e, static_cast<scalar_t>(0));
+                }
             }
-            catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, _params);
-        }
+            ~context() = default;
+
+            context           (const context&) = delete;
+            context& operator=(const context&) = delete;
+            context           (context&&)      = delete;
+            context& operator=(context&&)      = delete;
+
+            /**
+             * @}
+             */
 
+            /**
+             * @brief Advances the search.
+             *
+             * @param _max_expansions Maximum number of nodes to expand before returning. (optional)
+             *
+             * @return `search_status::in_progress` if the search is incomplete. Otherwise, the final status of the search.
+             */
+            [[maybe_unused]] HOT search_status step(size_t _max_expansions = std::numeric_limits<size_t>::max()) {
+
+                if (m_status == search_status::in_progress) {
+                    try {
+                        static_cast<void>(advance(_max_expansions, m_monitor));
+                    }
+                    catch (const budget_exhausted&) {
+                        m_status = search_status::exhausted;
+                    }
+                }
+
+                return m_status;
+            }
+
+            /**
+             * @brief Status of the search.
+             */
+            [[maybe_unused, nodiscard]] constexpr search_status status() const noexcept { return m_status; }
+
+            /**
+             * @brief The resulting path. Empty unless the search has completed successfully.
+             *
+             * @see path(OutputIt)
+             */
+            [[maybe_unused, nodiscard]] std::vector<coord_t> path() const {
+                return m_status == search_status::found ? m_result.get(m_params.start) : std::vector<coord_t>{};
+            }
+
+            /**
+             * @brief Writes the resulting path into a caller-provided range, without allocating.
+             *
+             * @details Nothing is written unless the search has completed successfully. The path is written in the
+             *          same order as returned by `path()`.
+             *
+             * @param [out] _out The beginning of the destination range, i.e. a pointer into a buffer of sufficient size.
+             *
+             * @return Output iterator to the element past the last element written.
+             */
+            template <typename OutputIt>
+            [[maybe_unused]] OutputIt path(OutputIt _out) const {
+                return m_status == search_status::found ? m_result.get(m_params.start, _out) : _out;
+            }
+
+            /**
+             * @brief Writes the node indices of the resulting path into a caller-provided range, without allocating.
+             *
+             * @details Equivalent to `path(OutputIt)`, but skips the conversion of each index into a coordinate.
+             *
+             * @param [out] _out The beginning of the destination range, i.e. a pointer into a buffer of sufficient size.
+             *
+             * @return Output iterator to the element past the last element written.
+             */
+            template <typename OutputIt>
+            [[maybe_unused]] OutputIt indices(OutputIt _out) const {
+                return m_status == search_status::found ? m_result.indices(m_s, _out) : _out;
+            }
+
+            /**
+             * @brief Encodes the resulting path into a compact path container, such as `rle_path` or `waypoint_path`.
+             *
+             * @details Coordinates are pushed to `_path` while walking the shortest-path tree, so that no intermediate
+             *          coordinate vector is built. The encoded path has the same order as `path()`.
+             *
+             * @param [out] _path The container to encode the path into. It is cleared before encoding.
+             */
+            template <typename path_t>
+            [[maybe_unused]] void encode(path_t& _path) const {
+
+                _path.clear();
+
+                static_cast<void>(path(std::back_inserter(_path)));
+            }
+        };
     };
 
     /**
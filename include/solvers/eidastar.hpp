@@ -130,7 +130,7 @@ namespace chdr::solvers {
         using transposition_table_t = std::pmr::unordered_map<index_t, scalar_t>;
 
         template <typename open_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params, monitor<params_t>& _monitor) {
 
             using neighbours_t = decltype(_params.maze.template get_neighbours<params_t::octile_neighbours::value>(std::declval<index_t>()));
             constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
@@ -175,8 +175,10 @@ namespace chdr::solvers {
                                     transposition_table[n.index] = f;
 
                                     _open.emplace_back(n.index, g, f);
+                                    _monitor.generate(_open.size());
 
                                     if (n.index != e) { // SEARCH FOR SOLUTION...
+                                        _monitor.expand();
                                         stack.emplace(_open.back(), _params);
                                     }
                                     else { // SOLUTION REACHED...
@@ -184,6 +186,8 @@ namespace chdr::solvers {
                                         // ReSharper disable once CppDFAUnusedValue
                                         transposition_table = {};
 
+                                        _monitor.reach(_open.back().m_gScore);
+
                                         if constexpr (params_t::reverse_equivalence::value) {
                                             return solver_t::solver_utils::ibacktrack(_open, _params.size);
                                         }
@@ -220,7 +224,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -230,7 +234,7 @@ namespace chdr::solvers {
             }
             catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, _params);
+            return solve_internal(open, _params, _monitor);
         }
     };
 
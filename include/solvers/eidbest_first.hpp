@@ -123,7 +123,7 @@ namespace chdr::solvers {
         using transposition_table_t = std::pmr::unordered_map<index_t, scalar_t>;
 
         template <typename open_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params, monitor<params_t>& _monitor) {
 
             using neighbours_t = decltype(_params.maze.template get_neighbours<params_t::octile_neighbours::value>(std::declval<index_t>()));
 
@@ -164,8 +164,10 @@ namespace chdr::solvers {
                                     transposition_table[n.index] = h;
 
                                     _open.emplace_back(n.index, h);
+                                    _monitor.generate(_open.size());
 
                                     if (n.index != e) { // SEARCH FOR SOLUTION...
+                                        _monitor.expand();
                                         stack.emplace(_open.back(), _params);
                                     }
                                     else { // SOLUTION REACHED...
@@ -204,7 +206,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -214,7 +216,7 @@ namespace chdr::solvers {
             }
             catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, _params);
+            return solve_internal(open, _params, _monitor);
         }
     };
 
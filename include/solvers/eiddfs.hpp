@@ -118,7 +118,7 @@ namespace chdr::solvers {
         };
 
         template <typename open_set_t, typename closed_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params, monitor<params_t>& _monitor) {
 
             using neighbours_t = decltype(_params.maze.template get_neighbours<params_t::octile_neighbours::value>(std::declval<index_t>()));
 
@@ -127,45 +127,49 @@ namespace chdr::solvers {
 
             _open.emplace_back(s, 0U);
 
-            stack<state<neighbours_t>> stack(_params.monotonic_pmr);
-
             for (size_t bound = 0U; bound < std::numeric_limits<size_t>::max(); ++bound) {
+                { // The stack must release its memory before the pool is reset:
+                    stack<state<neighbours_t>> stack(_params.monotonic_pmr);
 
-                stack.emplace(_open.back(), _params);
+                    stack.emplace(_open.back(), _params);
 
-                // Main loop:
-                while (!stack.empty()) {
+                    // Main loop:
+                    while (!stack.empty()) {
 
-                    auto& _    = stack.top();
-                    auto& curr = _open.back();
+                        auto& _    = stack.top();
+                        auto& curr = _open.back();
 
-                    if (curr.m_depth <= bound && static_cast<size_t>(_.neighbours_idx) != _.neighbours.size()) {
+                        if (curr.m_depth <= bound && static_cast<size_t>(_.neighbours_idx) != _.neighbours.size()) {
 
-                        if (const auto& n = solver_t::get_data(_.neighbours[(_.neighbours.size() - 1U) - (_.neighbours_idx++)], _params); n.active) {
+                            if (const auto& n = solver_t::get_data(_.neighbours[(_.neighbours.size() - 1U) - (_.neighbours_idx++)], _params); n.active) {
 
-                            if (!_closed.contains(n.index)) {
-                                solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                if (!_closed.contains(n.index)) {
+                                    solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                    _monitor.close();
 
-                                _open.emplace_back(n.index, curr.m_depth + 1U);
+                                    _open.emplace_back(n.index, curr.m_depth + 1U);
+                                    _monitor.generate(_open.size());
 
-                                if (n.index != e) { // SEARCH FOR SOLUTION...
-                                    stack.emplace(_open.back(), _params);
-                                }
-                                else { // SOLUTION REACHED...
+                                    if (n.index != e) { // SEARCH FOR SOLUTION...
+                                        _monitor.expand();
+                                        stack.emplace(_open.back(), _params);
+                                    }
+                                    else { // SOLUTION REACHED...
 
-                                    _closed = closed_set_t{};
+                                        _closed = closed_set_t{};
 
-                                    return solver_t::solver_utils::ibacktrack(_open, _params.size);
+                                        return solver_t::solver_utils::ibacktrack(_open, _params.size);
+                                    }
                                 }
                             }
                         }
-                    }
-                    else {
-                        if (_open.size() > 1U) {
-                            _open.pop_back();
+                        else {
+                            if (_open.size() > 1U) {
+                                _open.pop_back();
+                            }
+                            stack.pop();
+                            _closed.erase(curr.m_index);
                         }
-                        stack.pop();
-                        _closed.erase(curr.m_index);
                     }
                 }
 
@@ -177,7 +181,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -190,7 +194,7 @@ namespace chdr::solvers {
             }
             catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, closed, capacity, _params);
+            return solve_internal(open, closed, capacity, _params, _monitor);
         }
     };
 
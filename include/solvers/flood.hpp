@@ -69,7 +69,7 @@ namespace chdr::solvers {
         using solver_t = solver<flood, params_t>;
 
         template <typename open_set_t, typename closed_set_t>
-        [[nodiscard]] HOT static constexpr bool solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr bool solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto s = utils::to_1d(_params.start, _params.size);
             const auto e = utils::to_1d(_params.end,   _params.size);
@@ -87,6 +87,8 @@ namespace chdr::solvers {
 
                     if (curr != e) { // SEARCH FOR SOLUTION...
 
+                        _monitor.expand();
+
                         for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr)) {
 
                             if (const auto& n = solver_t::get_data(n_data, _params); n.active) {
@@ -94,8 +96,10 @@ namespace chdr::solvers {
                                 // Check if node is not already visited:
                                 if (!_closed.contains(n.index)) {
                                     solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                    _monitor.close();
 
                                     _open.emplace(n.index);
+                                    _monitor.generate(_open.size());
                                 }
                             }
                         }
@@ -111,7 +115,7 @@ namespace chdr::solvers {
 
     public:
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto s = static_cast<index_t>(utils::to_1d(_params.start, _params.size));
             const auto e = static_cast<index_t>(utils::to_1d(_params.end,   _params.size));
@@ -131,7 +135,7 @@ namespace chdr::solvers {
 
                     queue<index_t> open(_params.heterogeneous_pmr);
 
-                    success = solve_internal(open, closed, capacity, _params);
+                    success = solve_internal(open, closed, capacity, _params, _monitor);
                 }
 
                 if (success) {
@@ -117,7 +117,7 @@ namespace chdr::solvers {
         };
 
         template <typename open_set_t, typename closed_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, open_set_t& _next, closed_set_t& _closed, size_t _capacity, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, open_set_t& _next, closed_set_t& _closed, size_t _capacity, const params_t& _params, monitor<params_t>& _monitor) {
             constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
 
             const auto&   end = do_reverse ? _params.start : _params.end;
@@ -140,6 +140,8 @@ namespace chdr::solvers {
 
                     if (curr.m_index != e) { // SEARCH FOR SOLUTION...
 
+                        _monitor.expand();
+
                         node* RESTRICT curr_ptr(nullptr);
 
                         for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
@@ -155,6 +157,7 @@ namespace chdr::solvers {
                                     if (!_closed.contains(n.index)) {
 
                                         solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                        _monitor.close();
 
                                         if (curr_ptr == nullptr) {
                                             curr_ptr = new (_params.monotonic_pmr->allocate(sizeof(node), alignof(node))) node(std::move(curr));
@@ -179,6 +182,8 @@ namespace chdr::solvers {
                                                 node (n.index, g, f, curr_ptr)
                                             );
                                         }
+
+                                        _monitor.generate(_next.size());
                                     }
                                 }
                                 else {
@@ -193,6 +198,8 @@ namespace chdr::solvers {
                         _next   = std::move(open_set_t());
                         _closed = closed_set_t{};
 
+                        _monitor.reach(curr.m_gScore);
+
                         if constexpr (params_t::reverse_equivalence::value) {
                             return solver_t::solver_utils::rbacktrack(curr, _params.size, static_cast<size_t>(curr.m_gScore));
                         }
@@ -213,7 +220,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -232,7 +239,7 @@ namespace chdr::solvers {
             }
             catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, next, closed, capacity, _params);
+            return solve_internal(open, next, closed, capacity, _params, _monitor);
         }
     };
 
@@ -69,7 +69,7 @@ namespace chdr::solvers {
         using     node = managed_node<index_t>;
 
         template <typename open_set_t, typename closed_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params, monitor<params_t>& _monitor) {
             constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
 
             const auto&   end = do_reverse ? _params.start : _params.end;
@@ -89,6 +89,8 @@ namespace chdr::solvers {
 
                 if (curr.m_index != e) { // SEARCH FOR SOLUTION...
 
+                    _monitor.expand();
+
                     node* RESTRICT curr_ptr(nullptr);
 
                     for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
@@ -98,12 +100,14 @@ namespace chdr::solvers {
                             // Check if node is not already visited:
                             if (!_closed.contains(n.index)) {
                                 solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                _monitor.close();
 
                                 if (curr_ptr == nullptr) {
                                     curr_ptr = new (_params.homogeneous_pmr->allocate(sizeof(node), alignof(node))) node(std::move(curr));
                                 }
 
                                 _open.emplace(n.index, curr_ptr);
+                                _monitor.generate(_open.size());
                             }
                         }
                     }
@@ -129,7 +133,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -138,7 +142,7 @@ namespace chdr::solvers {
 
             queue<node> open(_params.heterogeneous_pmr);
 
-            return solve_internal(open, closed, capacity, _params);
+            return solve_internal(open, closed, capacity, _params, _monitor);
         }
     };
 
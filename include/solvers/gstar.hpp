@@ -14,6 +14,10 @@
  */
 
 #include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include "../solvers/base/managed_node.hpp"
 #include "../types/containers/existence_set.hpp"
@@ -115,92 +119,315 @@ namespace chdr::solvers {
             }
         };
 
-        template <typename open_set_t, typename closed_set_t>
-        [[maybe_unused, nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params) {
-            constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
-            const auto&   end = do_reverse ? _params.start : _params.end;
-            const auto& start = do_reverse ? _params.end   : _params.start;
+            context ctx(_params);
+            static_cast<void>(ctx.advance(std::numeric_limits<size_t>::max(), _monitor));
 
-            const auto s = utils::to_1d(start, _params.size);
-            const auto e = utils::to_1d(end,   _params.size);
+            return ctx.path();
+        }
 
-              _open.emplace_nosort(s, static_cast<scalar_t>(0), _params.h(start, end) * _params.weight);
-            _closed.emplace(s);
+    public:
+
+        /**
+         * @class context
+         * @brief A resumable G* search.
+         *
+         * @details Holds the complete state of a search (open set, closed set and nodes) between calls to `step()`,
+         *          allowing a search to be amortised over several frames. A context may be resumed on any thread,
+         *          provided that calls to `step()` are not made concurrently.\n\n
+         *
+         *          Once complete, the path may be retrieved as a vector using `path()`, or written into a caller-provided
+         *          buffer using `path(OutputIt)` or `indices(OutputIt)`, which do not allocate.
+         *
+         * @code
+         *
+         * chdr::solvers::gstar<params>::context ctx(args);
+         *
+         * while (ctx.step(1000U) == chdr::solvers::search_status::in_progress) {
+         *     ... // Do other work.
+         * }
+         *
+         * const auto& path = ctx.path();
+         *
+         * @endcode
+         *
+         * @warning The parameters, maze and memory resources must outlive the context. Unlike `solver::solve()`, the
+         *          memory resources are not reset when the search completes.
+         */
+        class context final {
+
+            friend gstar;
+
+            const params_t& m_params;
+
+            monitor<params_t> m_monitor;
+
+            size_t m_capacity;
+            index_t m_e;
+
+            existence_set<> m_closed;
+            heap<node>      m_open;
+
+            search_status m_status;
+            node m_goal;
+
+            template <typename monitor_t>
+            [[nodiscard]] HOT search_status advance(size_t _max_expansions, monitor_t& _monitor) {
+
+                constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(m_params.maze)> && params_t::reverse_equivalence::value;
+
+                const auto& end = do_reverse ? m_params.start : m_params.end;
+
+                // Main loop:
+                for (size_t expansions = 0U; LIKELY(expansions < _max_expansions);) {
+
+                    if (UNLIKELY(m_open.empty())) {
+                        return m_status = search_status::failed;
+                    }
 
-            // Main loop:
-            while (LIKELY(!_open.empty())) {
+                    auto curr(std::move(m_open.top()));
+                    m_open.pop();
 
-                auto curr(std::move(_open.top()));
-                _open.pop();
+                    if (curr.m_index != m_e) { // SEARCH FOR SOLUTION...
 
-                if (curr.m_index != e) { // SEARCH FOR SOLUTION...
+                        _monitor.expand();
+                        ++expansions;
 
-                    node* RESTRICT curr_ptr(nullptr);
+                        node* RESTRICT curr_ptr(nullptr);
 
-                    for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
+                        for (const auto& n_data : m_params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
 
-                        if (const auto& n = solver_t::get_data(n_data, _params); n.active) {
+                            if (const auto& n = solver_t::get_data(n_data, m_params); n.active) {
 
-                            // Check if node is not already visited:
-                            if (!_closed.contains(n.index)) {
-                                solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                // Check if node is not already visited:
+                                if (!m_closed.contains(n.index)) {
+                                    solver_t::solver_utils::preallocate_emplace(m_closed, n.index, m_capacity, m_params.maze.count());
+                                    _monitor.close();
 
-                                if (curr_ptr == nullptr) {
-                                    curr_ptr = new (_params.homogeneous_pmr->allocate(sizeof(node), alignof(node))) node(std::move(curr));
-                                }
+                                    if (curr_ptr == nullptr) {
+                                        curr_ptr = new (m_params.homogeneous_pmr->allocate(sizeof(node), alignof(node))) node(std::move(curr));
+                                    }
 
-                                if constexpr (params_t::lazy_sorting::value) {
-                                    _open.emplace_nosort(n.index, curr_ptr->m_gScore + n.distance, _params.h(n.coord, end) * _params.weight, curr_ptr);
-                                }
-                                else {
-                                    _open.emplace(n.index, curr_ptr->m_gScore + n.distance, _params.h(n.coord, end) * _params.weight, curr_ptr);
+                                    if constexpr (params_t::lazy_sorting::value) {
+                                        m_open.emplace_nosort(n.index, curr_ptr->m_gScore + n.distance, m_params.h(n.coord, end) * m_params.weight, curr_ptr);
+                                    }
+                                    else {
+                                        m_open.emplace(n.index, curr_ptr->m_gScore + n.distance, m_params.h(n.coord, end) * m_params.weight, curr_ptr);
+                                    }
+
+                                    _monitor.generate(m_open.size());
                                 }
                             }
                         }
+
+                        if (curr_ptr == nullptr) {
+                            curr.expunge(m_params.homogeneous_pmr);
+                        }
                     }
+                    else { // SOLUTION REACHED...
+
+                        m_open.wipe();
+                        m_closed = existence_set<>{};
+
+                        _monitor.reach(curr.m_gScore);
+                        m_goal = std::move(curr);
 
-                    if (curr_ptr == nullptr) {
-                        curr.expunge(_params.homogeneous_pmr);
+                        return m_status = search_status::found;
                     }
                 }
-                else { // SOLUTION REACHED...
 
-                    if constexpr (std::is_same_v<std::decay_t<decltype(_open)>, heap<node>>) {
-                        _open.wipe();
+                return m_status;
+            }
+
+            template <bool Reverse = params_t::reverse_equivalence::value, typename OutputIt, typename transform_t>
+            HOT OutputIt write(OutputIt _out, transform_t&& _transform) const {
+
+                if (m_status == search_status::found) {
+
+                    if (m_goal.m_parent == nullptr) { // Start and end are the same node.
+                        *_out = _transform(m_goal.m_index);
+                        ++_out;
+                    }
+                    else if constexpr (Reverse) {
+                        _out = solver_t::solver_utils::rbacktrack_into(m_goal, _out, std::forward<transform_t>(_transform));
                     }
                     else {
-                        _open = open_set_t{};
+                        _out = solver_t::solver_utils::rbacktrack_noreverse_into(m_goal, _out, std::forward<transform_t>(_transform));
                     }
-                    _closed = closed_set_t{};
+                }
+
+                return _out;
+            }
+
+        public:
 
-                    if constexpr (params_t::reverse_equivalence::value) {
-                        return solver_t::solver_utils::rbacktrack(curr, _params.size, static_cast<size_t>(curr.m_gScore));
+            /**
+             * @name Constructors
+             * @{
+             */
+
+            /**
+             * @brief Begins a search.
+             * @param [in] _params The parameters of the search. Must outlive the context.
+             */
+            [[nodiscard]] explicit context(const params_t& _params) :
+                m_params  (_params),
+                m_monitor (_params),
+                m_capacity(solver_t::solver_utils::determine_capacity(_params)),
+                m_e       (0U),
+                m_closed  (_params.monotonic_pmr),
+                m_open    (_params.heterogeneous_pmr),
+                m_status  (search_status::in_progress),
+                m_goal    ()
+            {
+                constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
+
+                const auto&   end = do_reverse ? _params.start : _params.end;
+                const auto& start = do_reverse ? _params.end   : _params.start;
+
+                const auto s = static_cast<index_t>(utils::to_1d(start, _params.size));
+                m_e          = static_cast<index_t>(utils::to_1d(end,   _params.size));
+
+                if (!_params.maze.contains(s) || !_params.maze[s].is_active() ||
+                    !_params.maze.contains(m_e) || !_params.maze[m_e].is_active()
+                ) {
+                    m_status = search_status::failed;
+                }
+                else if (s == m_e) {
+                    m_goal   = node(m_e, static_cast<scalar_t>(0), static_cast<scalar_t>(0));
+                    m_status = search_status::found;
+                }
+                else {
+                    m_closed.reserve(m_capacity);
+
+                    try {
+                        m_open.reserve(m_capacity / 8U);
                     }
-                    else {
-                        return solver_t::solver_utils::rbacktrack_noreverse(curr, _params.size, static_cast<size_t>(curr.m_gScore));
+                    catch (...) {} // NOLINT(*-empty-catch)
+
+                    m_open.emplace_nosort(s, static_cast<scalar_t>(0), _params.h(start, end) * _params.weight);
+                    m_closed.emplace(s);
+                }
+            }
+
+            ~context() = default;
+
+            context           (const context&) = delete;
+            context& operator=(const context&) = delete;
+            context           (context&&)      = delete;
+            context& operator=(context&&)      = delete;
+
+            /**
+             * @}
+             */
+
+            /**
+             * @brief Advances the search.
+             *
+             * @param _max_expansions Maximum number of nodes to expand before returning. (optional)
+             *
+             * @return `search_status::in_progress` if the search is incomplete. Otherwise, the final status of the search.
+             */
+            [[maybe_unused]] HOT search_status step(size_t _max_expansions = std::numeric_limits<size_t>::max()) {
+
+                if (m_status == search_status::in_progress) {
+                    try {
+                        static_cast<void>(advance(_max_expansions, m_monitor));
+                    }
+                    catch (const budget_exhausted&) {
+                        m_status = search_status::exhausted;
                     }
                 }
+
+                return m_status;
             }
 
-            return std::vector<coord_t>{};
-        }
+            /**
+             * @brief Status of the search.
+             */
+            [[maybe_unused, nodiscard]] constexpr search_status status() const noexcept { return m_status; }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+            /**
+             * @brief The resulting path. Empty unless the search has completed successfully.
+             *
+             * @see path(OutputIt)
+             */
+            [[maybe_unused, nodiscard]] std::vector<coord_t> path() const {
 
-            const auto capacity = solver_t::solver_utils::determine_capacity(_params);
+                std::vector<coord_t> result{};
 
-            existence_set closed(_params.monotonic_pmr);
-            closed.reserve(capacity);
+                if (m_status == search_status::found) {
 
-            heap<node> open(_params.heterogeneous_pmr);
-            try {
-                open.reserve(capacity / 8U);
+                    if (m_goal.m_parent == nullptr) {
+                        result.emplace_back(m_params.end);
+                    }
+                    else if constexpr (params_t::reverse_equivalence::value) {
+                        result = solver_t::solver_utils::rbacktrack(m_goal, m_params.size, static_cast<size_t>(m_goal.m_gScore));
+                    }
+                    else {
+                        result = solver_t::solver_utils::rbacktrack_noreverse(m_goal, m_params.size, static_cast<size_t>(m_goal.m_gScore));
+                    }
+                }
+
+                return result;
             }
-            catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, closed, capacity, _params);
-        }
+            /**
+             * @brief Writes the resulting path into a caller-provided range, without allocating.
+             *
+             * @details Nothing is written unless the search has completed successfully. The path is written in the
+             *          same order as returned by `path()`. If `params_t::reverse_equivalence` is enabled, the path is
+             *          reversed in place after being written, so `_out` must be a bidirectional iterator.
+             *
+             * @param [out] _out The beginning of the destination range, i.e. a pointer into a buffer of sufficient size.
+             *
+             * @return Output iterator to the element past the last element written.
+             */
+            template <typename OutputIt>
+            [[maybe_unused]] OutputIt path(OutputIt _out) const {
+
+                return write(_out, [this](index_t _index) ALWAYS_INLINE {
+                    return utils::to_nd(static_cast<typename coord_t::value_type>(_index), m_params.size);
+                });
+            }
+
+            /**
+             * @brief Writes the node indices of the resulting path into a caller-provided range, without allocating.
+             *
+             * @details Equivalent to `path(OutputIt)`, but skips the conversion of each index into a coordinate.
+             *
+             * @param [out] _out The beginning of the destination range, i.e. a pointer into a buffer of sufficient size.
+             *
+             * @return Output iterator to the element past the last element written.
+             */
+            template <typename OutputIt>
+            [[maybe_unused]] OutputIt indices(OutputIt _out) const {
+                return write(_out, [](index_t _index) ALWAYS_INLINE { return _index; });
+            }
+
+            /**
+             * @brief Encodes the resulting path into a compact path container, such as `rle_path` or `waypoint_path`.
+             *
+             * @details Coordinates are pushed to `_path` while walking the search tree, so that no intermediate
+             *          coordinate vector is built. The encoded path has the same order as `path()`.
+             *
+             * @param [out] _path The container to encode the path into. It is cleared before encoding.
+             */
+            template <typename path_t>
+            [[maybe_unused]] void encode(path_t& _path) const {
+
+                _path.clear();
+
+                static_cast<void>(write<false>(std::back_inserter(_path), [this](index_t _index) ALWAYS_INLINE {
+                    return utils::to_nd(static_cast<typename coord_t::value_type>(_index), m_params.size);
+                }));
+
+                if constexpr (params_t::reverse_equivalence::value) {
+                    _path.reverse();
+                }
+            }
+        };
     };
 
     /**
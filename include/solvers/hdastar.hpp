@@ -0,0 +1,550 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_HDASTAR_HPP
+#define CHDR_HDASTAR_HPP
+
+/**
+ * @file hdastar.hpp
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+#include "../types/containers/heap.hpp"
+#include "../types/pmr/concurrent_pool.hpp"
+#include "../utils/utils.hpp"
+#include "base/solver.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::solvers {
+
+    /**
+     * @addtogroup Solvers
+     * @brief Graph traversal and pathfinding algorithms.
+     * @{
+     * @addtogroup Single-Target
+     * @brief Solvers which route to a single destination.
+     * @{
+     * @addtogroup SingleTargetCommon Common
+     * @brief General-purpose solvers.
+     * @{
+     */
+
+    /**
+     * @struct hdastar
+     * @brief Hash-distributed A* search algorithm.
+     * @details HDA* (Kishimoto et al., 2009) is a parallel variant of A* in which the search space is partitioned
+     *          between threads by hashing the index of each node. Every thread owns the open and closed sets of its
+     *          partition, and forwards the nodes it generates to the threads which own them, so that no shared
+     *          data structure is locked during the search.\n\n
+     *
+     *          Generated nodes are exchanged in batches through lock-free, multiple-producer single-consumer inboxes.
+     *          The cost of the best solution found so far is shared between all threads, and is used to discard nodes
+     *          which cannot improve upon it. The search terminates once every thread is idle and no batches are in
+     *          flight, at which point the path is reconstructed by following parent indices across the partitions.\n\n
+     *
+     * Advantages:
+     * - Expansions are spread between threads without contention over a shared open set.
+     * - Optimal if the heuristic is admissible, as nodes are re-opened if a cheaper route to them is found.
+     * - Partitions are private to their threads, so each may be allocated from an unsynchronised pool.
+     * - Batches are recycled through a lock-free pool, as they are created and destroyed by different threads.
+     *
+     * Limitations:
+     * - Threads must be started and joined for every search, so small searches are faster with `astar`.
+     * - Expands more nodes than A*, as threads expand nodes which are not yet known to be suboptimal.
+     * - Memory consumption is higher than A*, as the parent of every generated node must be retained.
+     * - Has not yet been measured to outperform `astar` on any grid, so is not offered by `chdr::solve()` or
+     *   `select()`. It may only be used directly, as `solver<hdastar, params_t>`.
+     *
+     * Further Reading:
+     * - <a href="https://en.wikipedia.org/wiki/A*_search_algorithm">Wikipedia Article (A*)</a>
+     *
+     * References:
+     * - Kishimoto, A., Fukunaga, A. and Botea, A., 2009. Scalable, Parallel Best-First Search for Optimal Sequential
+     *   Planning. Proceedings of the International Conference on Automated Planning and Scheduling, 19 (1), 201–208.
+     *
+     * @note The number of threads is taken from the optional `threads` member of the parameters. If absent or zero,
+     *       every hardware thread is used.
+     * @note Memory resources of the parameters are not used by the workers, which allocate from private pools.
+     * @note Expansions are reported to the budget in intervals, so a budget may be overrun by up to a few hundred
+     *       expansions per thread.
+     * @tparam params_t Type containing the search parameters.
+     */
+    template<typename params_t>
+    struct [[maybe_unused]] hdastar final {
+
+        friend class solver<hdastar, params_t>;
+
+    private:
+
+        using  index_t = typename params_t:: index_type;
+        using scalar_t = typename params_t::scalar_type;
+        using  coord_t = typename params_t:: coord_type;
+        using solver_t = solver<hdastar, params_t>;
+
+        /** @brief Number of messages buffered for another thread before they are sent as a batch. */
+        static constexpr size_t s_batch_size = 64U;
+
+        /** @brief Number of times an idle thread polls its inbox before it begins to sleep between polls. */
+        static constexpr size_t s_spin_limit = 64U;
+
+        /** @brief Number of expansions made by a thread between reports to the monitor. */
+        static constexpr size_t s_report_interval = 256U;
+
+        struct node final {
+
+            index_t  m_index;
+            scalar_t m_gScore;
+            scalar_t m_fScore;
+
+            [[nodiscard]] HOT friend constexpr bool operator < (const node& _a, const node& _b) noexcept {
+                return _a.m_fScore == _b.m_fScore ?
+                       _a.m_gScore >  _b.m_gScore :
+                       _a.m_fScore >  _b.m_fScore;
+            }
+        };
+
+        /** @brief A generated node, sent to the thread which owns it. */
+        struct message final {
+
+            index_t  m_index;
+            index_t  m_parent;
+            scalar_t m_gScore;
+            scalar_t m_fScore;
+        };
+
+        struct batch final {
+
+            batch* m_next;
+            std::vector<message> m_messages;
+        };
+
+        /**
+         * @brief Lock-free, multiple-producer single-consumer stack of batches.
+         * @details Producers push with a compare-and-swap. The consumer takes every pending batch at once.
+         */
+        class alignas(64) inbox final {
+
+            std::atomic<batch*> m_head { nullptr };
+
+        public:
+
+            HOT void push(batch* _batch) noexcept {
+
+                auto* head = m_head.load(std::memory_order_relaxed);
+
+                do {
+                    _batch->m_next = head;
+                }
+                while (!m_head.compare_exchange_weak(head, _batch, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            [[nodiscard]] HOT batch* take() noexcept { return m_head.exchange(nullptr, std::memory_order_acquire); }
+
+            [[nodiscard]] HOT bool empty() const noexcept { return m_head.load(std::memory_order_relaxed) == nullptr; }
+        };
+
+        struct record final {
+
+            scalar_t m_gScore;
+            index_t  m_parent;
+        };
+
+        /** @brief Private state of a thread, i.e. the partition of the search space it owns. */
+        struct partition final {
+
+            std::pmr::unsynchronized_pool_resource m_resource;
+
+            heap<node> m_open;
+            std::pmr::unordered_map<index_t, record> m_records;
+
+            std::vector<std::vector<message>> m_outgoing;
+
+            explicit partition(size_t _threads) :
+                m_resource(),
+                m_open    (&m_resource),
+                m_records (&m_resource),
+                m_outgoing(_threads) {}
+        };
+
+        /** @brief State shared between the threads of a search. */
+        struct shared final {
+
+            const params_t& m_params;
+            monitor<params_t>& m_monitor;
+
+            const size_t m_threads;
+            const index_t m_s;
+            const index_t m_e;
+
+            /** @brief Storage for batches, which are allocated by their sender and deallocated by their receiver. */
+            concurrent_pool<> m_batches;
+
+            std::vector<inbox>     m_inboxes;
+            std::vector<std::unique_ptr<partition>> m_partitions;
+
+            /** @brief Cost of the best solution found so far. */
+            alignas(64) std::atomic<scalar_t> m_incumbent;
+
+            /** @brief Number of active threads, plus the number of batches which have been sent but not yet received. */
+            alignas(64) std::atomic<size_t> m_pending;
+
+            alignas(64) std::atomic<bool> m_stop;
+
+            std::mutex m_mutex;
+            std::exception_ptr m_exception;
+
+            shared(const params_t& _params, monitor<params_t>& _monitor, size_t _threads, index_t _s, index_t _e) :
+                m_params    (_params),
+                m_monitor   (_monitor),
+                m_threads   (_threads),
+                m_s         (_s),
+                m_e         (_e),
+                m_batches   (sizeof(batch) * s_batch_size),
+                m_inboxes   (_threads),
+                m_partitions(),
+                m_incumbent (std::numeric_limits<scalar_t>::max()),
+                m_pending   (_threads),
+                m_stop      (false),
+                m_mutex     (),
+                m_exception (nullptr)
+            {
+                m_partitions.reserve(_threads);
+
+                for (size_t i = 0U; i < _threads; ++i) {
+                    m_partitions.emplace_back(std::make_unique<partition>(_threads));
+                }
+            }
+
+            ~shared() {
+
+                // Batches left behind by an interrupted search:
+                for (auto& inbox : m_inboxes) {
+                    for (auto* b = inbox.take(); b != nullptr;) {
+                        auto* next = b->m_next;
+                        destroy(b);
+                        b = next;
+                    }
+                }
+            }
+
+            shared           (const shared&) = delete;
+            shared& operator=(const shared&) = delete;
+            shared           (shared&&)      = delete;
+            shared& operator=(shared&&)      = delete;
+
+            [[nodiscard]] HOT batch* create() {
+                return ::new (m_batches.allocate(sizeof(batch), alignof(batch))) batch { nullptr, {} };
+            }
+
+            HOT void destroy(batch* _batch) noexcept {
+                _batch->~batch();
+                m_batches.deallocate(_batch, sizeof(batch), alignof(batch));
+            }
+
+            /** @brief Index of the thread which owns a node. */
+            [[nodiscard]] HOT size_t owner(index_t _index) const noexcept {
+                return static_cast<size_t>((static_cast<uint64_t>(_index) * 0x9E3779B97F4A7C15ULL) >> 32U) % m_threads;
+            }
+
+            void fail(std::exception_ptr _exception) {
+
+                const std::lock_guard<std::mutex> lock(m_mutex);
+
+                if (m_exception == nullptr) {
+                    m_exception = _exception;
+                }
+
+                m_stop.store(true, std::memory_order_relaxed);
+            }
+        };
+
+        /** @brief Records a node in the partition which owns it, if it improves upon the best known route. */
+        HOT static void receive(partition& _partition, const message& _message) {
+
+            const auto [it, inserted] = _partition.m_records.try_emplace(_message.m_index, record { _message.m_gScore, _message.m_parent });
+
+            if (!inserted) {
+
+                if (it->second.m_gScore <= _message.m_gScore) {
+                    return;
+                }
+
+                it->second = record { _message.m_gScore, _message.m_parent };
+            }
+
+            _partition.m_open.emplace(node { _message.m_index, _message.m_gScore, _message.m_fScore });
+        }
+
+        HOT static void send(shared& _shared, size_t _destination, std::vector<message>& _messages) {
+
+            auto* b = _shared.create();
+            b->m_messages.swap(_messages);
+            _messages.reserve(s_batch_size);
+
+            _shared.m_pending.fetch_add(1U, std::memory_order_relaxed);
+            _shared.m_inboxes[_destination].push(b);
+        }
+
+        /** @brief Forwards the monitor a number of expansions made by a thread. Returns `true` if the budget was exhausted. */
+        [[nodiscard]] static bool report(shared& _shared, size_t _expanded, size_t _closed, size_t _open_size) {
+
+            const std::lock_guard<std::mutex> lock(_shared.m_mutex);
+
+            bool exhausted = false;
+
+            for (size_t i = 0U; i < _expanded; ++i) {
+                exhausted |= _shared.m_monitor.poll();
+            }
+
+            for (size_t i = 0U; i < _closed; ++i) {
+                _shared.m_monitor.close();
+            }
+
+            _shared.m_monitor.generate(_open_size);
+
+            return exhausted;
+        }
+
+        static void work(shared& _shared, size_t _thread) {
+
+            constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_shared.m_params.maze)> && params_t::reverse_equivalence::value;
+
+            const auto& params = _shared.m_params;
+            const auto& end    = do_reverse ? params.start : params.end;
+
+            auto& self = *_shared.m_partitions[_thread];
+
+            for (auto& outgoing : self.m_outgoing) {
+                outgoing.reserve(s_batch_size);
+            }
+
+            size_t expanded = 0U;
+            size_t closed   = 0U;
+
+            const auto flush = [&_shared, &self]() {
+
+                for (size_t i = 0U; i < self.m_outgoing.size(); ++i) {
+                    if (!self.m_outgoing[i].empty()) {
+                        send(_shared, i, self.m_outgoing[i]);
+                    }
+                }
+            };
+
+            const auto drain = [&_shared, &self, _thread]() {
+
+                for (auto* b = _shared.m_inboxes[_thread].take(); b != nullptr;) {
+
+                    for (const auto& m : b->m_messages) {
+
+                        if (m.m_fScore < _shared.m_incumbent.load(std::memory_order_relaxed)) {
+                            receive(self, m);
+                        }
+                    }
+
+                    auto* next = b->m_next;
+                    _shared.destroy(b);
+                    b = next;
+
+                    _shared.m_pending.fetch_sub(1U, std::memory_order_acq_rel);
+                }
+            };
+
+            while (!_shared.m_stop.load(std::memory_order_relaxed)) {
+
+                drain();
+
+                // Nodes which cannot improve upon the incumbent are discarded, which leaves the partition idle:
+                if (!self.m_open.empty() && !(self.m_open.top().m_fScore < _shared.m_incumbent.load(std::memory_order_relaxed))) {
+                    self.m_open.clear();
+                }
+
+                if (self.m_open.empty()) { // IDLE...
+
+                    flush();
+
+                    _shared.m_pending.fetch_sub(1U, std::memory_order_acq_rel);
+
+                    for (size_t spins = 0U;; ++spins) {
+
+                        if (_shared.m_pending.load(std::memory_order_acquire) == 0U || _shared.m_stop.load(std::memory_order_relaxed)) {
+                            if (report(_shared, expanded, closed, 0U)) {
+                                _shared.fail(std::make_exception_ptr(budget_exhausted()));
+                            }
+                            return;
+                        }
+
+                        // A batch in the inbox is counted as pending until received, so the search cannot have terminated:
+                        if (!_shared.m_inboxes[_thread].empty()) {
+                            _shared.m_pending.fetch_add(1U, std::memory_order_acq_rel);
+                            break;
+                        }
+
+                        // Back off if idle for a while, leaving the cores to threads with work:
+                        if (spins < s_spin_limit) {
+                            std::this_thread::yield();
+                        }
+                        else {
+                            std::this_thread::sleep_for(std::chrono::microseconds(50));
+                        }
+                    }
+
+                    continue;
+                }
+
+                const auto curr = self.m_open.top();
+                self.m_open.pop();
+
+                // Skip nodes which have since been reached by a cheaper route:
+                if (self.m_records.find(curr.m_index)->second.m_gScore < curr.m_gScore) {
+                    continue;
+                }
+
+                ++closed;
+
+                if (curr.m_index == _shared.m_e) { // SOLUTION REACHED...
+
+                    auto incumbent = _shared.m_incumbent.load(std::memory_order_relaxed);
+
+                    while (curr.m_gScore < incumbent && !_shared.m_incumbent.compare_exchange_weak(incumbent, curr.m_gScore, std::memory_order_relaxed)) {}
+
+                    continue;
+                }
+
+                // SEARCH FOR SOLUTION...
+                for (const auto& n_data : params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
+
+                    if (const auto& n = solver_t::get_data(n_data, params); n.active) {
+
+                        const auto g = curr.m_gScore + n.distance;
+                        const auto f = g + params.h(n.coord, end) * params.weight;
+
+                        if (f < _shared.m_incumbent.load(std::memory_order_relaxed)) {
+
+                            const message m { n.index, curr.m_index, g, f };
+
+                            if (const auto destination = _shared.owner(n.index); destination == _thread) {
+                                receive(self, m);
+                            }
+                            else {
+                                auto& outgoing = self.m_outgoing[destination];
+                                outgoing.emplace_back(m);
+
+                                if (outgoing.size() >= s_batch_size) {
+                                    send(_shared, destination, outgoing);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                if (UNLIKELY(++expanded >= s_report_interval)) {
+
+                    // Partially filled batches are also sent periodically, so that other threads are not starved:
+                    flush();
+
+                    if (report(_shared, expanded, closed, self.m_open.size())) {
+                        _shared.fail(std::make_exception_ptr(budget_exhausted()));
+                    }
+
+                    expanded = 0U;
+                    closed   = 0U;
+                }
+            }
+        }
+
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
+
+            constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
+
+            const auto&   end = do_reverse ? _params.start : _params.end;
+            const auto& start = do_reverse ? _params.end   : _params.start;
+
+            const auto s = static_cast<index_t>(utils::to_1d(start, _params.size));
+            const auto e = static_cast<index_t>(utils::to_1d(end,   _params.size));
+
+            const auto threads = solver_t::solver_utils::determine_threads(_params);
+
+            shared state(_params, _monitor, threads, s, e);
+
+            receive(*state.m_partitions[state.owner(s)], message { s, s, static_cast<scalar_t>(0), _params.h(start, end) * _params.weight });
+
+            const auto run = [&state](size_t _thread) {
+                try {
+                    work(state, _thread);
+                }
+                catch (...) {
+                    state.fail(std::current_exception());
+                }
+            };
+
+            std::vector<std::future<void>> futures;
+            futures.reserve(threads - 1U);
+
+            for (size_t t = 1U; t < threads; ++t) {
+                futures.emplace_back(std::async(std::launch::async, run, t));
+            }
+
+            run(0U);
+
+            for (auto& future : futures) {
+                future.get();
+            }
+
+            if (state.m_exception != nullptr) {
+                std::rethrow_exception(state.m_exception);
+            }
+
+            std::vector<coord_t> result{};
+
+            // Follow the parent of each node through the partition which owns it:
+            if (const auto incumbent = state.m_incumbent.load(std::memory_order_relaxed); incumbent != std::numeric_limits<scalar_t>::max()) {
+
+                _monitor.reach(incumbent);
+
+                for (auto i = e; i != s; i = state.m_partitions[state.owner(i)]->m_records.find(i)->second.m_parent) {
+                    result.emplace_back(utils::to_nd(static_cast<typename coord_t::value_type>(i), _params.size));
+                }
+
+                if constexpr (params_t::reverse_equivalence::value) {
+                    std::reverse(result.begin(), result.end());
+                }
+            }
+
+            return result;
+        }
+    };
+
+    /**
+     * @}
+     * @}
+     * @}
+     */
+
+} //chdr::solvers
+
+#endif //CHDR_HDASTAR_HPP
@@ -129,7 +129,7 @@ namespace chdr::solvers {
         };
 
         template <typename open_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params, monitor<params_t>& _monitor) {
 
             using neighbours_t = decltype(_params.maze.template get_neighbours<params_t::octile_neighbours::value>(std::declval<index_t>()));
 
@@ -166,11 +166,14 @@ namespace chdr::solvers {
                                     auto f = g + (_params.h(n.coord, _params.end) * _params.weight);
 
                                     _open.emplace_back(n.index, g, f);
+                                    _monitor.generate(_open.size());
 
                                     if (n.index != e) { // SEARCH FOR SOLUTION...
+                                        _monitor.expand();
                                         stack.emplace(_open.back(), _params);
                                     }
                                     else { // SOLUTION REACHED...
+                                        _monitor.reach(_open.back().m_gScore);
                                         return solver_t::solver_utils::ibacktrack(_open, _params.size);
                                     }
                                 }
@@ -201,7 +204,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -211,7 +214,7 @@ namespace chdr::solvers {
             }
             catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, _params);
+            return solve_internal(open, _params, _monitor);
         }
     };
 
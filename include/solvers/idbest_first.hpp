@@ -125,7 +125,7 @@ namespace chdr::solvers {
         };
 
         template <typename open_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params, monitor<params_t>& _monitor) {
 
             using neighbours_t = decltype(_params.maze.template get_neighbours<params_t::octile_neighbours::value>(std::declval<index_t>()));
 
@@ -161,8 +161,10 @@ namespace chdr::solvers {
                                     auto h = _params.h(n.coord, _params.end) * _params.weight;
 
                                     _open.emplace_back(n.index, h);
+                                    _monitor.generate(_open.size());
 
                                     if (n.index != e) { // SEARCH FOR SOLUTION...
+                                        _monitor.expand();
                                         stack.emplace(_open.back(), _params);
                                     }
                                     else { // SOLUTION REACHED...
@@ -196,7 +198,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -206,7 +208,7 @@ namespace chdr::solvers {
             }
             catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, _params);
+            return solve_internal(open, _params, _monitor);
         }
     };
 
@@ -119,7 +119,7 @@ namespace chdr::solvers {
         };
 
         template <typename open_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params, monitor<params_t>& _monitor) {
 
             using neighbours_t = decltype(_params.maze.template get_neighbours<params_t::octile_neighbours::value>(std::declval<index_t>()));
 
@@ -128,40 +128,43 @@ namespace chdr::solvers {
 
             _open.emplace_back(s, 0U);
 
-            stack<state<neighbours_t>> stack(_params.monotonic_pmr);
-
             for (size_t bound = 0U; bound < std::numeric_limits<size_t>::max(); ++bound) {
+                { // The stack must release its memory before the pool is reset:
+                    stack<state<neighbours_t>> stack(_params.monotonic_pmr);
 
-                stack.emplace(_open.back(), _params);
+                    stack.emplace(_open.back(), _params);
 
-                // Main loop:
-                while (!stack.empty()) {
+                    // Main loop:
+                    while (!stack.empty()) {
 
-                    auto& _    = stack.top();
-                    auto& curr = _open.back();
+                        auto& _    = stack.top();
+                        auto& curr = _open.back();
 
-                    if (curr.m_depth <= bound && static_cast<size_t>(_.neighbours_idx) != _.neighbours.size()) {
+                        if (curr.m_depth <= bound && static_cast<size_t>(_.neighbours_idx) != _.neighbours.size()) {
 
-                        if (const auto& n = solver_t::get_data(_.neighbours[(_.neighbours.size() - 1U) - (_.neighbours_idx++)], _params); n.active) {
+                            if (const auto& n = solver_t::get_data(_.neighbours[(_.neighbours.size() - 1U) - (_.neighbours_idx++)], _params); n.active) {
 
-                            if (std::none_of(_open.begin(), _open.end(), [&n](const auto& _item) ALWAYS_INLINE { return _item.m_index == n.index; })) {
+                                if (std::none_of(_open.begin(), _open.end(), [&n](const auto& _item) ALWAYS_INLINE { return _item.m_index == n.index; })) {
 
-                                _open.emplace_back(n.index, curr.m_depth + 1U);
+                                    _open.emplace_back(n.index, curr.m_depth + 1U);
+                                    _monitor.generate(_open.size());
 
-                                if (n.index != e) { // SEARCH FOR SOLUTION...
-                                    stack.emplace(_open.back(), _params);
-                                }
-                                else { // SOLUTION REACHED...
-                                    return solver_t::solver_utils::ibacktrack(_open, _params.size);
+                                    if (n.index != e) { // SEARCH FOR SOLUTION...
+                                        _monitor.expand();
+                                        stack.emplace(_open.back(), _params);
+                                    }
+                                    else { // SOLUTION REACHED...
+                                        return solver_t::solver_utils::ibacktrack(_open, _params.size);
+                                    }
                                 }
                             }
                         }
-                    }
-                    else {
-                        if (_open.size() > 1U) {
-                            _open.pop_back();
+                        else {
+                            if (_open.size() > 1U) {
+                                _open.pop_back();
+                            }
+                            stack.pop();
                         }
-                        stack.pop();
                     }
                 }
 
@@ -173,7 +176,7 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
@@ -183,7 +186,7 @@ namespace chdr::solvers {
             }
             catch (...) {} // NOLINT(*-empty-catch)
 
-            return solve_internal(open, _params);
+            return solve_internal(open, _params, _monitor);
         }
     };
 
@@ -0,0 +1,308 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_LAZY_THETASTAR_HPP
+#define CHDR_LAZY_THETASTAR_HPP
+
+/**
+ * @file lazy_thetastar.hpp
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../types/containers/existence_set.hpp"
+#include "../types/containers/heap.hpp"
+#include "../utils/smoothing.hpp"
+#include "../utils/utils.hpp"
+#include "base/solver.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::solvers {
+
+    /**
+     * @addtogroup Solvers
+     * @brief Graph traversal and pathfinding algorithms.
+     * @{
+     * @addtogroup Single-Target
+     * @brief Solvers which route to a single destination.
+     * @{
+     * @addtogroup SingleTargetCommon Common
+     * @brief General-purpose solvers.
+     * @{
+     */
+
+    /**
+     * @struct lazy_thetastar
+     * @brief Lazy Theta* any-angle search algorithm.
+     * @details Theta* (Nash et al., 2007) is a variant of A* for grids which allows the parent of a node to be any
+     *          node in line of sight of it, rather than only one of its neighbours. Paths are therefore not
+     *          constrained to the moves of the grid, and are typically shorter and straighter than those of A*.\n\n
+     *
+     *          Lazy Theta* (Nash et al., 2010) defers the line-of-sight check of each node until the node is
+     *          expanded, rather than performing one for every neighbour generated. Since most generated nodes are
+     *          never expanded, this reduces the number of line-of-sight checks considerably, while expanding a
+     *          similar number of nodes to A*.\n\n
+     *
+     *          Costs between nodes are Euclidean distances between their coordinates, so a Euclidean heuristic
+     *          should be supplied in `params_t::h` for the shortest paths.
+     *
+     * Advantages:
+     * - Produces shorter, more natural paths than A* without a separate smoothing pass.
+     * - Expands a similar number of nodes to A*.
+     * - Performs fewer line-of-sight checks than Theta*.
+     *
+     * Limitations:
+     * - Only applicable to grids.
+     * - Paths are not guaranteed to be the true shortest any-angle paths.
+     * - Maintains per-node state for the whole search space, which is sized to the maze on demand.
+     *
+     * Further Reading:
+     * - <a href="https://en.wikipedia.org/wiki/Theta*">Wikipedia Article</a>
+     *
+     * References:
+     * - Nash, A., Daniel, K., Koenig, S. and Felner, A., 2007. Theta*: Any-Angle Path Planning on Grids.
+     *   Proceedings of the AAAI Conference on Artificial Intelligence, 22, 1177–1183.
+     * - Nash, A., Koenig, S. and Tovey, C., 2010. Lazy Theta*: Any-Angle Path Planning and Path Length Analysis in 3D.
+     *   Proceedings of the AAAI Conference on Artificial Intelligence, 24 (1), 147–154.
+     *
+     * @note The resulting path is a sequence of waypoints, which are not necessarily adjacent.
+     * @tparam params_t Type containing the search parameters.
+     *
+     * @see smoothing::line_of_sight()
+     */
+    template<typename params_t>
+    struct [[maybe_unused]] lazy_thetastar final {
+
+        friend class solver<lazy_thetastar, params_t>;
+
+    private:
+
+        using  index_t = typename params_t:: index_type;
+        using scalar_t = typename params_t::scalar_type;
+        using  coord_t = typename params_t:: coord_type;
+        using solver_t = solver<lazy_thetastar, params_t>;
+
+        /** @brief Type used to accumulate Euclidean costs. Integral scalar types are widened to avoid truncation. */
+        using cost_t = std::conditional_t<std::is_floating_point_v<scalar_t>, scalar_t, double>;
+
+        static_assert(!solver_t::solver_utils::template is_graph_v<decltype(std::declval<params_t>().maze)>, "lazy_thetastar requires a grid maze.");
+
+        struct node final {
+
+             index_t m_index;
+            uint32_t m_stamp;
+              cost_t m_gScore;
+              cost_t m_fScore;
+
+            [[nodiscard]] HOT friend constexpr bool operator < (const node& _a, const node& _b) noexcept {
+                return _a.m_fScore > _b.m_fScore || (
+                    !(_a.m_fScore < _b.m_fScore) &&
+                      _a.m_gScore > _b.m_gScore
+                );
+            }
+        };
+
+        /**
+         * @brief Best known cost and parent of a node.
+         * @details `m_stamp` is incremented whenever the cost improves, so entries of the open set which were pushed
+         *          with an older stamp can be recognised as stale without comparing costs.
+         */
+        struct state final {
+
+              cost_t m_gScore = std::numeric_limits<cost_t  >::max();
+             index_t m_parent = std::numeric_limits<index_t >::max();
+            uint32_t m_stamp  = 0U;
+        };
+
+        using state_table_t = std::pmr::vector<state>;
+
+        HOT static constexpr void ensure(state_table_t& _states, index_t _index, size_t _total) {
+
+            if (UNLIKELY(static_cast<size_t>(_index) >= _states.size())) {
+                _states.resize(utils::min(utils::max(static_cast<size_t>(_index) + 1U, _states.size() * 2U), _total));
+            }
+        }
+
+        [[nodiscard]] HOT static cost_t distance(const coord_t& _a, const coord_t& _b) noexcept {
+
+            cost_t result { 0 };
+
+            for (size_t i = 0U; i < std::tuple_size_v<coord_t>; ++i) {
+                const auto d = static_cast<cost_t>(_b[i]) - static_cast<cost_t>(_a[i]);
+                result += d * d;
+            }
+
+            return std::sqrt(result);
+        }
+
+        [[nodiscard]] HOT static cost_t f(cost_t _gScore, const coord_t& _coord, const params_t& _params) noexcept {
+            return _gScore + (static_cast<cost_t>(_params.h(_coord, _params.end)) * static_cast<cost_t>(_params.weight));
+        }
+
+        template <typename open_set_t>
+        HOT static constexpr void push(open_set_t& _open, node&& _node) {
+
+            if constexpr (params_t::lazy_sorting::value) {
+                _open.emplace_nosort(std::move(_node));
+            }
+            else {
+                _open.emplace(std::move(_node));
+            }
+        }
+
+        [[nodiscard]] static auto backtrack(const state_table_t& _states, index_t _s, index_t _e, const params_t& _params) {
+
+            std::vector<coord_t> result{};
+
+            for (auto i = _e; i != _s; i = _states[i].m_parent) {
+                result.emplace_back(utils::to_nd(i, _params.size));
+            }
+
+            if constexpr (params_t::reverse_equivalence::value) {
+                std::reverse(result.begin(), result.end());
+            }
+
+            return result;
+        }
+
+        template <typename open_set_t>
+        [[nodiscard]] HOT static auto solve_internal(open_set_t& _open, existence_set<>& _closed, state_table_t& _states, size_t _capacity, size_t _total, const params_t& _params, monitor<params_t>& _monitor) {
+
+            const auto s = static_cast<index_t>(utils::to_1d(_params.start, _params.size));
+            const auto e = static_cast<index_t>(utils::to_1d(_params.end,   _params.size));
+
+            ensure(_states, utils::max(s, e), _total);
+            _states[s].m_gScore = static_cast<cost_t>(0);
+            _states[s].m_parent = s;
+
+            push(_open, { s, _states[s].m_stamp, static_cast<cost_t>(0), f(static_cast<cost_t>(0), _params.start, _params) });
+
+            while (LIKELY(!_open.empty())) {
+
+                const auto curr(_open.top());
+                _open.pop();
+
+                // Discard stale entries:
+                if (_closed.contains(curr.m_index) || curr.m_stamp != _states[curr.m_index].m_stamp) {
+                    continue;
+                }
+
+                auto& curr_state = _states[curr.m_index];
+
+                const auto curr_coord = utils::to_nd(curr.m_index, _params.size);
+
+                /*
+                 * Verify the assumed line of sight to the parent. If there is none, fall back to
+                 * the best neighbour which has already been expanded (which has line of sight trivially).
+                 */
+                if (curr_state.m_parent != curr.m_index) {
+
+                    if (const auto parent_coord = utils::to_nd(curr_state.m_parent, _params.size);
+                        !smoothing::line_of_sight(_params.maze, parent_coord, curr_coord)
+                    ) {
+                        curr_state.m_gScore = std::numeric_limits<cost_t>::max();
+
+                        for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
+
+                            if (const auto& n = solver_t::get_data(n_data, _params); n.active && _closed.contains(n.index)) {
+
+                                if (const auto g = _states[n.index].m_gScore + distance(n.coord, curr_coord); g < curr_state.m_gScore) {
+                                    curr_state.m_gScore = g;
+                                    curr_state.m_parent = n.index;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                if (curr.m_index == e) {
+
+                    // Euclidean costs are only reported if they can be represented exactly:
+                    if constexpr (std::is_floating_point_v<scalar_t>) {
+                        _monitor.reach(static_cast<scalar_t>(curr_state.m_gScore));
+                    }
+
+                    return backtrack(_states, s, e, _params);
+                }
+
+                _monitor.expand();
+
+                solver_t::solver_utils::preallocate_emplace(_closed, curr.m_index, _capacity, _params.maze.count());
+                _monitor.close();
+
+                // Copied, as the state table may be resized while generating neighbours:
+                const auto parent_index  = curr_state.m_parent;
+                const auto parent_gScore = _states[parent_index].m_gScore;
+                const auto parent_coord  = utils::to_nd(parent_index, _params.size);
+
+                for (const auto& n_data : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr.m_index)) {
+
+                    if (const auto& n = solver_t::get_data(n_data, _params); n.active && !_closed.contains(n.index)) {
+
+                        ensure(_states, n.index, _total);
+
+                        // Assume line of sight from the parent (path 2), to be verified on expansion:
+                        if (const auto g = parent_gScore + distance(parent_coord, n.coord); g < _states[n.index].m_gScore) {
+
+                            auto& n_state = _states[n.index];
+                            n_state.m_gScore = g;
+                            n_state.m_parent = parent_index;
+                            ++n_state.m_stamp;
+
+                            push(_open, { n.index, n_state.m_stamp, g, f(g, n.coord, _params) });
+                            _monitor.generate(_open.size());
+                        }
+                    }
+                }
+            }
+
+            return std::vector<coord_t>{};
+        }
+
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
+
+            const auto capacity = solver_t::solver_utils::determine_capacity(_params);
+            const auto total    = utils::product<size_t>(_params.size);
+
+            state_table_t states(_params.heterogeneous_pmr);
+            try {
+                states.reserve(utils::min(capacity, total));
+            }
+            catch (...) {} // NOLINT(*-empty-catch)
+
+            existence_set<> closed(_params.monotonic_pmr);
+            closed.reserve(capacity);
+
+            heap<node> open(_params.heterogeneous_pmr);
+            try {
+                open.reserve(capacity / 8U);
+            }
+            catch (...) {} // NOLINT(*-empty-catch)
+
+            return solve_internal(open, closed, states, capacity, total, _params, _monitor);
+        }
+    };
+
+    /**
+     * @}
+     * @}
+     * @}
+     */
+
+} //chdr::solvers
+
+#endif //CHDR_LAZY_THETASTAR_HPP
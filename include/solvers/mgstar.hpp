@@ -20,6 +20,7 @@
 #include "../solvers/base/managed_node.hpp"
 #include "../types/containers/existence_set.hpp"
 #include "../types/containers/heap.hpp"
+#include "../types/pmr/accounting_resource.hpp"
 #include "../utils/utils.hpp"
 #include "base/solver.hpp"
 
@@ -54,6 +55,8 @@ namespace chdr::solvers {
      *          "single-source, single-target" (SSST) pathfinding problems.
      *          MG* maintains the number of expanded nodes in memory beneath an arbitrary limit, which it enforces
      *          through temporarily abandoning the worst-case search nodes to prioritise more promising candidates.
+     *          The limit is given in bytes by `params_t::memory_limit`, and is compared against every byte which the
+     *          open set, the closed set, and the search tree request from the pools.
      *          Unlike the SMA* algorithm, MG* ensures an optimal solution by guaranteeing that prematurely discarded
      *          paths are explored fully before a final solution is reached.
      *
@@ -161,12 +164,12 @@ namespace chdr::solvers {
         }
 
         template <typename open_set_t, typename closed_set_t, typename expunct_set_t>
-        [[nodiscard]] HOT static auto desaturate(open_set_t& _open, closed_set_t& _closed, expunct_set_t& _expunct, size_t& _dynamic_allocations, const params_t& _params) {
+        [[nodiscard]] HOT static auto desaturate(open_set_t& _open, closed_set_t& _closed, expunct_set_t& _expunct, accounting_resource& _homogeneous) {
 
             bool result = false;
             if (!_expunct.empty()) { // LOSSLESS:
 
-                _params.homogeneous_pmr->deallocate(std::move(_expunct.top()), sizeof(node), alignof(node)); _dynamic_allocations--;
+                _homogeneous.deallocate(std::move(_expunct.top()), sizeof(node), alignof(node));
                 _expunct.pop();
             }
             else if (!_open.empty()) { // LOSSY:
@@ -184,7 +187,7 @@ namespace chdr::solvers {
         }
 
         template <typename open_set_t, typename closed_set_t>
-        [[maybe_unused, nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const params_t& _params) {
+        [[maybe_unused, nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, closed_set_t& _closed, size_t _capacity, const accounting_resource& _monotonic, accounting_resource& _heterogeneous, accounting_resource& _homogeneous, const params_t& _params, monitor<params_t>& _monitor) {
 
             constexpr bool optimising = true;
             constexpr bool do_reverse = !solver_t::solver_utils::template is_graph_v<decltype(_params.maze)> && params_t::reverse_equivalence::value;
@@ -198,15 +201,12 @@ namespace chdr::solvers {
               _open.emplace(s, static_cast<scalar_t>(0), _params.h(start, end) * _params.weight);
             _closed.emplace(s);
 
-            size_t dynamic_allocations(0U);
-            size_t  closed_allocations(1U);
-
-            // Define heuristic for quantifying memory usage:
-            const auto memory_usage = [&_open, &closed_allocations, &dynamic_allocations]() ALWAYS_INLINE {
-                return _open.size() + closed_allocations + dynamic_allocations;
+            // Bytes allocated by the open set, the closed set, and the search tree:
+            const auto memory_usage = [&_monotonic, &_heterogeneous, &_homogeneous]() ALWAYS_INLINE {
+                return _monotonic.allocated() + _heterogeneous.allocated() + _homogeneous.allocated();
             };
 
-            stack<node*> expunct(_params.heterogeneous_pmr);
+            stack<node*> expunct(&_heterogeneous);
 
             std::optional<node> best_solution;
 
@@ -217,6 +217,8 @@ namespace chdr::solvers {
 
                 if (curr.m_index != e) { // SEARCH FOR SOLUTION...
 
+                    _monitor.expand();
+
                     node* RESTRICT curr_ptr(nullptr);
 
                     if (!best_solution.has_value() || curr.m_gScore < best_solution->m_gScore) {
@@ -231,17 +233,19 @@ namespace chdr::solvers {
                                     // Attempt to resolve the issue of memory saturation.
                                     bool full = memory_usage() >= _params.memory_limit;
                                     if (full) {
-                                        full = desaturate(_open, _closed, expunct, dynamic_allocations, _params);
+                                        full = desaturate(_open, _closed, expunct, _homogeneous);
                                     }
 
                                     if (!full) {
                                         solver_t::solver_utils::preallocate_emplace(_closed, n.index, _capacity, _params.maze.count());
+                                        _monitor.close();
 
                                         if (curr_ptr == nullptr) {
-                                            curr_ptr = new (_params.homogeneous_pmr->allocate(sizeof(node), alignof(node))) node(std::move(curr)); dynamic_allocations++;
+                                            curr_ptr = new (_homogeneous.allocate(sizeof(node), alignof(node))) node(std::move(curr));
                                         }
 
                                         _open.emplace(n.index, curr_ptr->m_gScore + n.distance, _params.h(n.coord, end) * _params.weight, curr_ptr);
+                                        _monitor.generate(_open.size());
                                     }
                                     else {
                                         // Memory saturated. Backup losslessly...
@@ -292,6 +296,8 @@ namespace chdr::solvers {
 
             if (best_solution.has_value()) {
 
+                _monitor.reach(best_solution->m_gScore);
+
                 if constexpr (params_t::reverse_equivalence::value) {
                     return solver_t::solver_utils::rbacktrack(best_solution.value(), _params.size, static_cast<size_t>(best_solution->m_gScore));
                 }
@@ -304,16 +310,20 @@ namespace chdr::solvers {
             }
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto capacity = solver_t::solver_utils::determine_capacity(_params);
 
-            existence_set closed(_params.monotonic_pmr);
+            accounting_resource     monotonic(_params.monotonic_pmr);
+            accounting_resource heterogeneous(_params.heterogeneous_pmr);
+            accounting_resource   homogeneous(_params.homogeneous_pmr);
+
+            existence_set closed(&monotonic);
             closed.reserve(capacity);
 
-            std::pmr::multiset<node> open(_params.heterogeneous_pmr);
+            std::pmr::multiset<node> open(&heterogeneous);
 
-            return solve_internal(open, closed, capacity, _params);
+            return solve_internal(open, closed, capacity, monotonic, heterogeneous, homogeneous, _params, _monitor);
         }
     };
 
@@ -0,0 +1,65 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_PRECOMPILED_HPP
+#define CHDR_PRECOMPILED_HPP
+
+/**
+ * @file precompiled.hpp
+ *
+ * @brief Declarations of the solver registries which are compiled into `libchdr_static`.
+ *
+ * @details Consumers linking against `libchdr_static` have `CHDR_PRECOMPILED` defined to `1`, which exposes the
+ *          `extern template` declarations below. Calls to `chdr::solve()` matching one of these configurations
+ *          then link against the library, rather than instantiating every solver in the calling translation unit.
+ *          Other configurations are instantiated as usual.
+ *
+ * @code
+ *
+ * # CMake:
+ * set(CHDR_BUILD_STATIC ON)
+ * target_link_libraries(YourProject PRIVATE libchdr_static)
+ *
+ * @endcode
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../types/containers/coord.hpp"
+#include "registry.hpp"
+
+namespace chdr::solvers {
+
+    /**
+     * @brief Parameters of the configurations compiled into `libchdr_static`.
+     *
+     * @tparam       Kd Number of dimensions of the grid.
+     * @tparam weight_t Type of the weights of the grid.
+     * @tparam   Octile Whether diagonal neighbours are searched.
+     */
+    template <size_t Kd, typename weight_t, bool Octile>
+    using precompiled_params = dispatch_params<coord<uint32_t, Kd>, weight_t, uint32_t, Octile>;
+
+#if CHDR_PRECOMPILED == 1
+
+    extern template class registry<precompiled_params<2U, bool, false>>;
+    extern template class registry<precompiled_params<2U, bool,  true>>;
+    extern template class registry<precompiled_params<2U, char, false>>;
+    extern template class registry<precompiled_params<2U, char,  true>>;
+
+    extern template class registry<precompiled_params<3U, bool, false>>;
+    extern template class registry<precompiled_params<3U, bool,  true>>;
+    extern template class registry<precompiled_params<3U, char, false>>;
+    extern template class registry<precompiled_params<3U, char,  true>>;
+
+#endif //CHDR_PRECOMPILED == 1
+
+} //chdr::solvers
+
+#endif //CHDR_PRECOMPILED_HPP
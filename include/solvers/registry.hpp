@@ -0,0 +1,438 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_REGISTRY_HPP
+#define CHDR_REGISTRY_HPP
+
+/**
+ * @file registry.hpp
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../mazes/grid.hpp"
+#include "../mazes/statistics.hpp"
+#include "../types/pmr/pool_registry.hpp"
+#include "../utils/heuristics.hpp"
+#include "arastar.hpp"
+#include "astar.hpp"
+#include "base/budget.hpp"
+#include "base/solver.hpp"
+#include "base/stats.hpp"
+#include "best_first.hpp"
+#include "bfs.hpp"
+#include "bit_bfs.hpp"
+#include "dfs.hpp"
+#include "dijkstra.hpp"
+#include "eidastar.hpp"
+#include "eidbest_first.hpp"
+#include "eiddfs.hpp"
+#include "flood.hpp"
+#include "fringe.hpp"
+#include "gbest_first.hpp"
+#include "gbfs.hpp"
+#include "gdfs.hpp"
+#include "gjps.hpp"
+#include "gstar.hpp"
+#include "idastar.hpp"
+#include "idbest_first.hpp"
+#include "iddfs.hpp"
+#include "jps.hpp"
+#include "lazy_thetastar.hpp"
+#include "mgstar.hpp"
+#include "osmastar.hpp"
+#include "selector.hpp"
+#include "smastar.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::solvers {
+
+    /**
+     * @struct options
+     * @brief Runtime configuration of a query made through `chdr::solve()`.
+     *
+     * @details Carries the members of `params_t` which the solvers read at run time. Members left at their default
+     *          values behave as they would if the corresponding member of `params_t` were absent.
+     *
+     * @tparam scalar_t Type of the path costs.
+     * @tparam  coord_t Type of the coordinates.
+     */
+    template <typename scalar_t, typename coord_t>
+    struct options final {
+
+        /** @brief Weight of the heuristic, for solvers which support weighting. */
+        scalar_t weight = static_cast<scalar_t>(1);
+
+        /** @brief Initial capacity of the open set. If zero, an estimate is made from the size of the maze. */
+        size_t capacity = 0U;
+
+        /** @brief Bytes which memory-bounded solvers may allocate. See `accounting_resource`. */
+        size_t memory_limit = std::numeric_limits<size_t>::max();
+
+        /** @brief Threads used by parallel solvers. If zero, every core is used. */
+        size_t threads = 0U;
+
+        /** @brief Whether diagonal neighbours are searched. */
+        bool octile = false;
+
+        /** @brief Heuristic of the search. If null, the Manhattan distance is used, or the octile distance if `octile` is set. */
+        scalar_t (*h)(const coord_t&, const coord_t&) noexcept = nullptr;
+
+        /** @brief Limits on the resources of the search. See `budget`. */
+        chdr::solvers::budget budget {};
+
+        /** @brief Memory pools of the search. If null, the pools of the calling thread are used. See `pool_registry`. */
+        typename pool_registry<>::pools* pools = nullptr;
+
+        /** @brief Statistics of the maze, consulted by the "auto" solver. If null, they are gathered for each query. See `selector`. */
+        const mazes::statistics* statistics = nullptr;
+    };
+
+    /**
+     * @struct dispatch_result
+     * @brief The outcome of a call to `chdr::solve()`.
+     *
+     * @details Equivalent to `search_result`, but independent of the parameters of the search, so that queries
+     *          selecting different parameters at run time share a result type.
+     *
+     * @tparam  coord_t Type of the coordinates.
+     * @tparam scalar_t Type of the path costs.
+     *
+     * @see search_result
+     */
+    template <typename coord_t, typename scalar_t>
+    struct dispatch_result final {
+
+        /** @brief Status of the search. */
+        search_status status;
+
+        /**
+         * @brief The resulting path. Empty if no path was found.
+         *
+         * @details Solvers differ in the order of the paths they produce, so every path is normalised into the
+         *          same order: from the end to the first step after the start, i.e. `[end, ..., start + 1]`. Some
+         *          solvers return fewer coordinates than a full path:
+         *          - `jps` and `gjps` return only the jump points, between which the path is a straight line.
+         *          - `lazy_thetastar` returns only the waypoints of an any-angle path.
+         *          - `flood` only determines reachability, and returns `[end]`.
+         */
+        std::vector<coord_t> path;
+
+        /** @brief Total cost of the path, as held by the solver on reaching the goal. Empty if unknown or no path was found. */
+        std::optional<scalar_t> cost;
+
+#if CHDR_DIAGNOSTICS == 1
+
+        /** @brief Statistics describing the work performed by the search. */
+        search_stats stats;
+
+#endif //CHDR_DIAGNOSTICS == 1
+    };
+
+    /**
+     * @struct dispatch_params
+     * @brief The parameters of a query made through `chdr::solve()`.
+     *
+     * @details The compile-time configuration of the search is fixed, leaving the maze, dimensionality, weight and
+     *          scalar types and neighbourhood as the only axes along which solvers are instantiated.
+     *
+     * @tparam  coord_t Type of the coordinates.
+     * @tparam weight_t Type of the weights of the grid.
+     * @tparam scalar_t Type of the path costs.
+     * @tparam   Octile Whether diagonal neighbours are searched.
+     */
+    template <typename coord_t, typename weight_t, typename scalar_t, bool Octile>
+    struct dispatch_params final {
+
+        using  weight_type [[maybe_unused]] = weight_t;
+        using  scalar_type [[maybe_unused]] = scalar_t;
+        using   index_type [[maybe_unused]] = typename coord_t::value_type;
+        using   coord_type [[maybe_unused]] = coord_t;
+
+        using        lazy_sorting [[maybe_unused]] = std::false_type;
+        using          no_cleanup [[maybe_unused]] = std::false_type;
+        using reverse_equivalence [[maybe_unused]] = std::false_type;
+        using   octile_neighbours [[maybe_unused]] = std::bool_constant<Octile>;
+
+        const mazes::grid<coord_t, weight_t>& maze;
+        const coord_type start;
+        const coord_type end;
+        const coord_type size;
+        scalar_type (*h)(const coord_type&, const coord_type&) noexcept;
+
+            monotonic_pool<>*     monotonic_pmr;
+        heterogeneous_pool<>* heterogeneous_pmr;
+          homogeneous_pool<>*   homogeneous_pmr;
+
+        const scalar_type weight;
+        const      size_t capacity;
+        const      size_t memory_limit;
+        chdr::solvers::budget budget;
+        const      size_t threads;
+    };
+
+    /**
+     * @nosubgrouping
+     * @class registry
+     * @brief Maps the names of the solvers onto their instantiations for a parameter set.
+     *
+     * @details Each entry is a pointer to a function which runs one solver to completion, so selecting a solver at
+     *          run time costs a lookup and a single indirect call, while the search itself remains fully templated.
+     *          Entries are sorted by name.
+     *
+     * @tparam params_t Type containing the search parameters.
+     *
+     * @see chdr::solve()
+     */
+    template <typename params_t>
+    class registry final {
+
+    public:
+
+        using result_t = dispatch_result<typename params_t::coord_type, typename params_t::scalar_type>;
+        using  entry_t = result_t (*)(const params_t&);
+
+    private:
+
+        struct entry final {
+            std::string_view name;
+            entry_t          function;
+        };
+
+        template <template <typename> typename solver_t>
+        static result_t invoke(const params_t& _params) {
+
+            auto search = solver<solver_t, params_t>::search(_params);
+
+            // Normalise the path into the order `[end, ..., start + 1]`. Paths ordered from the start are reversed,
+            // and some omit the end rather than the start:
+            if (auto& path = search.path; !path.empty() && _params.start != _params.end) {
+
+                if (path.front() != _params.end) {
+
+                    if (path.back() != _params.end) {
+                        path.emplace_back(_params.end);
+                    }
+
+                    std::reverse(path.begin(), path.end());
+                }
+
+                if (path.back() == _params.start) {
+                    path.pop_back();
+                }
+            }
+
+#if CHDR_DIAGNOSTICS == 1
+            return { search.status, std::move(search.path), search.cost, search.stats };
+#else //CHDR_DIAGNOSTICS != 1
+            return { search.status, std::move(search.path), search.cost };
+#endif //CHDR_DIAGNOSTICS == 1
+        }
+
+        /** @brief The entry of a solver which only supports two-dimensional, octile neighbourhoods, which is null for other parameters. */
+        template <template <typename> typename solver_t>
+        [[nodiscard]] static constexpr entry_t planar_octile_only() noexcept {
+
+            if constexpr (params_t::octile_neighbours::value && std::tuple_size_v<typename params_t::coord_type> == 2U) {
+                return &invoke<solver_t>;
+            }
+            else {
+                return nullptr;
+            }
+        }
+
+        static constexpr std::array<entry, 25U> s_entries {{
+            { "arastar",        &invoke<arastar>        },
+            { "astar",          &invoke<astar>          },
+            { "best_first",     &invoke<best_first>     },
+            { "bfs",            &invoke<bfs>            },
+            { "bit_bfs",        &invoke<bit_bfs>        },
+            { "dfs",            &invoke<dfs>            },
+            { "dijkstra",       &invoke<dijkstra>       },
+            { "eidastar",       &invoke<eidastar>       },
+            { "eidbest_first",  &invoke<eidbest_first>  },
+            { "eiddfs",         &invoke<eiddfs>         },
+            { "flood",          &invoke<flood>          },
+            { "fringe",         &invoke<fringe>         },
+            { "gbest_first",    &invoke<gbest_first>    },
+            { "gbfs",           &invoke<gbfs>           },
+            { "gdfs",           &invoke<gdfs>           },
+            { "gjps",           planar_octile_only<gjps>() },
+            { "gstar",          &invoke<gstar>          },
+            { "idastar",        &invoke<idastar>        },
+            { "idbest_first",   &invoke<idbest_first>   },
+            { "iddfs",          &invoke<iddfs>          },
+            { "jps",            planar_octile_only<jps>()  },
+            { "lazy_thetastar", &invoke<lazy_thetastar> },
+            { "mgstar",         &invoke<mgstar>         },
+            { "osmastar",       &invoke<osmastar>       },
+            { "smastar",        &invoke<smastar>        }
+        }};
+
+        [[nodiscard]] static constexpr bool sorted() noexcept {
+
+            for (size_t i = 1U; i < s_entries.size(); ++i) {
+                if (!(s_entries[i - 1U].name < s_entries[i].name)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    public:
+
+        registry() = delete;
+
+        /**
+         * @brief Finds the solver with the given name.
+         *
+         * @param [in] _name Name of the solver, matching the name of its type. (i.e. "astar")
+         * @return A pointer to the function running the solver, or `nullptr` if no solver has the given name, or it
+         *         does not support the dimensionality or neighbourhood of the parameters.
+         */
+        [[maybe_unused, nodiscard]] static entry_t find(std::string_view _name) noexcept;
+
+        /**
+         * @brief Retrieves the names of every solver supporting the parameters, in sorted order.
+         * @return A vector containing the names of the solvers.
+         */
+        [[maybe_unused, nodiscard]] static std::vector<std::string_view> names();
+    };
+
+    /*
+     * Defined out of line, so that `extern template` declarations of a registry suppress the instantiation of its
+     * solvers. See `precompiled.hpp`.
+     */
+
+    template <typename params_t>
+    typename registry<params_t>::entry_t registry<params_t>::find(std::string_view _name) noexcept {
+
+        static_assert(sorted(), "Entries must be sorted by name.");
+
+        const auto it = std::lower_bound(s_entries.begin(), s_entries.end(), _name,
+            [](const entry& _entry, std::string_view _key) { return _entry.name < _key; }
+        );
+
+        return it != s_entries.end() && it->name == _name ? it->function : nullptr;
+    }
+
+    template <typename params_t>
+    std::vector<std::string_view> registry<params_t>::names() {
+
+        std::vector<std::string_view> result;
+        result.reserve(s_entries.size());
+
+        for (const auto& e : s_entries) {
+            if (e.function != nullptr) {
+                result.emplace_back(e.name);
+            }
+        }
+
+        return result;
+    }
+
+} //chdr::solvers
+
+namespace chdr {
+
+    /**
+     * @brief Solves a query on a grid with a solver selected at run time.
+     *
+     * @details Looks the solver up in the `registry` of the parameter set selected by `_options`, and invokes it
+     *          through a single indirect call. Unlike `solver<solver_t, params_t>`, the caller does not instantiate
+     *          the solvers for every configuration it may select between; each combination of coordinate, weight
+     *          and scalar type is instantiated once, behind the registry.\n\n
+     *
+     *          The name "auto" selects a solver using the `selector`, from the `statistics` supplied in `_options`.
+     *          Supply them when making more than one query against a maze, as gathering them visits every node.
+     *
+     * @code
+     *
+     * chdr::solvers::options<uint32_t, chdr::coord<uint32_t, 2U>> options;
+     * options.octile = true;
+     *
+     * const auto result = chdr::solve("astar", maze, start, end, options);
+     *
+     * if (result.status == chdr::solvers::search_status::found) {
+     *     ...
+     * }
+     *
+     * @endcode
+     *
+     * @param [in]  _solver Name of the solver, matching the name of its type (i.e. "astar"), or "auto".
+     * @param [in]    _maze The grid to search.
+     * @param [in]   _start Start coordinate of the search.
+     * @param [in]     _end End coordinate of the search.
+     * @param [in] _options (optional) Runtime configuration of the search.
+     *
+     * @tparam scalar_t Type of the path costs. (optional, defaults to `uint32_t`)
+     * @tparam  coord_t Type of the coordinates.
+     * @tparam weight_t Type of the weights of the grid.
+     *
+     * @throws std::invalid_argument If no solver has the given name, or the solver does not support the dimensionality
+     *                               of the grid or the neighbourhood selected by `_options`. (i.e. "jps" outside of
+     *                               two dimensions, or without `octile`)
+     *
+     * @return A `dispatch_result` containing the status of the search and the resulting path.
+     *
+     * @see solvers::registry
+     */
+    template <typename scalar_t = uint32_t, typename coord_t, typename weight_t>
+    [[maybe_unused, nodiscard]] solvers::dispatch_result<coord_t, scalar_t> solve(std::string_view _solver, const mazes::grid<coord_t, weight_t>& _maze, const coord_t& _start, const coord_t& _end, const solvers::options<scalar_t, coord_t>& _options = {}) {
+
+        auto& pools = _options.pools != nullptr ? *_options.pools : pool_registry<>::local();
+
+        if (_solver == "auto") {
+            _solver = _options.statistics != nullptr ?
+                solvers::selector::select(*_options.statistics,     _options.octile) :
+                solvers::selector::select(mazes::statistics(_maze), _options.octile);
+        }
+
+        const auto dispatch = [&](auto _octile) {
+
+            using params_t = solvers::dispatch_params<coord_t, weight_t, scalar_t, decltype(_octile)::value>;
+
+            const auto function = solvers::registry<params_t>::find(_solver);
+
+            if (function == nullptr) {
+                throw std::invalid_argument("Unknown solver \"" + std::string(_solver) + "\" for " + std::to_string(std::tuple_size_v<coord_t>) + "D grids with " + (decltype(_octile)::value ? "octile" : "non-octile") + " neighbours.");
+            }
+
+            const auto h = _options.h != nullptr ? _options.h : (
+                decltype(_octile)::value ?
+                    heuristics::octile_distance   <scalar_t, coord_t> :
+                    heuristics::manhattan_distance<scalar_t, coord_t>
+            );
+
+            return function(params_t {
+                _maze, _start, _end, _maze.size(), h,
+                pools.monotonic_pmr(), pools.heterogeneous_pmr(), pools.homogeneous_pmr(),
+                _options.weight, _options.capacity, _options.memory_limit, _options.budget, _options.threads
+            });
+        };
+
+        return _options.octile ? dispatch(std::true_type {}) : dispatch(std::false_type {});
+    }
+
+} //chdr
+
+#endif //CHDR_REGISTRY_HPP
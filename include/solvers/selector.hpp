@@ -0,0 +1,100 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_SELECTOR_HPP
+#define CHDR_SELECTOR_HPP
+
+/**
+ * @file selector.hpp
+ */
+
+#include <cstddef>
+#include <string_view>
+
+#include "../mazes/statistics.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr::solvers {
+
+    /**
+     * @struct selector
+     * @brief Chooses the solver expected to answer a query fastest, given the `statistics` of its maze.
+     *
+     * @details Backs the "auto" solver of `chdr::solve()`. The choice is made between `jps`, `astar`, `bfs`, `fringe`
+     *          and `gstar`, using thresholds calibrated against the "auto" benchmark of the test application, which
+     *          times each candidate on open, cluttered and maze-like grids:
+     *          - Mazes dominated by corridors give a heuristic nothing to choose between, so `bfs` wins by avoiding
+     *            the cost of maintaining a priority queue.
+     *          - Without diagonals, `bfs` also wins on sparsely cluttered grids, where A* expands a similar number of
+     *            nodes at a higher cost per node. Denser clutter favours `astar`.
+     *          - With diagonals, sparsely cluttered grids let `jps` skip the symmetric paths which A* would expand.
+     *            Denser clutter breaks up its jumps, and favours `astar`.
+     *          - Mazes with non-uniform costs are only routed optimally by the weighted solvers, so `astar` is used.
+     *
+     *          `fringe` and `gstar` are timed by the benchmark, but did not win consistently on any class of grid.
+     *
+     * @note The thresholds describe the machines on which they were measured. Re-run the benchmark to recalibrate them.
+     * @warning When `jps` is selected, the path holds the jump points of the route rather than every node along it.
+     *
+     * @see mazes::statistics
+     */
+    struct selector final {
+
+        /** @brief Corridor ratio above which a maze is searched breadth-first, regardless of its neighbourhood. */
+        static constexpr double s_maze_corridor_ratio = 0.8;
+
+        /** @brief Corridor ratio above which a maze is searched breadth-first, when diagonals are not searched. */
+        static constexpr double s_corridor_ratio = 0.5;
+
+        /** @brief Obstacle density below which a maze is searched breadth-first, when diagonals are not searched. */
+        static constexpr double s_bfs_density = 0.15;
+
+        /** @brief Obstacle density below which jump-point search is preferred, when diagonals are searched. */
+        static constexpr double s_jps_density = 0.25;
+
+        /** @brief Highest rank for which jump-point search is preferred, as the number of jump directions grows with rank. */
+        static constexpr size_t s_jps_rank = 3U;
+
+        selector() = delete;
+
+        /**
+         * @brief Selects a solver for queries against a maze.
+         *
+         * @param [in] _statistics Statistics of the maze.
+         * @param [in]     _octile Whether the query searches diagonal neighbours.
+         * @return The name of the selected solver, as registered in the `registry`.
+         */
+        [[maybe_unused, nodiscard]] static constexpr std::string_view select(const mazes::statistics& _statistics, bool _octile) noexcept {
+
+            if (!_statistics.uniform()) {
+                return "astar";
+            }
+
+            if (_statistics.corridor_ratio() > s_maze_corridor_ratio) {
+                return "bfs";
+            }
+
+            if (_octile) {
+
+                if (_statistics.rank() != 0U && _statistics.rank() <= s_jps_rank && _statistics.density() < s_jps_density) {
+                    return "jps";
+                }
+            }
+            else if (_statistics.density() < s_bfs_density || _statistics.corridor_ratio() > s_corridor_ratio) {
+                return "bfs";
+            }
+
+            return "astar";
+        }
+    };
+
+} //chdr::solvers
+
+#endif //CHDR_SELECTOR_HPP
@@ -18,6 +18,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "../types/containers/flat_map.hpp"
+#include "../types/pmr/accounting_resource.hpp"
 #include "../utils/utils.hpp"
 #include "base/solver.hpp"
 
@@ -45,6 +47,8 @@ namespace chdr::solvers {
      *          "single-source, single-target" (SSST) pathfinding problems.
      *          SMA* maintains the number of expanded nodes in memory beneath an arbitrary limit, which it enforces
      *          through temporarily abandoning the worst-case search nodes to prioritise more promising candidates.
+     *          The limit is given in bytes by `params_t::memory_limit`, and is compared against every byte which the
+     *          open set and the search tree request from the heterogeneous and homogeneous pools.
      *
      * Advantages:
      * - Able to find solutions to search problems in memory-constrained contexts.
@@ -231,16 +235,16 @@ namespace chdr::solvers {
         }
 
         template <typename open_set_t>
-        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, const params_t& _params) {
+        [[nodiscard]] HOT static constexpr auto solve_internal(open_set_t& _open, accounting_resource& _heterogeneous, const accounting_resource& _homogeneous, const params_t& _params, monitor<params_t>& _monitor) {
 
             const auto s = utils::to_1d(_params.start, _params.size);
             const auto e = utils::to_1d(_params.end,   _params.size);
 
-            std::pmr::unordered_map<index_t, node> all_nodes(_params.heterogeneous_pmr);
+            flat_map<index_t, node> all_nodes(&_heterogeneous);
 
-            // Define heuristic for quantifying memory usage:
-            const auto memory_usage = [&all_nodes, &_open]() ALWAYS_INLINE {
-                return all_nodes.size() + _open.size();
+            // Bytes allocated by the open set and the search tree, including any growth of the tree which is pending:
+            const auto memory_usage = [&_heterogeneous, &_homogeneous, &all_nodes]() ALWAYS_INLINE {
+                return _heterogeneous.allocated() + _homogeneous.allocated() + all_nodes.growth();
             };
 
             _open.emplace(
@@ -257,6 +261,8 @@ namespace chdr::solvers {
 
                 if (curr.m_index != e) { // SEARCH FOR SOLUTION...
 
+                    _monitor.expand();
+
                     bool complete = true;
 
                     if (curr.m_fScore != inf_v) {
@@ -274,6 +280,7 @@ namespace chdr::solvers {
 
                                             _open.erase(search->second);
                                             _open.emplace(all_nodes[n.index] = node(n.index, g, g + h, curr.m_index));
+                                            _monitor.generate(_open.size());
 
                                             complete = false;
                                         }
@@ -283,7 +290,7 @@ namespace chdr::solvers {
                                     complete = false;
 
                                     // Attempt to clear space for a new node:
-                                    if (!_open.empty() && memory_usage() >= _params.memory_limit - 1U) {
+                                    if (!_open.empty() && memory_usage() >= _params.memory_limit) {
                                         remove_worst(_open, all_nodes, _params);
                                     }
 
@@ -293,6 +300,7 @@ namespace chdr::solvers {
                                         const auto h = _params.h(n.coord, _params.end) * _params.weight;
 
                                         _open.emplace(all_nodes[n.index] = node(n.index, g, g + h, curr.m_index));
+                                        _monitor.generate(_open.size());
                                     }
                                     else {
                                         break;
@@ -309,6 +317,7 @@ namespace chdr::solvers {
                     }
                 }
                 else { // SOLUTION FOUND...
+                    _monitor.reach(curr.m_gScore);
                     return rbacktrack(curr, all_nodes, _params);
                 }
             }
@@ -316,11 +325,14 @@ namespace chdr::solvers {
             return std::vector<coord_t>{};
         }
 
-        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params) {
+        [[maybe_unused, nodiscard]] static auto invoke(const params_t& _params, monitor<params_t>& _monitor) {
+
+            accounting_resource heterogeneous(_params.heterogeneous_pmr);
+            accounting_resource   homogeneous(_params.homogeneous_pmr);
 
-            std::pmr::multiset<node> open(_params.homogeneous_pmr);
+            std::pmr::multiset<node> open(&homogeneous);
 
-            return solve_internal(open, _params);
+            return solve_internal(open, heterogeneous, homogeneous, _params, _monitor);
         }
     };
 
@@ -0,0 +1,636 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_FLAT_MAP_HPP
+#define CHDR_FLAT_MAP_HPP
+
+/**
+ * @file flat_map.hpp
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <memory_resource>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../utils/utils.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr {
+
+    /**
+     * @nosubgrouping
+     * @class flat_map
+     * @brief Implementation of an unordered associative container using open addressing.
+     *
+     * @details Entries are stored inline in a single contiguous table whose capacity is a power of two, each beside a
+     *          byte recording the distance of the entry from the slot it hashes to. Lookups therefore probe
+     *          adjacent memory rather than following a chain of separately-allocated nodes, and inserting an entry
+     *          only allocates when the table grows.\n\n
+     *
+     *          Collisions are resolved with Robin Hood hashing: an entry which is further from its home slot takes
+     *          the place of one which is nearer, which bounds the variance of probe lengths, and allows a lookup to
+     *          stop as soon as it passes an entry nearer to its home than the key would be. Erasing an entry shifts
+     *          the entries which follow it back by one slot, so the table never accumulates tombstones, and its
+     *          performance does not degrade under frequent erasure.
+     *
+     * @tparam K Type of the keys.
+     * @tparam V Type of the mapped values.
+     * @tparam H Hash function of the keys. The result is scrambled before use, so an identity hash is acceptable.
+     *           (optional, defaults to `std::hash<K>`)
+     *
+     * @note This class uses polymorphic memory resources (`std::pmr::memory_resource`).
+     * @note Follows an STL-like design and supports iterators.
+     *
+     * @warning Any insertion or erasure invalidates all iterators, pointers and references into the map.
+     */
+    template <typename K, typename V, typename H = std::hash<K>>
+    class flat_map {
+
+    public:
+
+        using     key_type = K;
+        using  mapped_type = V;
+        using   value_type = std::pair<K, V>;
+        using    size_type = size_t;
+        using       hasher = H;
+
+    private:
+
+        /** @brief A slot of the table. Its entry is stored alongside its distance, so that probing touches one line. */
+        struct slot final {
+
+            alignas(value_type) std::byte m_storage[sizeof(value_type)];
+
+            uint8_t m_distance; // 0 if the slot is empty, otherwise one more than the distance of its entry from home.
+
+            [[nodiscard]] HOT       value_type* get()       noexcept { return std::launder(reinterpret_cast<      value_type*>(m_storage)); }
+            [[nodiscard]] HOT const value_type* get() const noexcept { return std::launder(reinterpret_cast<const value_type*>(m_storage)); }
+        };
+
+        /** @brief Capacity of the table when the first entry is inserted. */
+        static constexpr size_t s_initial_capacity = 16U;
+
+        /** @brief Largest probe distance representable by a slot, beyond which the table grows. */
+        static constexpr uint8_t s_max_distance = std::numeric_limits<uint8_t>::max();
+
+        std::pmr::memory_resource* m_resource;
+
+        slot*  m_slots;
+        size_t m_capacity;
+        size_t m_size;
+        size_t m_shift;
+
+        H m_hash;
+
+        [[nodiscard]] static constexpr size_t storage_size(size_t _capacity) noexcept { return _capacity * sizeof(slot); }
+
+        /** @brief Maps a key onto its home slot using Fibonacci hashing. */
+        [[nodiscard]] HOT constexpr size_t home(const K& _key) const noexcept {
+            return static_cast<size_t>((static_cast<uint64_t>(m_hash(_key)) * 0x9E3779B97F4A7C15ULL) >> m_shift);
+        }
+
+        [[nodiscard]] HOT constexpr size_t next(size_t _index) const noexcept { return (_index + 1U) & (m_capacity - 1U); }
+
+        /** @brief Whether the table must grow before another entry is inserted. Keeps the load factor below 7/8. */
+        [[nodiscard]] HOT constexpr bool saturated() const noexcept {
+            return (m_size + 1U) * 8U > m_capacity * 7U;
+        }
+
+        void destroy_all() noexcept {
+
+            for (size_t i = 0U; i < m_capacity; ++i) {
+
+                if (m_slots[i].m_distance != 0U) {
+
+                    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                        std::destroy_at(m_slots[i].get());
+                    }
+
+                    m_slots[i].m_distance = 0U;
+                }
+            }
+
+            m_size = 0U;
+        }
+
+        void release() noexcept {
+
+            if (m_slots != nullptr) {
+
+                destroy_all();
+
+                m_resource->deallocate(m_slots, storage_size(m_capacity), alignof(slot));
+            }
+
+            m_slots    = nullptr;
+            m_capacity = 0U;
+            m_shift    = 0U;
+        }
+
+        /**
+         * @brief Places an entry known to be absent from the table, displacing entries nearer to their home.
+         * @return Index of the slot in which the entry was placed, or the capacity of the table if the table grew.
+         */
+        HOT size_t place(value_type&& _entry) {
+
+            auto    i = home(_entry.first);
+            uint8_t d = 1U;
+
+            while (m_slots[i].m_distance >= d) {
+                i = next(i);
+                ++d;
+            }
+
+            return place_at(i, d, std::move(_entry));
+        }
+
+        /** @brief Places an entry at the given slot, at which probing for it stopped. @see place() */
+        HOT size_t place_at(size_t _index, uint8_t _distance, value_type&& _entry) {
+
+            auto result = _index;
+
+            while (m_slots[_index].m_distance != 0U) {
+
+                std::swap(_entry,    *m_slots[_index].get());
+                std::swap(_distance,  m_slots[_index].m_distance);
+
+                _index = next(_index);
+
+                if (UNLIKELY(++_distance == s_max_distance)) {
+
+                    // Probe sequence too long to represent. The table is consistent without the carried entry:
+                    rehash(m_capacity * 2U);
+                    place(std::move(_entry));
+
+                    return m_capacity;
+                }
+            }
+
+            ::new (static_cast<void*>(m_slots[_index].m_storage)) value_type(std::move(_entry));
+            m_slots[_index].m_distance = _distance;
+            ++m_size;
+
+            return result;
+        }
+
+        void rehash(size_t _capacity) {
+
+            assert(_capacity >= m_size && (_capacity & (_capacity - 1U)) == 0U && "Invalid capacity.");
+
+            auto* const old_slots    = m_slots;
+            const auto  old_capacity = m_capacity;
+
+            m_slots    = static_cast<slot*>(m_resource->allocate(storage_size(_capacity), alignof(slot)));
+            m_capacity = _capacity;
+            m_size     = 0U;
+            m_shift    = 64U;
+
+            for (auto c = _capacity; c > 1U; c >>= 1U) {
+                --m_shift;
+            }
+
+            for (size_t i = 0U; i < m_capacity; ++i) {
+                ::new (static_cast<void*>(m_slots + i)) slot;
+                m_slots[i].m_distance = 0U;
+            }
+
+            for (size_t i = 0U; i < old_capacity; ++i) {
+
+                if (old_slots[i].m_distance != 0U) {
+                    place(std::move(*old_slots[i].get()));
+                    std::destroy_at(old_slots[i].get());
+                }
+            }
+
+            if (old_slots != nullptr) {
+                m_resource->deallocate(old_slots, storage_size(old_capacity), alignof(slot));
+            }
+        }
+
+        /** @brief Finds the slot of a key, or the capacity of the table if the key is absent. */
+        [[nodiscard]] HOT size_t find_index(const K& _key) const noexcept {
+
+            if (m_size != 0U) {
+
+                auto    i = home(_key);
+                uint8_t d = 1U;
+
+                while (m_slots[i].m_distance >= d) {
+
+                    if (m_slots[i].m_distance == d && m_slots[i].get()->first == _key) {
+                        return i;
+                    }
+
+                    i = next(i);
+                    ++d;
+                }
+            }
+
+            return m_capacity;
+        }
+
+        void erase_at(size_t _index) noexcept {
+
+            std::destroy_at(m_slots[_index].get());
+
+            // Shift the entries which follow back by one slot, until one is found in its home slot:
+            for (auto j = next(_index); m_slots[j].m_distance > 1U; _index = j, j = next(j)) {
+
+                ::new (static_cast<void*>(m_slots[_index].m_storage)) value_type(std::move(*m_slots[j].get()));
+                std::destroy_at(m_slots[j].get());
+
+                m_slots[_index].m_distance = static_cast<uint8_t>(m_slots[j].m_distance - 1U);
+            }
+
+            m_slots[_index].m_distance = 0U;
+            --m_size;
+        }
+
+        template <typename U>
+        void assign_from(U&& _other) {
+
+            destroy_all();
+
+            if (_other.m_size != 0U) {
+
+                if (saturated_for(_other.m_size)) {
+                    release();
+                    rehash(capacity_for(_other.m_size));
+                }
+
+                for (size_t i = 0U; i < _other.m_capacity; ++i) {
+
+                    if (_other.m_slots[i].m_distance != 0U) {
+
+                        if constexpr (std::is_lvalue_reference_v<U>) {
+                            place(value_type(*_other.m_slots[i].get()));
+                        }
+                        else {
+                            place(std::move(*_other.m_slots[i].get()));
+                        }
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr bool saturated_for(size_t _size) const noexcept {
+            return _size * 8U > m_capacity * 7U;
+        }
+
+        [[nodiscard]] static constexpr size_t capacity_for(size_t _size) noexcept {
+
+            size_t result = s_initial_capacity;
+
+            while (_size * 8U > result * 7U) {
+                result <<= 1U;
+            }
+
+            return result;
+        }
+
+        template <bool Const>
+        class iterator_base final {
+
+            friend class flat_map;
+            friend class iterator_base<!Const>;
+
+            using owner_t = std::conditional_t<Const, const flat_map, flat_map>;
+
+            owner_t* m_owner;
+            size_t   m_index;
+
+            constexpr iterator_base(owner_t* _owner, size_t _index) noexcept : m_owner(_owner), m_index(_index) {}
+
+            /** @brief Advances to the first occupied slot at or after the current one. */
+            constexpr iterator_base& settle() noexcept {
+
+                while (m_index < m_owner->m_capacity && m_owner->m_slots[m_index].m_distance == 0U) {
+                    ++m_index;
+                }
+
+                return *this;
+            }
+
+        public:
+
+            using iterator_category = std::forward_iterator_tag;
+            using        value_type = typename flat_map::value_type;
+            using   difference_type = std::ptrdiff_t;
+            using           pointer = std::conditional_t<Const, const value_type*, value_type*>;
+            using         reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+            constexpr iterator_base() noexcept : m_owner(nullptr), m_index(0U) {}
+
+            // ReSharper disable once CppNonExplicitConvertingConstructor
+            template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+            constexpr iterator_base(const iterator_base<OtherConst>& _other) noexcept : m_owner(_other.m_owner), m_index(_other.m_index) {} // NOLINT(*-explicit-constructor)
+
+            [[nodiscard]] HOT constexpr reference operator*() const noexcept { return *m_owner->m_slots[m_index].get(); }
+            [[nodiscard]] HOT constexpr pointer  operator->() const noexcept { return  m_owner->m_slots[m_index].get(); }
+
+            HOT constexpr iterator_base& operator++() noexcept { ++m_index; return settle(); }
+
+            constexpr iterator_base operator++(int) noexcept { auto result = *this; ++*this; return result; }
+
+            [[nodiscard]] friend constexpr bool operator==(const iterator_base& _a, const iterator_base& _b) noexcept { return _a.m_index == _b.m_index; }
+            [[nodiscard]] friend constexpr bool operator!=(const iterator_base& _a, const iterator_base& _b) noexcept { return _a.m_index != _b.m_index; }
+        };
+
+    public:
+
+        using       iterator_t = iterator_base<false>;
+        using const_iterator_t = iterator_base<true>;
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Constructs a `flat_map` object.
+         *
+         * @details No memory is allocated until the first entry is inserted.
+         *
+         * @param [in, out] _resource A pointer to the memory resource to be used for
+         *                       memory allocation. Defaults to the global default polymorphic memory resource.
+         */
+        [[maybe_unused, nodiscard]] explicit flat_map(std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) noexcept :
+            m_resource (_resource),
+            m_slots    (nullptr),
+            m_capacity (0U),
+            m_size     (0U),
+            m_shift    (0U),
+            m_hash     () {}
+
+        /**
+         * @brief Constructs a new map with storage for a specified number of entries.
+         *
+         * @param [in] _capacity The number of entries to reserve storage for.
+         * @param [in] _resource (optional) Pointer to the memory resource to be used for memory allocations.
+         *                       If not provided, the default memory resource is utilised.
+         */
+        [[maybe_unused, nodiscard]] explicit flat_map(size_t _capacity, std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) : flat_map(_resource) {
+            reserve(_capacity);
+        }
+
+        ~flat_map() { release(); }
+
+        /**
+         * @brief Copy constructor.
+         *
+         * @details The new map will use the same memory resource as the source.
+         *
+         * @param [in] _other The map to copy from.
+         */
+        flat_map(const flat_map& _other) : flat_map(_other.m_resource) {
+            assign_from(_other);
+        }
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @details The memory resource remains unchanged.
+         *
+         * @param [in] _other The map to copy from.
+         * @return Reference to this map after assignment.
+         */
+        flat_map& operator=(const flat_map& _other) {
+            if (this != &_other) {
+                assign_from(_other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Move constructor.
+         *
+         * @details The new map will steal the storage of the source map.
+         *
+         * @param [in] _other The map to move from.
+         */
+        flat_map(flat_map&& _other) noexcept :
+            m_resource (_other.m_resource),
+            m_slots    (std::exchange(_other.m_slots,    nullptr)),
+            m_capacity (std::exchange(_other.m_capacity, 0U)),
+            m_size     (std::exchange(_other.m_size,     0U)),
+            m_shift    (std::exchange(_other.m_shift,    0U)),
+            m_hash     (std::move(_other.m_hash)) {}
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * @details The memory resource remains unchanged. If both maps share a memory resource, the storage of the
+         *          other map is taken. Otherwise, the entries are moved individually into new storage.
+         *
+         * @param [in] _other The map to move from.
+         * @return Reference to this map after assignment.
+         */
+        flat_map& operator=(flat_map&& _other) {
+
+            if (this != &_other) {
+
+                release();
+
+                if (m_resource->is_equal(*_other.m_resource)) {
+                    m_slots    = std::exchange(_other.m_slots,    nullptr);
+                    m_capacity = std::exchange(_other.m_capacity, 0U);
+                    m_size     = std::exchange(_other.m_size,     0U);
+                    m_shift    = std::exchange(_other.m_shift,    0U);
+                }
+                else {
+                    assign_from(std::move(_other));
+                    _other.release();
+                }
+            }
+
+            return *this;
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Checks if the map is empty.
+         * @return `true` if the map is empty, otherwise `false`.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr bool empty() const noexcept { return m_size == 0U; }
+
+        /**
+         * @brief Retrieves the number of entries currently stored in the map.
+         * @return The number of entries in the map.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr size_t size() const noexcept { return m_size; }
+
+        /**
+         * @brief Retrieves the number of slots in the table.
+         * @return The capacity of the map.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t capacity() const noexcept { return m_capacity; }
+
+        /**
+         * @brief Retrieves the number of bytes which inserting a new key would request from the memory resource.
+         *
+         * @details Non-zero only if the table must grow to accommodate another entry. The storage of the table is
+         *          replaced, rather than extended, so the previous storage remains allocated until the new storage has
+         *          been filled.
+         *
+         * @return The size of the storage which the next insertion would allocate, in bytes.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr size_t growth() const noexcept {
+            return m_capacity == 0U ? storage_size(s_initial_capacity) : (saturated() ? storage_size(m_capacity * 2U) : 0U);
+        }
+
+        /**
+         * @brief Finds the entry with the given key.
+         *
+         * @param [in] _key Key to search for.
+         * @return An iterator to the entry, or `end()` if the key is absent.
+         */
+        [[maybe_unused, nodiscard]] HOT iterator_t find(const K& _key) noexcept { return iterator_t(this, find_index(_key)); }
+
+        /** @copydoc find() */
+        [[maybe_unused, nodiscard]] HOT const_iterator_t find(const K& _key) const noexcept { return const_iterator_t(this, find_index(_key)); }
+
+        /**
+         * @brief Checks whether the map contains an entry with the given key.
+         *
+         * @param [in] _key Key to search for.
+         * @return `true` if the key is present, otherwise `false`.
+         */
+        [[maybe_unused, nodiscard]] HOT bool contains(const K& _key) const noexcept { return find_index(_key) != m_capacity; }
+
+        /**
+         * @brief Inserts an entry constructed from the given arguments, if the key is absent.
+         *
+         * @param [in] _key  Key of the entry.
+         * @param [in] _args Arguments forwarded to the constructor of the mapped value.
+         *
+         * @return A pair of an iterator to the entry with the given key, and whether it was inserted.
+         */
+        template <typename... Args>
+        [[maybe_unused]] HOT std::pair<iterator_t, bool> try_emplace(const K& _key, Args&&... _args) {
+
+            if (m_capacity != 0U) {
+
+                auto    i = home(_key);
+                uint8_t d = 1U;
+
+                while (m_slots[i].m_distance >= d) {
+
+                    if (m_slots[i].m_distance == d && m_slots[i].get()->first == _key) {
+                        return { iterator_t(this, i), false };
+                    }
+
+                    i = next(i);
+                    ++d;
+                }
+
+                if (LIKELY(!saturated())) {
+
+                    auto result = place_at(i, d, value_type(std::piecewise_construct, std::forward_as_tuple(_key), std::forward_as_tuple(std::forward<Args>(_args)...)));
+
+                    if (UNLIKELY(result == m_capacity)) {
+                        result = find_index(_key);
+                    }
+
+                    return { iterator_t(this, result), true };
+                }
+            }
+
+            rehash(m_capacity != 0U ? m_capacity * 2U : s_initial_capacity);
+
+            auto result = place(value_type(std::piecewise_construct, std::forward_as_tuple(_key), std::forward_as_tuple(std::forward<Args>(_args)...)));
+
+            if (UNLIKELY(result == m_capacity)) {
+                result = find_index(_key);
+            }
+
+            return { iterator_t(this, result), true };
+        }
+
+        /**
+         * @brief Retrieves the mapped value of the given key, inserting a value-initialised one if the key is absent.
+         *
+         * @param [in] _key Key of the entry.
+         * @return A reference to the mapped value.
+         */
+        [[maybe_unused]] HOT V& operator[](const K& _key) { return try_emplace(_key).first->second; }
+
+        /**
+         * @brief Erases the entry with the given key, if present.
+         *
+         * @param [in] _key Key of the entry.
+         * @return The number of entries erased, either `0` or `1`.
+         */
+        [[maybe_unused]] HOT size_t erase(const K& _key) noexcept {
+
+            if (const auto i = find_index(_key); i != m_capacity) {
+                erase_at(i);
+                return 1U;
+            }
+
+            return 0U;
+        }
+
+        /**
+         * @brief Erases the entry at the given position.
+         *
+         * @param [in] _it Iterator to the entry. Must be dereferenceable.
+         */
+        [[maybe_unused]] HOT void erase(const_iterator_t _it) noexcept {
+            assert(_it.m_owner == this && _it.m_index < m_capacity && m_slots[_it.m_index].m_distance != 0U && "Invalid iterator.");
+            erase_at(_it.m_index);
+        }
+
+        /**
+         * @brief Reserves storage for at least the specified number of entries.
+         * @param _capacity The minimum number of entries the map should be able to hold without growing.
+         */
+        [[maybe_unused]] void reserve(size_t _capacity) {
+
+            if (const auto capacity = capacity_for(_capacity); capacity > m_capacity) {
+                rehash(capacity);
+            }
+        }
+
+        /**
+         * @brief Clears all entries from the map.
+         * @note Storage is retained for reuse.
+         */
+        [[maybe_unused]] void clear() noexcept {
+
+            if (m_slots != nullptr) {
+                destroy_all();
+            }
+        }
+
+        [[maybe_unused, nodiscard]] constexpr       iterator_t  begin()       noexcept { return       iterator_t(this, 0U).settle(); }
+        [[maybe_unused, nodiscard]] constexpr const_iterator_t  begin() const noexcept { return const_iterator_t(this, 0U).settle(); }
+        [[maybe_unused, nodiscard]] constexpr const_iterator_t cbegin() const noexcept { return begin(); }
+
+        [[maybe_unused, nodiscard]] constexpr       iterator_t  end()       noexcept { return       iterator_t(this, m_capacity); }
+        [[maybe_unused, nodiscard]] constexpr const_iterator_t  end() const noexcept { return const_iterator_t(this, m_capacity); }
+        [[maybe_unused, nodiscard]] constexpr const_iterator_t cend() const noexcept { return end(); }
+    };
+
+} //chdr
+
+#endif //CHDR_FLAT_MAP_HPP
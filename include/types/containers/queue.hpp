@@ -13,9 +13,15 @@
  * @file queue.hpp
  */
 
+#include <cassert>
 #include <cstddef>
-#include <deque>
+#include <iterator>
+#include <memory>
 #include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "../../utils/utils.hpp"
 
 // ReSharper disable once CppUnusedIncludeDirective
 #include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
@@ -27,21 +33,175 @@ namespace chdr {
      * @class queue
      * @brief Implementation of a First-In-First-Out (FIFO) container.
      *
-     * @details Manages a collection of elements, maintaining a FIFO ordering.
+     * @details Manages a collection of elements, maintaining a FIFO ordering.\n\n
+     *
+     *          Elements are stored in a single contiguous ring buffer whose capacity is a power of two, so that the
+     *          position of an element is found by masking rather than by walking a map of blocks, and pushing or
+     *          popping an element does not allocate. When full, the capacity of the buffer is doubled, and the
+     *          elements are moved to the new buffer in FIFO order.
      *
      * @tparam T  The type of elements stored in the queue.
      *
      * @note This class uses polymorphic memory resources (`std::pmr::memory_resource`).
      * @note Follows an STL-like design and supports iterators.
+     * @note Storage is only released by `shrink_to_fit()`, assignment from another queue, or destruction.
      */
     template <typename T>
     class queue {
 
     private:
 
-        using queue_t = std::pmr::deque<T>;
+        /** @brief Capacity of the buffer when the first element is pushed. */
+        static constexpr size_t s_initial_capacity = utils::max(static_cast<size_t>(64U) / sizeof(T), static_cast<size_t>(8U));
+
+        std::pmr::polymorphic_allocator<T> m_allocator;
+
+        T*     m_data;
+        size_t m_capacity;
+        size_t m_head;
+        size_t m_size;
+
+        [[nodiscard]] HOT constexpr size_t wrap(size_t _index) const noexcept { return _index & (m_capacity - 1U); }
+
+        [[nodiscard]] static constexpr size_t ceil_pow2(size_t _value) noexcept {
+
+            size_t result = 1U;
+
+            while (result < _value) {
+                result <<= 1U;
+            }
+
+            return result;
+        }
+
+        void destroy_all() noexcept {
+
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = 0U; i < m_size; ++i) {
+                    std::destroy_at(m_data + wrap(m_head + i));
+                }
+            }
+
+            m_head = 0U;
+            m_size = 0U;
+        }
+
+        void release() noexcept {
+
+            destroy_all();
+
+            if (m_data != nullptr) {
+                m_allocator.deallocate(m_data, m_capacity);
+            }
+
+            m_data     = nullptr;
+            m_capacity = 0U;
+        }
+
+        /** @brief Moves the elements into a buffer of the given (power of two) capacity, unwrapping them. */
+        void reallocate(size_t _capacity) {
+
+            assert(_capacity >= m_size && (_capacity & (_capacity - 1U)) == 0U && "Invalid capacity.");
+
+            T* data = m_allocator.allocate(_capacity);
+
+            for (size_t i = 0U; i < m_size; ++i) {
+
+                T& item = m_data[wrap(m_head + i)];
+
+                ::new (static_cast<void*>(data + i)) T(std::move_if_noexcept(item));
+                std::destroy_at(&item);
+            }
+
+            if (m_data != nullptr) {
+                m_allocator.deallocate(m_data, m_capacity);
+            }
+
+            m_data     = data;
+            m_capacity = _capacity;
+            m_head     = 0U;
+        }
+
+        template <typename U>
+        void assign_from(U&& _other) {
+
+            if (_other.m_size > m_capacity) {
+                release();
+                reallocate(ceil_pow2(_other.m_size));
+            }
+            else {
+                destroy_all();
+            }
+
+            for (size_t i = 0U; i < _other.m_size; ++i) {
+
+                if constexpr (std::is_lvalue_reference_v<U>) {
+                    ::new (static_cast<void*>(m_data + i)) T(_other.m_data[_other.wrap(_other.m_head + i)]);
+                }
+                else {
+                    ::new (static_cast<void*>(m_data + i)) T(std::move(_other.m_data[_other.wrap(_other.m_head + i)]));
+                }
+
+                ++m_size;
+            }
+        }
+
+        template <bool Const>
+        class iterator_base final {
+
+            friend class queue;
+            friend class iterator_base<!Const>;
+
+            using owner_t = std::conditional_t<Const, const queue, queue>;
+
+            owner_t* m_owner;
+            size_t   m_offset;
+
+            constexpr iterator_base(owner_t* _owner, size_t _offset) noexcept : m_owner(_owner), m_offset(_offset) {}
+
+        public:
+
+            using iterator_category = std::random_access_iterator_tag;
+            using        value_type = T;
+            using   difference_type = std::ptrdiff_t;
+            using           pointer = std::conditional_t<Const, const T*, T*>;
+            using         reference = std::conditional_t<Const, const T&, T&>;
+
+            constexpr iterator_base() noexcept : m_owner(nullptr), m_offset(0U) {}
+
+            // ReSharper disable once CppNonExplicitConvertingConstructor
+            template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+            constexpr iterator_base(const iterator_base<OtherConst>& _other) noexcept : m_owner(_other.m_owner), m_offset(_other.m_offset) {} // NOLINT(*-explicit-constructor)
+
+            [[nodiscard]] HOT constexpr reference operator*() const noexcept { return m_owner->m_data[m_owner->wrap(m_owner->m_head + m_offset)]; }
+            [[nodiscard]] HOT constexpr pointer  operator->() const noexcept { return &**this; }
+
+            [[nodiscard]] constexpr reference operator[](difference_type _n) const noexcept { return *(*this + _n); }
+
+            HOT constexpr iterator_base& operator++() noexcept { ++m_offset; return *this; }
+            HOT constexpr iterator_base& operator--() noexcept { --m_offset; return *this; }
+
+            constexpr iterator_base operator++(int) noexcept { auto result = *this; ++m_offset; return result; }
+            constexpr iterator_base operator--(int) noexcept { auto result = *this; --m_offset; return result; }
+
+            constexpr iterator_base& operator+=(difference_type _n) noexcept { m_offset = static_cast<size_t>(static_cast<difference_type>(m_offset) + _n); return *this; }
+            constexpr iterator_base& operator-=(difference_type _n) noexcept { return *this += -_n; }
 
-        queue_t c;
+            [[nodiscard]] friend constexpr iterator_base operator+(iterator_base _it, difference_type _n) noexcept { return _it += _n; }
+            [[nodiscard]] friend constexpr iterator_base operator+(difference_type _n, iterator_base _it) noexcept { return _it += _n; }
+            [[nodiscard]] friend constexpr iterator_base operator-(iterator_base _it, difference_type _n) noexcept { return _it -= _n; }
+
+            [[nodiscard]] friend constexpr difference_type operator-(const iterator_base& _a, const iterator_base& _b) noexcept {
+                return static_cast<difference_type>(_a.m_offset) - static_cast<difference_type>(_b.m_offset);
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(const iterator_base& _a, const iterator_base& _b) noexcept { return _a.m_offset == _b.m_offset; }
+            [[nodiscard]] friend constexpr bool operator!=(const iterator_base& _a, const iterator_base& _b) noexcept { return _a.m_offset != _b.m_offset; }
+            [[nodiscard]] friend constexpr bool operator< (const iterator_base& _a, const iterator_base& _b) noexcept { return _a.m_offset <  _b.m_offset; }
+            [[nodiscard]] friend constexpr bool operator> (const iterator_base& _a, const iterator_base& _b) noexcept { return _a.m_offset >  _b.m_offset; }
+            [[nodiscard]] friend constexpr bool operator<=(const iterator_base& _a, const iterator_base& _b) noexcept { return _a.m_offset <= _b.m_offset; }
+            [[nodiscard]] friend constexpr bool operator>=(const iterator_base& _a, const iterator_base& _b) noexcept { return _a.m_offset >= _b.m_offset; }
+        };
 
     public:
 
@@ -55,13 +215,30 @@ namespace chdr {
          *
          * @details This constructor initialises the queue, with support for a custom memory resource.
          *          If no memory resource is explicitly provided, the default memory resource is used.
+         *          No memory is allocated until the first element is pushed.
          *
          * @param [in, out] _resource A pointer to the memory resource to be used for
          *                       memory allocation. Defaults to the global default polymorphic memory resource.
          */
-        [[maybe_unused, nodiscard]] explicit constexpr queue(std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) : c(_resource) {}
+        [[maybe_unused, nodiscard]] explicit queue(std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) noexcept :
+            m_allocator(_resource),
+            m_data     (nullptr),
+            m_capacity (0U),
+            m_head     (0U),
+            m_size     (0U) {}
+
+        /**
+         * @brief Constructs a new queue with a specified initial capacity.
+         *
+         * @param [in] _capacity The number of elements to reserve storage for.
+         * @param [in] _resource (optional) Pointer to the memory resource to be used for memory allocations.
+         *                       If not provided, the default memory resource is utilised.
+         */
+        [[maybe_unused, nodiscard]] explicit queue(size_t _capacity, std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) : queue(_resource) {
+            reserve(_capacity);
+        }
 
-        ~queue() = default;
+        ~queue() { release(); }
 
         /**
          * @brief Copy constructor.
@@ -71,7 +248,9 @@ namespace chdr {
          *
          * @param [in] _other The queue to copy from.
          */
-        constexpr queue(const queue& _other) : c(_other.c, _other.c.get_allocator().resource()) {}
+        queue(const queue& _other) : queue(_other.m_allocator.resource()) {
+            assign_from(_other);
+        }
 
         /**
          * @brief Copy assignment operator.
@@ -82,9 +261,9 @@ namespace chdr {
          * @param [in] _other The queue to copy from.
          * @return Reference to this queue after assignment.
          */
-        constexpr queue& operator=(const queue& _other) {
+        queue& operator=(const queue& _other) {
             if (this != &_other) {
-                c = queue_t(_other.c, c.get_allocator().resource());
+                assign_from(_other);
             }
             return *this;
         }
@@ -97,21 +276,41 @@ namespace chdr {
          *
          * @param [in] _other The queue to move from.
          */
-        constexpr queue(queue&& _other) noexcept : c(std::move(_other.c)) {}
+        queue(queue&& _other) noexcept :
+            m_allocator(_other.m_allocator.resource()),
+            m_data     (std::exchange(_other.m_data,     nullptr)),
+            m_capacity (std::exchange(_other.m_capacity, 0U)),
+            m_head     (std::exchange(_other.m_head,     0U)),
+            m_size     (std::exchange(_other.m_size,     0U)) {}
 
         /**
          * @brief Move assignment operator.
          *
          * @details Replaces the contents of this queue with the contents of another queue.
-         *          The memory resource remains unchanged, and the contents are moved.
+         *          The memory resource remains unchanged. If both queues share a memory resource, the storage of the
+         *          other queue is taken. Otherwise, the contents are moved individually into new storage.
          *
          * @param [in] _other The queue to move from.
          * @return Reference to this queue after assignment.
          */
-        constexpr queue& operator=(queue&& _other) noexcept {
+        queue& operator=(queue&& _other) {
+
             if (this != &_other) {
-                c = std::move(_other.c);
+
+                release();
+
+                if (m_allocator.resource()->is_equal(*_other.m_allocator.resource())) {
+                    m_data     = std::exchange(_other.m_data,     nullptr);
+                    m_capacity = std::exchange(_other.m_capacity, 0U);
+                    m_head     = std::exchange(_other.m_head,     0U);
+                    m_size     = std::exchange(_other.m_size,     0U);
+                }
+                else {
+                    assign_from(std::move(_other));
+                    _other.release();
+                }
             }
+
             return *this;
         }
 
@@ -123,13 +322,19 @@ namespace chdr {
          * @brief Checks if the queue is empty.
          * @return `true` if the queue is empty, otherwise `false`.
          */
-        [[maybe_unused, nodiscard]] HOT constexpr bool empty() const noexcept { return c.empty(); }
+        [[maybe_unused, nodiscard]] HOT constexpr bool empty() const noexcept { return m_size == 0U; }
 
         /**
          * @brief Retrieves the number of elements currently stored in the queue.
          * @return The number of elements in the queue.
          */
-        [[maybe_unused, nodiscard]] constexpr size_t size() const noexcept { return c.size(); }
+        [[maybe_unused, nodiscard]] constexpr size_t size() const noexcept { return m_size; }
+
+        /**
+         * @brief Retrieves the number of elements the queue can hold without reallocating.
+         * @return The capacity of the queue.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t capacity() const noexcept { return m_capacity; }
 
         /**
          * @brief Provides access to the first element in the container.
@@ -179,7 +384,7 @@ namespace chdr {
          */
         [[maybe_unused, nodiscard]] HOT constexpr T& top() noexcept {
             assert(!empty() && "Container is empty");
-            return c.front();
+            return m_data[m_head];
         }
 
         /**
@@ -196,27 +401,57 @@ namespace chdr {
          */
         [[maybe_unused, nodiscard]] HOT constexpr const T& top() const noexcept {
             assert(!empty() && "Container is empty");
-            return c.front();
+            return m_data[m_head];
+        }
+
+        /**
+         * @brief Provides access to the last element in the container.
+         *
+         * @details Returns a reference to the most recently added element.
+         *          The queue must not be empty when this function is called.
+         *
+         * @pre The container must not be empty before calling this function.
+         * @return A reference to the last element in the container.
+         * @warning Invokes undefined behaviour if the container is empty.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr T& back() noexcept {
+            assert(!empty() && "Container is empty");
+            return m_data[wrap(m_head + m_size - 1U)];
+        }
+
+        /**
+         * @brief Provides access to the last element in the container.
+         *
+         * @details Returns a reference to the most recently added element.
+         *          The queue must not be empty when this function is called.
+         *
+         * @pre The container must not be empty before calling this function.
+         * @return An immutable reference to the last element in the container.
+         * @warning Invokes undefined behaviour if the container is empty.
+         */
+        [[maybe_unused, nodiscard]] HOT constexpr const T& back() const noexcept {
+            assert(!empty() && "Container is empty");
+            return m_data[wrap(m_head + m_size - 1U)];
         }
 
         /**
          * @brief Adds an element to the queue.
          * @param [in] _value  A constant reference to the value to add to the queue.
          */
-        [[maybe_unused]] HOT constexpr void push(const T& _value) { c.push(_value); }
+        [[maybe_unused]] HOT void push(const T& _value) { emplace(_value); }
 
         /**
          * @brief Adds an element to the queue, using move semantics.
          * @param [in] _value  A constant reference to the value to add to the queue.
          */
-        [[maybe_unused]] HOT constexpr void push(T&& _value) { c.push(std::move(_value)); }
+        [[maybe_unused]] HOT void push(T&& _value) { emplace(std::move(_value)); }
 
         /**
          * @brief Constructs an element in place, adding it to the queue.
          *
          * @details Constructs a new element at the back of the queue using the provided arguments.
          *          The arguments are perfectly forwarded to the constructor of the element,
-         *          avoiding unnecessary copies or moves.
+         *          avoiding unnecessary copies or moves. If the queue is full, its capacity is doubled first.
          *
          * @tparam Args Types of the arguments to be forwarded to the constructor of the element.
          *
@@ -224,8 +459,14 @@ namespace chdr {
          *                   These are perfectly forwarded to the element's constructor.
          */
         template <typename... Args>
-        [[maybe_unused]] HOT constexpr void emplace(Args&&... _args) {
-            c.emplace_back(std::forward<Args>(_args)...);
+        [[maybe_unused]] HOT void emplace(Args&&... _args) {
+
+            if (UNLIKELY(m_size == m_capacity)) {
+                reallocate(m_capacity != 0U ? m_capacity * 2U : s_initial_capacity);
+            }
+
+            ::new (static_cast<void*>(m_data + wrap(m_head + m_size))) T(std::forward<Args>(_args)...);
+            ++m_size;
         }
 
         /**
@@ -237,47 +478,80 @@ namespace chdr {
          * @pre The container must not be empty before calling this function.
          * @warning Invokes undefined behaviour if the container is empty.
          */
-        [[maybe_unused]] HOT constexpr void pop() {
+        [[maybe_unused]] HOT void pop() noexcept {
             assert(!empty() && "Container is empty");
-            c.pop_front();
+
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                std::destroy_at(m_data + m_head);
+            }
+
+            m_head = wrap(m_head + 1U);
+            --m_size;
+        }
+
+        /**
+         * @brief Reserves storage for at least the specified number of elements.
+         *
+         * @details The capacity is rounded up to the next power of two. If the requested capacity is not greater
+         *          than the current capacity, the call has no effect.
+         *
+         * @param _capacity The minimum number of elements the queue should be able to hold.
+         */
+        [[maybe_unused]] void reserve(size_t _capacity) {
+
+            if (_capacity > m_capacity) {
+                reallocate(ceil_pow2(_capacity));
+            }
         }
 
         /**
          * @brief Clears all elements from the queue.
          *
-         * @note The operation leaves the queue in a valid but empty state.
+         * @note The operation leaves the queue in a valid but empty state. Storage is retained for reuse.
          *
          * @warning Ensure there are no pending references to the elements contained
          *          in the queue prior to invoking this method, as they will no longer
          *          be valid after the queue is cleared.
          */
-        [[maybe_unused]] constexpr void clear() {
-            c = std::move(decltype(c){});
+        [[maybe_unused]] void clear() noexcept { destroy_all(); }
+
+        /**
+         * @brief Reduces the capacity of the queue to the smallest power of two able to hold its elements.
+         * @details Releases all storage if the queue is empty.
+         */
+        [[maybe_unused]] void shrink_to_fit() {
+
+            if (m_size == 0U) {
+                release();
+            }
+            else if (const auto capacity = ceil_pow2(m_size); capacity < m_capacity) {
+                reallocate(capacity);
+            }
         }
 
-        using               iterator_t = typename decltype(c)::              iterator;
-        using         const_iterator_t = typename decltype(c)::        const_iterator;
-        using       reverse_iterator_t = typename decltype(c)::      reverse_iterator;
-        using const_reverse_iterator_t = typename decltype(c)::const_reverse_iterator;
+        using               iterator_t = iterator_base<false>;
+        using         const_iterator_t = iterator_base<true>;
+        using       reverse_iterator_t = std::reverse_iterator<      iterator_t>;
+        using const_reverse_iterator_t = std::reverse_iterator<const_iterator_t>;
 
-        [[maybe_unused, nodiscard]] constexpr       iterator_t  begin()       noexcept { return c.begin();  }
-        [[maybe_unused, nodiscard]] constexpr const_iterator_t  begin() const noexcept { return c.begin();  }
-        [[maybe_unused, nodiscard]] constexpr const_iterator_t cbegin() const noexcept { return c.cbegin(); }
+        [[maybe_unused, nodiscard]] constexpr       iterator_t  begin()       noexcept { return       iterator_t(this, 0U); }
+        [[maybe_unused, nodiscard]] constexpr const_iterator_t  begin() const noexcept { return const_iterator_t(this, 0U); }
+        [[maybe_unused, nodiscard]] constexpr const_iterator_t cbegin() const noexcept { return begin(); }
 
-        [[maybe_unused, nodiscard]] constexpr       iterator_t  end()       noexcept { return c.end();  }
-        [[maybe_unused, nodiscard]] constexpr const_iterator_t  end() const noexcept { return c.end();  }
-        [[maybe_unused, nodiscard]] constexpr const_iterator_t cend() const noexcept { return c.cend(); }
+        [[maybe_unused, nodiscard]] constexpr       iterator_t  end()       noexcept { return       iterator_t(this, m_size); }
+        [[maybe_unused, nodiscard]] constexpr const_iterator_t  end() const noexcept { return const_iterator_t(this, m_size); }
+        [[maybe_unused, nodiscard]] constexpr const_iterator_t cend() const noexcept { return end(); }
 
-        [[maybe_unused, nodiscard]] constexpr       reverse_iterator_t  rbegin()       noexcept { return c.rbegin();  }
-        [[maybe_unused, nodiscard]] constexpr const_reverse_iterator_t  rbegin() const noexcept { return c.rbegin();  }
-        [[maybe_unused, nodiscard]] constexpr const_reverse_iterator_t crbegin() const noexcept { return c.crbegin(); }
+        [[maybe_unused, nodiscard]] constexpr       reverse_iterator_t  rbegin()       noexcept { return       reverse_iterator_t(end()); }
+        [[maybe_unused, nodiscard]] constexpr const_reverse_iterator_t  rbegin() const noexcept { return const_reverse_iterator_t(end()); }
+        [[maybe_unused, nodiscard]] constexpr const_reverse_iterator_t crbegin() const noexcept { return rbegin(); }
 
-        [[maybe_unused, nodiscard]] constexpr       reverse_iterator_t  rend()       noexcept { return c.rend();  }
-        [[maybe_unused, nodiscard]] constexpr const_reverse_iterator_t  rend() const noexcept { return c.rend();  }
-        [[maybe_unused, nodiscard]] constexpr const_reverse_iterator_t crend() const noexcept { return c.crend(); }
+        [[maybe_unused, nodiscard]] constexpr       reverse_iterator_t  rend()       noexcept { return       reverse_iterator_t(begin()); }
+        [[maybe_unused, nodiscard]] constexpr const_reverse_iterator_t  rend() const noexcept { return const_reverse_iterator_t(begin()); }
+        [[maybe_unused, nodiscard]] constexpr const_reverse_iterator_t crend() const noexcept { return rend(); }
 
     };
 
 } //chdr
 
-#endif //QUEUE_HPP
\ No newline at end of file
+#endif //QUEUE_HPP
@@ -0,0 +1,374 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_RLE_PATH_HPP
+#define CHDR_RLE_PATH_HPP
+
+/**
+ * @file rle_path.hpp
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include "../../utils/utils.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr {
+
+    /**
+     * @nosubgrouping
+     * @class rle_path
+     * @brief A path stored as a starting coordinate followed by run-length-encoded directions.
+     *
+     * @details Grid paths consist mostly of long straight or diagonal runs. Rather than storing a coordinate for every
+     *          node, this container stores the first coordinate, and then a sequence of (direction, length) runs.
+     *          A direction is a single integer encoding the sign of the step along each axis, so a K-dimensional
+     *          move costs a byte or two regardless of the width of the coordinate type.\n\n
+     *
+     *          Directions and lengths are stored in separate arrays, and iteration expands the runs back into
+     *          coordinates lazily, one step at a time. No coordinate vector is ever materialised unless `decode()`
+     *          is called explicitly.\n\n
+     *
+     *          Runs longer than `count_t` can represent are split across several runs.
+     *
+     * @code
+     *
+     * // Encode the result of a search directly, without building a coordinate vector:
+     * const auto path = chdr::solvers::solver<chdr::solvers::astar, params>::solve_as<chdr::rle_path<coord_t>>(args);
+     *
+     * for (const auto& coord : path) {
+     *     // ...
+     * }
+     *
+     * @endcode
+     *
+     * @pre Consecutive coordinates pushed to the path must be connected by a straight or diagonal line.
+     *
+     * @tparam coord_t Coordinate type of the path.
+     * @tparam count_t Unsigned integral type used to store the length of each run.
+     *
+     * @note This class uses polymorphic memory resources (`std::pmr::memory_resource`).
+     *
+     * @see waypoint_path
+     */
+    template <typename coord_t, typename count_t = uint16_t>
+    class rle_path {
+
+        static_assert(std::is_integral_v<count_t> && std::is_unsigned_v<count_t>, "count_t must be an unsigned integral type.");
+
+    public:
+
+        using value_type = coord_t;
+        using  size_type = size_t;
+
+    private:
+
+        using scalar_t = typename coord_t::value_type;
+
+        static constexpr size_t Kd = std::tuple_size_v<coord_t>;
+
+    public:
+
+        /**
+         * @brief Integral type used to store a direction.
+         * @details Each direction is a base-3 number with one digit per axis, so its width is chosen to fit 3^Kd values.
+         */
+        using direction_type = std::conditional_t<(Kd <=  5U), uint8_t,
+                               std::conditional_t<(Kd <= 10U), uint16_t,
+                                                               uint32_t>>;
+
+    private:
+
+        static_assert(Kd <= 20U, "rle_path supports at most 20 dimensions.");
+
+        /** @brief Number of distinct directions, including the null direction. */
+        static constexpr auto s_directions = utils::powui<uint64_t>(3U, Kd);
+
+        coord_t m_start;
+        coord_t m_last;
+         size_t m_size;
+
+        std::pmr::vector<direction_type> m_directions;
+        std::pmr::vector<count_t>        m_lengths;
+
+        [[nodiscard]] HOT static constexpr direction_type encode(const coord_t& _from, const coord_t& _to, size_t& _steps) noexcept {
+
+            direction_type result { 0U };
+            direction_type place  { 1U };
+
+            _steps = 0U;
+
+            for (size_t i = 0U; i < Kd; ++i) {
+
+                const auto delta = static_cast<int64_t>(_to[i]) - static_cast<int64_t>(_from[i]);
+
+                result += static_cast<direction_type>(static_cast<direction_type>(utils::sign<int64_t>(delta) + 1) * place);
+                place  *= static_cast<direction_type>(3U);
+
+                const auto magnitude = static_cast<size_t>(utils::abs(delta));
+
+                assert((magnitude == 0U || _steps == 0U || magnitude == _steps) && "Consecutive coordinates must be connected by a straight or diagonal line.");
+
+                _steps = utils::max(_steps, magnitude);
+            }
+
+            return result;
+        }
+
+        HOT static constexpr void step(coord_t& _coord, direction_type _direction) noexcept {
+
+            for (size_t i = 0U; i < Kd; ++i) {
+                _coord[i] = static_cast<scalar_t>(_coord[i] + static_cast<scalar_t>(static_cast<int>(_direction % 3U) - 1));
+                _direction /= 3U;
+            }
+        }
+
+    public:
+
+        /**
+         * @class const_iterator
+         * @brief Forward iterator which expands the runs of the path into coordinates.
+         */
+        class const_iterator final {
+
+            friend rle_path;
+
+        public:
+
+            using iterator_category = std::forward_iterator_tag;
+            using        value_type = coord_t;
+            using   difference_type = std::ptrdiff_t;
+            using           pointer = const coord_t*;
+            using         reference = const coord_t&;
+
+        private:
+
+            const rle_path* m_path;
+
+            coord_t m_coord;
+             size_t m_run;
+             size_t m_offset;
+             size_t m_position;
+
+            constexpr const_iterator(const rle_path* _path, size_t _position) noexcept :
+                m_path    (_path),
+                m_coord   (_path->m_start),
+                m_run     (0U),
+                m_offset  (0U),
+                m_position(_position) {}
+
+        public:
+
+            [[nodiscard]] constexpr const_iterator() noexcept :
+                m_path    (nullptr),
+                m_coord   (),
+                m_run     (0U),
+                m_offset  (0U),
+                m_position(0U) {}
+
+            [[nodiscard]] HOT constexpr reference operator*() const noexcept { return m_coord; }
+
+            [[nodiscard]] HOT constexpr pointer operator->() const noexcept { return &m_coord; }
+
+            HOT constexpr const_iterator& operator++() noexcept {
+
+                if (LIKELY(++m_position < m_path->m_size)) {
+
+                    step(m_coord, m_path->m_directions[m_run]);
+
+                    if (++m_offset == static_cast<size_t>(m_path->m_lengths[m_run])) {
+                        m_offset = 0U;
+                        ++m_run;
+                    }
+                }
+
+                return *this;
+            }
+
+            constexpr const_iterator operator++(int) noexcept {
+                auto result = *this;
+                ++(*this);
+                return result;
+            }
+
+            [[nodiscard]] HOT friend constexpr bool operator==(const const_iterator& _a, const const_iterator& _b) noexcept { return _a.m_position == _b.m_position; }
+            [[nodiscard]] HOT friend constexpr bool operator!=(const const_iterator& _a, const const_iterator& _b) noexcept { return _a.m_position != _b.m_position; }
+        };
+
+        using iterator = const_iterator;
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Constructs an empty path.
+         * @param [in, out] _resource Memory resource used to store the runs of the path.
+         */
+        [[maybe_unused, nodiscard]] explicit rle_path(std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            m_start     (),
+            m_last      (),
+            m_size      (0U),
+            m_directions(_resource),
+            m_lengths   (_resource) {}
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Appends a coordinate to the end of the path.
+         *
+         * @details The step from the previous coordinate is merged into the last run if it shares its direction.
+         *          Coordinates further than one step apart are expanded into the same number of unit steps.
+         *
+         * @param [in] _coord The coordinate to append.
+         *
+         * @pre `_coord` must be connected to the previous coordinate by a straight or diagonal line.
+         */
+        HOT void push_back(const coord_t& _coord) {
+
+            if (UNLIKELY(m_size == 0U)) {
+                m_start = _coord;
+                m_last  = _coord;
+                m_size  = 1U;
+
+                return;
+            }
+
+            size_t steps { 0U };
+            const auto direction = encode(m_last, _coord, steps);
+
+            if (steps == 0U) {
+                return;
+            }
+
+            m_last  = _coord;
+            m_size += steps;
+
+            constexpr auto limit = static_cast<size_t>(std::numeric_limits<count_t>::max());
+
+            if (!m_directions.empty() && m_directions.back() == direction) {
+
+                const auto available = utils::min(limit - static_cast<size_t>(m_lengths.back()), steps);
+
+                m_lengths.back() = static_cast<count_t>(m_lengths.back() + available);
+                steps -= available;
+            }
+
+            while (steps != 0U) {
+
+                const auto length = utils::min(limit, steps);
+
+                m_directions.emplace_back(direction);
+                m_lengths   .emplace_back(static_cast<count_t>(length));
+
+                steps -= length;
+            }
+        }
+
+        /**
+         * @brief Reverses the order of the path in place.
+         * @details Runs are reversed and their directions inverted, so no coordinates are expanded.
+         */
+        void reverse() noexcept {
+
+            if (m_size != 0U) {
+
+                std::swap(m_start, m_last);
+
+                std::reverse(m_directions.begin(), m_directions.end());
+                std::reverse(m_lengths   .begin(), m_lengths   .end());
+
+                // Inverting every digit d of the base-3 code to 2 - d yields (3^Kd - 1) - code.
+                for (auto& direction : m_directions) {
+                    direction = static_cast<direction_type>((s_directions - 1U) - direction);
+                }
+            }
+        }
+
+        /**
+         * @brief Removes all coordinates from the path.
+         */
+        void clear() noexcept {
+            m_size = 0U;
+            m_directions.clear();
+            m_lengths   .clear();
+        }
+
+        /**
+         * @brief Checks if the path is empty.
+         */
+        [[maybe_unused, nodiscard]] constexpr bool empty() const noexcept { return m_size == 0U; }
+
+        /**
+         * @brief Number of coordinates in the expanded path.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t size() const noexcept { return m_size; }
+
+        /**
+         * @brief Number of runs stored by the path.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t runs() const noexcept { return m_directions.size(); }
+
+        /**
+         * @brief First coordinate of the path.
+         * @pre The path must not be empty.
+         */
+        [[maybe_unused, nodiscard]] constexpr const coord_t& front() const noexcept {
+            assert(!empty() && "Path is empty.");
+            return m_start;
+        }
+
+        /**
+         * @brief Last coordinate of the path.
+         * @pre The path must not be empty.
+         */
+        [[maybe_unused, nodiscard]] constexpr const coord_t& back() const noexcept {
+            assert(!empty() && "Path is empty.");
+            return m_last;
+        }
+
+        /**
+         * @brief Direction codes of each run.
+         */
+        [[maybe_unused, nodiscard]] constexpr const std::pmr::vector<direction_type>& directions() const noexcept { return m_directions; }
+
+        /**
+         * @brief Lengths (in steps) of each run.
+         */
+        [[maybe_unused, nodiscard]] constexpr const std::pmr::vector<count_t>& lengths() const noexcept { return m_lengths; }
+
+        /**
+         * @brief Expands the path into a vector of coordinates.
+         */
+        [[maybe_unused, nodiscard]] std::vector<coord_t> decode() const {
+            return { begin(), end() };
+        }
+
+        [[maybe_unused, nodiscard]] const_iterator  begin() const noexcept { return { this, 0U     }; }
+        [[maybe_unused, nodiscard]] const_iterator    end() const noexcept { return { this, m_size }; }
+        [[maybe_unused, nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+        [[maybe_unused, nodiscard]] const_iterator   cend() const noexcept { return   end(); }
+    };
+
+} //chdr
+
+#endif //CHDR_RLE_PATH_HPP
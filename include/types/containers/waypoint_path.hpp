@@ -0,0 +1,307 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_WAYPOINT_PATH_HPP
+#define CHDR_WAYPOINT_PATH_HPP
+
+/**
+ * @file waypoint_path.hpp
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <vector>
+
+#include "../../utils/utils.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr {
+
+    /**
+     * @nosubgrouping
+     * @class waypoint_path
+     * @brief A path stored as the coordinates at which it changes direction.
+     *
+     * @details Only the first and last coordinates, and those at which the direction of travel changes, are stored.
+     *          Intermediate coordinates are implied by the straight or diagonal line between consecutive waypoints,
+     *          and are produced lazily during iteration.\n\n
+     *
+     *          This is the natural representation of the output of jump point searches, and is also suited to
+     *          consumers which only need to steer towards the next turn.
+     *
+     * @code
+     *
+     * const auto path = chdr::solvers::solver<chdr::solvers::astar, params>::solve_as<chdr::waypoint_path<coord_t>>(args);
+     *
+     * for (const auto& turn : path.waypoints()) {
+     *     // ...
+     * }
+     *
+     * @endcode
+     *
+     * @pre Consecutive coordinates pushed to the path must be connected by a straight or diagonal line.
+     *
+     * @tparam coord_t Coordinate type of the path.
+     *
+     * @note This class uses polymorphic memory resources (`std::pmr::memory_resource`).
+     *
+     * @see rle_path
+     */
+    template <typename coord_t>
+    class waypoint_path {
+
+    public:
+
+        using value_type = coord_t;
+        using  size_type = size_t;
+
+    private:
+
+        using scalar_t = typename coord_t::value_type;
+        using  delta_t = std::array<int8_t, std::tuple_size_v<coord_t>>;
+
+        static constexpr size_t Kd = std::tuple_size_v<coord_t>;
+
+        std::pmr::vector<coord_t> m_points;
+
+        size_t m_size;
+
+        [[nodiscard]] HOT static constexpr delta_t direction(const coord_t& _from, const coord_t& _to, size_t& _steps) noexcept {
+
+            delta_t result {};
+
+            _steps = 0U;
+
+            for (size_t i = 0U; i < Kd; ++i) {
+
+                const auto delta = static_cast<int64_t>(_to[i]) - static_cast<int64_t>(_from[i]);
+
+                result[i] = static_cast<int8_t>(utils::sign<int64_t>(delta));
+
+                const auto magnitude = static_cast<size_t>(utils::abs(delta));
+
+                assert((magnitude == 0U || _steps == 0U || magnitude == _steps) && "Consecutive coordinates must be connected by a straight or diagonal line.");
+
+                _steps = utils::max(_steps, magnitude);
+            }
+
+            return result;
+        }
+
+    public:
+
+        /**
+         * @class const_iterator
+         * @brief Forward iterator which expands the segments between waypoints into coordinates.
+         */
+        class const_iterator final {
+
+            friend waypoint_path;
+
+        public:
+
+            using iterator_category = std::forward_iterator_tag;
+            using        value_type = coord_t;
+            using   difference_type = std::ptrdiff_t;
+            using           pointer = const coord_t*;
+            using         reference = const coord_t&;
+
+        private:
+
+            const waypoint_path* m_path;
+
+            coord_t m_coord;
+            delta_t m_delta;
+             size_t m_segment;
+             size_t m_position;
+
+            constexpr const_iterator(const waypoint_path* _path, size_t _position) noexcept :
+                m_path    (_path),
+                m_coord   (_path->m_points.empty() ? coord_t{} : _path->m_points.front()),
+                m_delta   (),
+                m_segment (0U),
+                m_position(_position)
+            {
+                if (m_path->m_points.size() > 1U) {
+                    size_t steps { 0U };
+                    m_delta = direction(m_path->m_points[0U], m_path->m_points[1U], steps);
+                }
+            }
+
+        public:
+
+            [[nodiscard]] constexpr const_iterator() noexcept :
+                m_path    (nullptr),
+                m_coord   (),
+                m_delta   (),
+                m_segment (0U),
+                m_position(0U) {}
+
+            [[nodiscard]] HOT constexpr reference operator*() const noexcept { return m_coord; }
+
+            [[nodiscard]] HOT constexpr pointer operator->() const noexcept { return &m_coord; }
+
+            HOT constexpr const_iterator& operator++() noexcept {
+
+                if (LIKELY(++m_position < m_path->m_size)) {
+
+                    for (size_t i = 0U; i < Kd; ++i) {
+                        m_coord[i] = static_cast<scalar_t>(m_coord[i] + static_cast<scalar_t>(m_delta[i]));
+                    }
+
+                    // Advance to the next segment once its waypoint has been reached:
+                    if (m_coord == m_path->m_points[m_segment + 1U] && m_segment + 2U < m_path->m_points.size()) {
+                        size_t steps { 0U };
+                        m_delta = direction(m_coord, m_path->m_points[++m_segment + 1U], steps);
+                    }
+                }
+
+                return *this;
+            }
+
+            constexpr const_iterator operator++(int) noexcept {
+                auto result = *this;
+                ++(*this);
+                return result;
+            }
+
+            [[nodiscard]] HOT friend constexpr bool operator==(const const_iterator& _a, const const_iterator& _b) noexcept { return _a.m_position == _b.m_position; }
+            [[nodiscard]] HOT friend constexpr bool operator!=(const const_iterator& _a, const const_iterator& _b) noexcept { return _a.m_position != _b.m_position; }
+        };
+
+        using iterator = const_iterator;
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Constructs an empty path.
+         * @param [in, out] _resource Memory resource used to store the waypoints of the path.
+         */
+        [[maybe_unused, nodiscard]] explicit waypoint_path(std::pmr::memory_resource* _resource = std::pmr::get_default_resource()) :
+            m_points(_resource),
+            m_size  (0U) {}
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Appends a coordinate to the end of the path.
+         *
+         * @details If the step from the previous coordinate continues in the same direction as the last segment,
+         *          the last waypoint is moved rather than a new waypoint being added.
+         *
+         * @param [in] _coord The coordinate to append.
+         *
+         * @pre `_coord` must be connected to the previous coordinate by a straight or diagonal line.
+         */
+        HOT void push_back(const coord_t& _coord) {
+
+            if (UNLIKELY(m_points.empty())) {
+                m_points.emplace_back(_coord);
+                m_size = 1U;
+
+                return;
+            }
+
+            size_t steps { 0U };
+            const auto delta = direction(m_points.back(), _coord, steps);
+
+            if (steps == 0U) {
+                return;
+            }
+
+            m_size += steps;
+
+            if (m_points.size() > 1U) {
+
+                size_t unused { 0U };
+                if (direction(m_points[m_points.size() - 2U], m_points.back(), unused) == delta) {
+                    m_points.back() = _coord;
+
+                    return;
+                }
+            }
+
+            m_points.emplace_back(_coord);
+        }
+
+        /**
+         * @brief Reverses the order of the path in place.
+         */
+        void reverse() noexcept {
+            std::reverse(m_points.begin(), m_points.end());
+        }
+
+        /**
+         * @brief Removes all coordinates from the path.
+         */
+        void clear() noexcept {
+            m_points.clear();
+            m_size = 0U;
+        }
+
+        /**
+         * @brief Checks if the path is empty.
+         */
+        [[maybe_unused, nodiscard]] constexpr bool empty() const noexcept { return m_size == 0U; }
+
+        /**
+         * @brief Number of coordinates in the expanded path.
+         */
+        [[maybe_unused, nodiscard]] constexpr size_t size() const noexcept { return m_size; }
+
+        /**
+         * @brief First coordinate of the path.
+         * @pre The path must not be empty.
+         */
+        [[maybe_unused, nodiscard]] constexpr const coord_t& front() const noexcept {
+            assert(!empty() && "Path is empty.");
+            return m_points.front();
+        }
+
+        /**
+         * @brief Last coordinate of the path.
+         * @pre The path must not be empty.
+         */
+        [[maybe_unused, nodiscard]] constexpr const coord_t& back() const noexcept {
+            assert(!empty() && "Path is empty.");
+            return m_points.back();
+        }
+
+        /**
+         * @brief The waypoints of the path, including its first and last coordinates.
+         */
+        [[maybe_unused, nodiscard]] constexpr const std::pmr::vector<coord_t>& waypoints() const noexcept { return m_points; }
+
+        /**
+         * @brief Expands the path into a vector of coordinates.
+         */
+        [[maybe_unused, nodiscard]] std::vector<coord_t> decode() const {
+            return { begin(), end() };
+        }
+
+        [[maybe_unused, nodiscard]] const_iterator  begin() const noexcept { return { this, 0U     }; }
+        [[maybe_unused, nodiscard]] const_iterator    end() const noexcept { return { this, m_size }; }
+        [[maybe_unused, nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+        [[maybe_unused, nodiscard]] const_iterator   cend() const noexcept { return   end(); }
+    };
+
+} //chdr
+
+#endif //CHDR_WAYPOINT_PATH_HPP
@@ -0,0 +1,124 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_ACCOUNTING_RESOURCE_HPP
+#define CHDR_ACCOUNTING_RESOURCE_HPP
+
+/**
+ * @file accounting_resource.hpp
+ */
+
+#include <cassert>
+#include <cstddef>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+#include "../../utils/utils.hpp"
+
+namespace chdr {
+
+    /**
+     * @nosubgrouping
+     * @class accounting_resource
+     * @brief A memory resource which counts the bytes allocated through it.
+     *
+     * @details Forwards every request to an upstream resource, such as one of the pools of a solver, while
+     *          maintaining the number of bytes which are currently allocated, and the largest number of bytes
+     *          which have been allocated at once.
+     *
+     *          Memory-bounded solvers wrap each of their pools in an accounting resource, so that every container
+     *          and node they allocate is charged against `params_t::memory_limit`:
+     *
+     *          @code
+     *          chdr::accounting_resource heterogeneous(_params.heterogeneous_pmr);
+     *          chdr::accounting_resource   homogeneous(_params.homogeneous_pmr);
+     *
+     *          std::pmr::multiset<node> open(&homogeneous);
+     *
+     *          const auto memory_usage = [&]() { return heterogeneous.allocated() + homogeneous.allocated(); };
+     *          @endcode
+     *
+     *          Accounting resources may be chained, in which case an outer resource counts the allocations of every
+     *          resource it serves.
+     *
+     * @remarks Bytes are counted as requested by the containers. The pools may hold additional memory in partially
+     *          used blocks, so the footprint of a pool may exceed the bytes charged to it by up to the size of its
+     *          largest block.
+     *
+     * @warning Not thread-safe. Each thread must use its own accounting resource.
+     */
+    class accounting_resource final : public std::pmr::memory_resource {
+
+    private:
+
+        std::pmr::memory_resource* m_upstream;
+
+        size_t m_allocated;
+        size_t m_peak;
+
+    protected:
+
+        [[nodiscard]] HOT virtual void* do_allocate(const size_t _bytes, const size_t _alignment) override {
+
+            auto* const result = m_upstream->allocate(_bytes, _alignment);
+
+            m_allocated += _bytes;
+            m_peak       = utils::max(m_peak, m_allocated);
+
+            return result;
+        }
+
+        HOT virtual void do_deallocate(void* _p, const size_t _bytes, const size_t _alignment) override {
+
+            assert(m_allocated >= _bytes && "Deallocation exceeds the bytes allocated through this resource.");
+
+            m_upstream->deallocate(_p, _bytes, _alignment);
+
+            m_allocated -= _bytes;
+        }
+
+        [[nodiscard]] virtual bool do_is_equal(const memory_resource& _other) const noexcept override {
+            return this == &_other;
+        }
+
+    public:
+
+        /**
+         * @brief Constructs an accounting resource over the given upstream resource.
+         *
+         * @param [in, out] _upstream Resource to which every request is forwarded.
+         *                            (optional, defaults to `std::pmr::get_default_resource()`)
+         */
+        explicit accounting_resource(std::pmr::memory_resource* _upstream = std::pmr::get_default_resource()) noexcept :
+            m_upstream (_upstream),
+            m_allocated(0U),
+            m_peak     (0U) {}
+
+        ~accounting_resource() override = default;
+
+        accounting_resource           (const accounting_resource&) = delete;
+        accounting_resource& operator=(const accounting_resource&) = delete;
+        accounting_resource           (accounting_resource&&)      = delete;
+        accounting_resource& operator=(accounting_resource&&)      = delete;
+
+        /** @brief Number of bytes currently allocated through the resource. */
+        [[nodiscard]] HOT constexpr size_t allocated() const noexcept { return m_allocated; }
+
+        /** @brief Largest number of bytes which have been allocated through the resource at once. */
+        [[nodiscard]] HOT constexpr size_t peak() const noexcept { return m_peak; }
+
+        /** @brief Resource to which every request is forwarded. */
+        [[nodiscard]] constexpr std::pmr::memory_resource* upstream() const noexcept { return m_upstream; }
+    };
+
+} //chdr
+
+#endif //CHDR_ACCOUNTING_RESOURCE_HPP
@@ -0,0 +1,183 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_BACKING_HPP
+#define CHDR_BACKING_HPP
+
+/**
+ * @file backing.hpp
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif //defined(__linux__)
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+#include "../../utils/utils.hpp"
+
+namespace chdr {
+
+    /**
+     * @brief Backing policy which requests the blocks of a pool from the global `operator new`.
+     *
+     * @details The default policy of every pool. Blocks grow by a factor of 1.5, up to the maximum block size of the
+     *          pool.
+     *
+     * @see huge_page_backing
+     */
+    struct heap_backing final {
+
+        /** @brief Rounds the size of a block up to a size which the policy can allocate without waste. */
+        [[nodiscard]] HOT static constexpr size_t round(size_t _bytes) noexcept { return _bytes; }
+
+        /** @brief Width of the block which follows a block of the given width. */
+        [[nodiscard]] HOT static constexpr size_t grow(size_t _width, size_t _max) noexcept {
+            return utils::min((_width * 3U) / 2U, _max);
+        }
+
+        [[nodiscard]] static void* allocate(size_t _bytes, size_t _alignment) {
+            return operator new(_bytes, static_cast<std::align_val_t>(_alignment));
+        }
+
+        static void deallocate(void* _p, [[maybe_unused]] size_t _bytes, size_t _alignment) noexcept {
+            operator delete(_p, static_cast<std::align_val_t>(_alignment));
+        }
+    };
+
+    /**
+     * @brief Backing policy which maps the blocks of a pool onto 2 MiB transparent huge pages.
+     *
+     * @details Large searches allocate hundreds of megabytes for their closed sets and open sets, which, in 4 KiB
+     *          pages, exceeds the reach of the TLB. Mapping the same memory with 2 MiB pages reduces the number of
+     *          translations required by a factor of 512.
+     *
+     *          Blocks are rounded up to a multiple of 2 MiB, and mapped with `mmap`, aligned to 2 MiB, and advised
+     *          with `madvise(MADV_HUGEPAGE)`. The maximum block size of the pool is ignored: blocks instead double
+     *          in size, up to 1 GiB, so that the number of blocks grows logarithmically with the size of the search.
+     *
+     *          On platforms other than Linux, blocks are requested from `operator new` with 2 MiB alignment, which
+     *          retains the geometric growth, but not the huge pages.
+     *
+     * @note Huge pages are only used if transparent huge pages are enabled by the system in either the `always` or
+     *       `madvise` modes (see `/sys/kernel/mm/transparent_hugepage/enabled`). Otherwise, the advice is ignored.
+     *
+     * @warning Every block occupies at least 2 MiB of address space, so this policy is only suited to large searches.
+     *
+     * @see heap_backing
+     */
+    struct huge_page_backing final {
+
+        static constexpr size_t s_page_size      { static_cast<size_t>(2U) * 1024U * 1024U        };
+        static constexpr size_t s_max_block_size { static_cast<size_t>(1U) * 1024U * 1024U * 1024U };
+
+        [[nodiscard]] HOT static constexpr size_t round(size_t _bytes) noexcept {
+            return (utils::max(_bytes, static_cast<size_t>(1U)) + s_page_size - 1U) & ~(s_page_size - 1U);
+        }
+
+        [[nodiscard]] HOT static constexpr size_t grow(size_t _width, [[maybe_unused]] size_t _max) noexcept {
+            return utils::min(round(_width) * 2U, s_max_block_size);
+        }
+
+        [[nodiscard]] static void* allocate(size_t _bytes, [[maybe_unused]] size_t _alignment) {
+
+            assert(_alignment <= s_page_size && "Alignment must not exceed the size of a huge page.");
+
+            const auto bytes = round(_bytes);
+
+#if defined(__linux__)
+
+            // Over-allocate, so that the mapping can be trimmed to a boundary of a huge page:
+            const auto mapped = bytes + s_page_size;
+
+            auto* const base = static_cast<uint8_t*>(::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+            if (UNLIKELY(static_cast<void*>(base) == MAP_FAILED)) {
+                throw std::bad_alloc();
+            }
+
+            const auto address = reinterpret_cast<uintptr_t>(base);
+            const auto head    = static_cast<size_t>(((address + s_page_size - 1U) & ~(s_page_size - 1U)) - address);
+
+            auto* const result = base + head;
+
+            if (head != 0U) {
+                ::munmap(base, head);
+            }
+            if (const auto tail = s_page_size - head; tail != 0U) {
+                ::munmap(result + bytes, tail);
+            }
+
+#if defined(MADV_HUGEPAGE)
+            ::madvise(result, bytes, MADV_HUGEPAGE);
+#endif //defined(MADV_HUGEPAGE)
+
+            return result;
+#else //!defined(__linux__)
+            return operator new(bytes, static_cast<std::align_val_t>(s_page_size));
+#endif //!defined(__linux__)
+        }
+
+        static void deallocate(void* _p, size_t _bytes, [[maybe_unused]] size_t _alignment) noexcept {
+
+#if defined(__linux__)
+            ::munmap(_p, round(_bytes));
+#else //!defined(__linux__)
+            (void)_bytes;
+            operator delete(_p, static_cast<std::align_val_t>(s_page_size));
+#endif //!defined(__linux__)
+        }
+    };
+
+    /**
+     * @nosubgrouping
+     * @class backing_resource
+     * @brief A memory resource which forwards every allocation directly to a backing policy.
+     *
+     * @details Intended for large, long-lived buffers which would otherwise be given a dedicated block by a pool,
+     *          such as the storage of an `existence_set` spanning a large maze:
+     *
+     *          @code
+     *          chdr::backing_resource<chdr::huge_page_backing> resource;
+     *
+     *          chdr::existence_set<> closed(maze.count(), &resource);
+     *          @endcode
+     *
+     * @tparam backing_t Backing policy, e.g. `huge_page_backing`. (optional, defaults to `heap_backing`)
+     *
+     * @warning Each allocation is rounded up by the backing policy, so small allocations should not use this resource.
+     */
+    template <typename backing_t = heap_backing>
+    class backing_resource final : public std::pmr::memory_resource {
+
+    protected:
+
+        [[nodiscard]] virtual void* do_allocate(const size_t _bytes, const size_t _alignment) override {
+            return backing_t::allocate(backing_t::round(_bytes), _alignment);
+        }
+
+        virtual void do_deallocate(void* _p, const size_t _bytes, size_t _alignment) override {
+            backing_t::deallocate(_p, backing_t::round(_bytes), _alignment);
+        }
+
+        [[nodiscard]] virtual bool do_is_equal(const memory_resource& _other) const noexcept override {
+            return this == &_other;
+        }
+    };
+
+} //chdr
+
+#endif //CHDR_BACKING_HPP
@@ -0,0 +1,410 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_CONCURRENT_POOL_HPP
+#define CHDR_CONCURRENT_POOL_HPP
+
+/**
+ * @file concurrent_pool.hpp
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include <memory_resource> // NOLINT(*-include-cleaner)
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+#include "../../utils/utils.hpp"
+
+namespace chdr {
+
+    /**
+     * @nosubgrouping
+     * @class concurrent_pool
+     * @brief A thread-safe pooled memory resource for homogeneous memory allocations.
+     *
+     * @details Equivalent to `homogeneous_pool`, but may be allocated from and deallocated to by any number of
+     *          threads at once. This makes it suitable for objects which are created by one thread and destroyed by
+     *          another, such as the messages exchanged between the workers of a parallel solver.
+     *
+     *          The primary features include:
+     *          - Lock-free allocation and deallocation through a free list (Treiber stack).
+     *          - Blocks are carved into chunks, which are pushed to the free list in a single operation.
+     *          - Expansion of the pool is serialised by a mutex, and is the only operation which locks.
+     *
+     *          The head of the free list is a tagged pointer: the upper bits of the word hold a counter which is
+     *          incremented by every update. This prevents the ABA problem, where a thread could otherwise replace
+     *          the head with a stale successor after the chunk was popped and pushed again by other threads.
+     *
+     * @tparam MaxHeapBlockSize Maximum size of a heap-allocated block, in bytes. (optional, defaults to `65536`)
+     *
+     * @warning `reset()`, `release()` and the move operations are not thread-safe, and require that no other thread
+     *          is using the pool.
+     *
+     * @remarks Inherits from `std::pmr::memory_resource` to integrate with the
+     *          PMR (Polymorphic Memory Resource) framework provided in the C++ Standard Library.
+     *
+     * @see homogeneous_pool
+     */
+    template <size_t MaxHeapBlockSize = 65536U>
+    class concurrent_pool final : public std::pmr::memory_resource {
+
+    private:
+
+        struct block final {
+
+            size_t   size;
+            uint8_t* data;
+
+            [[nodiscard]] HOT constexpr block(size_t _size, uint8_t* _data) noexcept :
+                size(_size),
+                data(_data) {}
+        };
+
+        /** @brief A free chunk, which stores its successor in the free list within itself. */
+        struct chunk final {
+            std::atomic<chunk*> next;
+        };
+
+        static constexpr size_t s_default_heap_block_size { 4096U            };
+        static constexpr size_t     s_max_heap_block_size { MaxHeapBlockSize };
+
+        /*
+         * Pointers are assumed to use no more than 48 bits on 64-bit platforms, which is true of x86-64 and of
+         * AArch64 without 52-bit virtual addresses. The remaining bits hold the tag.
+         */
+        static constexpr size_t   s_pointer_bits { sizeof(uintptr_t) >= 8U ? 48U : sizeof(uintptr_t) * 8U };
+        static constexpr uint64_t s_pointer_mask { (uint64_t { 1U } << s_pointer_bits) - 1U };
+
+        static_assert(s_pointer_bits < 64U, "Pointers must leave room for a tag.");
+
+        // Head of the free list, i.e. a tagged pointer:
+        alignas(64) std::atomic<uint64_t> m_free;
+
+        // Combined size of all heap-allocated blocks:
+        alignas(64) std::atomic<size_t> m_footprint;
+
+        std::mutex m_mutex; // Serialises expansion of the pool.
+
+        size_t m_alignment;           // Alignment of the chunks.
+        size_t m_chunk_width;         // Size of the chunks.
+        size_t m_initial_block_width; // Width of the first allocated block.
+        size_t m_block_width;         // Size of the next block.
+
+        std::vector<block> m_blocks;
+
+        [[nodiscard]] HOT static chunk* pointer(uint64_t _tagged) noexcept {
+            return reinterpret_cast<chunk*>(static_cast<uintptr_t>(_tagged & s_pointer_mask));
+        }
+
+        [[nodiscard]] HOT static uint64_t tag(uint64_t _tagged, const chunk* _pointer) noexcept {
+            return (((_tagged >> s_pointer_bits) + 1U) << s_pointer_bits) | static_cast<uint64_t>(reinterpret_cast<uintptr_t>(_pointer));
+        }
+
+        /** @brief Pops a chunk from the free list, if there is one. */
+        [[nodiscard]] HOT chunk* pop() noexcept {
+
+            auto head = m_free.load(std::memory_order_acquire);
+
+            for (auto* curr = pointer(head); curr != nullptr; curr = pointer(head)) {
+
+                // The chunk may have been popped by another thread in the meantime, in which case the tag differs:
+                if (m_free.compare_exchange_weak(head, tag(head, curr->next.load(std::memory_order_relaxed)), std::memory_order_acquire, std::memory_order_acquire)) {
+                    return curr;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /** @brief Pushes a linked run of chunks to the free list. */
+        HOT void push(chunk* _first, chunk* _last) noexcept {
+
+            auto head = m_free.load(std::memory_order_relaxed);
+
+            do {
+                _last->next.store(pointer(head), std::memory_order_relaxed);
+            }
+            while (!m_free.compare_exchange_weak(head, tag(head, _first), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /** @brief Links the chunks of a region to one another, and returns the last. */
+        [[nodiscard]] chunk* link(uint8_t* _data, size_t _count) const noexcept {
+
+            auto* result = ::new (_data) chunk { nullptr };
+
+            for (size_t i = 1U; i < _count; ++i) {
+
+                auto* curr = ::new (_data + (i * m_chunk_width)) chunk { nullptr };
+
+                result->next.store(curr, std::memory_order_relaxed);
+                result = curr;
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] uint8_t* expand(size_t _bytes, size_t _alignment) noexcept {
+
+            assert(_bytes > 0U && "Allocation size must be greater than zero.");
+            assert((_alignment & (_alignment - 1U)) == 0U && "Alignment must be a power of two.");
+
+            const std::lock_guard<std::mutex> lock(m_mutex);
+
+            // Another thread may have expanded the pool while this one was waiting:
+            if (auto* result = pop(); result != nullptr) {
+                return reinterpret_cast<uint8_t*>(result);
+            }
+
+            if (m_chunk_width == 0U) {
+                m_alignment   = utils::max(_alignment, alignof(chunk));
+                m_chunk_width = (utils::max(_bytes, sizeof(chunk)) + m_alignment - 1U) & ~(m_alignment - 1U);
+            }
+
+            assert(utils::max(_alignment, alignof(chunk)) == m_alignment && "Alignment mismatch.");
+            assert(_bytes <= m_chunk_width && "Allocation size mismatch.");
+
+            uint8_t* result { nullptr };
+
+            try {
+                const auto num_chunks     = utils::max(m_block_width / m_chunk_width, static_cast<size_t>(1U));
+                const auto allocate_bytes = num_chunks * m_chunk_width;
+
+                result = static_cast<uint8_t*>(operator new(allocate_bytes, static_cast<std::align_val_t>(m_alignment)));
+
+                m_blocks.emplace_back(allocate_bytes, result);
+
+                // Keep the first chunk, and distribute the remainder:
+                if (num_chunks > 1U) {
+                    push(reinterpret_cast<chunk*>(result + m_chunk_width), link(result + m_chunk_width, num_chunks - 1U));
+                }
+
+                m_footprint.fetch_add(allocate_bytes, std::memory_order_relaxed);
+                m_block_width = utils::min((m_block_width * 3U) / 2U, s_max_heap_block_size);
+            }
+            catch (...) {
+
+                /* Catch any errors that occur during allocation. */
+
+                // ReSharper disable once CppDFAConstantConditions
+                if (result != nullptr) {
+                    // ReSharper disable once CppDFAUnreachableCode
+                    operator delete(result, static_cast<std::align_val_t>(m_alignment));
+                    result = nullptr;
+                }
+            }
+
+            return result;
+        }
+
+        void cleanup() noexcept {
+
+            for (const auto& item : m_blocks) {
+                operator delete(item.data, static_cast<std::align_val_t>(m_alignment));
+            }
+
+            m_footprint.store(0U, std::memory_order_relaxed);
+        }
+
+    protected:
+
+        /**
+         * @brief Allocates memory with the specified size and alignment.
+         *
+         * @details Pops a chunk from the free list. If the free list is empty, the pool is expanded with a new block.
+         *          This method may be called from any number of threads concurrently.
+         *
+         * @param [in] _bytes The size of the memory block to allocate, in bytes. Must be greater than `0`.
+         * @param [in] _alignment The alignment constraint for the start of the allocated memory block.
+         *                        Must be a power of `2`.
+         *
+         * @warning All calls to this function must use the same value for _bytes and _alignment.
+         *          Not doing so is undefined behaviour.
+         *
+         * @throws `std::bad_alloc` if the requested operation could not be completed.
+         *
+         * @return A pointer to the beginning of the allocated memory block.
+         */
+        [[nodiscard]] virtual HOT void* do_allocate(const size_t _bytes, const size_t _alignment) override {
+
+            if (_bytes == 0U) {
+                return nullptr; // No-op. (See C++17 standard.)
+            }
+
+            auto* result = reinterpret_cast<uint8_t*>(pop());
+
+            if (UNLIKELY(result == nullptr)) {
+
+                result = expand(_bytes, _alignment);
+
+                // ReSharper disable once CppDFAConstantConditions
+                if (UNLIKELY(result == nullptr)) {
+                    // ReSharper disable once CppDFAUnreachableCode
+                    throw std::bad_alloc();
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Returns memory to the pool for future use.
+         *
+         * @details Pushes the chunk to the free list. This method may be called from any number of threads
+         *          concurrently, including threads other than the one which allocated the memory.
+         *
+         * @param [in] _p Pointer to the memory block to be deallocated. Must not be null.
+         * @param [in] _bytes Size of the memory block to be deallocated, in bytes.
+         * @param [in] _alignment Alignment constraint for the start of the allocated memory block (currently unused).
+         *
+         * @pre Calling this function with a nullptr, or attempting to release memory not
+         *      owned by the pool is undefined behaviour.
+         *
+         * @post After this operation, the memory should not be used. Doing so is undefined behaviour.
+         */
+        virtual HOT void do_deallocate(void* _p, const size_t _bytes, [[maybe_unused]] size_t _alignment) override {
+
+            if (_bytes != 0U) {
+
+                auto* item = ::new (_p) chunk { nullptr };
+
+                push(item, item);
+            }
+        }
+
+        [[nodiscard]] virtual bool do_is_equal(const memory_resource& _other) const noexcept override {
+            return this == &_other;
+        }
+
+    public:
+
+        /**
+         * @name Constructors
+         * @{
+         */
+
+        /**
+         * @brief Constructs a concurrent memory pool.
+         *
+         * @param _initial_block_width Defines the desired width for the memory blocks, in bytes.
+         *                             If it exceeds the maximum block width, it will be clamped automatically.
+         *
+         * @param _capacity Specifies the number of blocks the pool should initially reserve.
+         *                  (optional, default value is `32U`).
+         */
+        explicit concurrent_pool(size_t _initial_block_width = s_default_heap_block_size, size_t _capacity = 32U) :
+            m_free               (0U),
+            m_footprint          (0U),
+            m_mutex              (),
+            m_alignment          (0U),
+            m_chunk_width        (0U),
+            m_initial_block_width(utils::min(_initial_block_width, s_max_heap_block_size)),
+            m_block_width        (m_initial_block_width)
+        {
+            m_blocks.reserve(_capacity);
+        }
+
+        virtual ~concurrent_pool() override {
+            cleanup();
+        }
+
+        concurrent_pool           (const concurrent_pool&) = delete;
+        concurrent_pool& operator=(const concurrent_pool&) = delete;
+
+        [[nodiscard]] concurrent_pool(concurrent_pool&& _other) noexcept :
+            m_free               (_other.m_free.exchange(0U, std::memory_order_relaxed)),
+            m_footprint          (_other.m_footprint.exchange(0U, std::memory_order_relaxed)),
+            m_mutex              (),
+            m_alignment          (_other.m_alignment          ),
+            m_chunk_width        (_other.m_chunk_width        ),
+            m_initial_block_width(_other.m_initial_block_width),
+            m_block_width        (_other.m_block_width        ),
+            m_blocks             (std::move(_other.m_blocks)  )
+        {
+            _other.m_blocks.clear();
+        }
+
+        concurrent_pool& operator=(concurrent_pool&& _other) noexcept {
+
+            if (this != &_other) {
+
+                cleanup();
+
+                m_free     .store(_other.m_free     .exchange(0U, std::memory_order_relaxed), std::memory_order_relaxed);
+                m_footprint.store(_other.m_footprint.exchange(0U, std::memory_order_relaxed), std::memory_order_relaxed);
+
+                m_alignment           = _other.m_alignment;
+                m_chunk_width         = _other.m_chunk_width;
+                m_initial_block_width = _other.m_initial_block_width;
+                m_block_width         = _other.m_block_width;
+                m_blocks              = std::move(_other.m_blocks);
+
+                _other.m_blocks.clear();
+            }
+            return *this;
+        }
+
+        /**
+         * @}
+         */
+
+        /**
+         * @brief Returns every chunk to the free list, without releasing any memory.
+         *
+         * @warning Not thread-safe. After calling this method, all previously allocated memory from the pool
+         *          should be deemed inaccessible.
+         *
+         * @see release()
+         */
+        void reset() noexcept {
+
+            m_free.store(0U, std::memory_order_relaxed);
+
+            for (const auto& [size, data] : m_blocks) {
+                push(reinterpret_cast<chunk*>(data), link(data, size / m_chunk_width));
+            }
+        }
+
+        /**
+         * @brief Releases all memory resources and resets the internal state of the memory pool.
+         *
+         * @warning Not thread-safe. After calling this method, all previously allocated memory from the pool
+         *          is no longer accessible, and attempting to use such memory will result in undefined behaviour.
+         *
+         * @see reset()
+         */
+        void release() noexcept {
+
+            cleanup();
+
+            m_free.store(0U, std::memory_order_relaxed);
+            m_block_width = m_initial_block_width;
+
+            decltype(m_blocks) temp{};
+            m_blocks = std::move(temp);
+        }
+
+        /**
+         * @brief Retrieves the number of bytes currently held by the pool in heap-allocated blocks.
+         *
+         * @return The combined size of all heap-allocated blocks, in bytes.
+         */
+        [[nodiscard]] size_t footprint() const noexcept { return m_footprint.load(std::memory_order_relaxed); }
+    };
+
+} //chdr
+
+#endif //CHDR_CONCURRENT_POOL_HPP
@@ -13,6 +13,7 @@
  * @file heterogeneous_pool.hpp
  */
 
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -28,6 +29,8 @@
 // ReSharper disable once CppUnusedIncludeDirective
 #include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
 #include "../../utils/utils.hpp"
+#include "backing.hpp"
+#include "reset_policy.hpp"
 
 namespace chdr {
 
@@ -45,19 +48,39 @@ namespace chdr {
      *          - Stack allocation for small data.
      *          - Allocation and deallocation of memory with alignment guarantees.
      *          - Block reuse through a free list.
-     *          - Optional coalescing of adjacent free blocks for optimised memory reuse.
+     *          - Optional coalescing of adjacent free blocks for optimised memory reuse.\n\n
+     *
+     *          By default, free blocks are kept in a tree ordered by size, and are split and (optionally) coalesced
+     *          as required.\n\n
+     *
+     *          If `SizeClasses` is enabled, freed memory is instead kept in segregated free lists, one per
+     *          power-of-two size class. Each allocation is rounded up to its size class, and is served from the head
+     *          of that class's list, or carved from the current block if the list is empty. Both allocation and
+     *          deallocation are therefore constant-time, at the cost of up to half of each allocation being padding.
+     *          Free memory is not coalesced until `reset()`, which returns every block to the pool whole. This
+     *          favours workloads which free and reallocate many blocks of mixed sizes (such as the node churn of
+     *          `smastar`), but the padding increases the footprint, and solvers which mostly grow their containers
+     *          were measured to run slightly slower with it.
      *
      * @tparam              StackSize Size of the pool's stack buffer, in bytes. (optional, defaults to `4096`)
      * @tparam MaxStackAllocationSize Maximum size of a direct allocation to the stack buffer, in bytes. (optional)
      * @tparam       MaxHeapBlockSize Maximum size of a heap-allocated block, in bytes. (optional, defaults to `65536`)
      *
      * @tparam Coalescing Indicates whether the pool coalesces adjacent free memory blocks
-     *                    for more efficient memory usage. (optional, defaults to `true`)
+     *                    for more efficient memory usage. Only applies if `SizeClasses` is disabled.
+     *                    (optional, defaults to `true`)
+     *
+     * @tparam SizeClasses Indicates whether freed memory is kept in segregated, power-of-two size-class free lists
+     *                     rather than a tree. (optional, defaults to `false`)
+     *
+     * @tparam backing_t Policy from which heap blocks are requested. (optional, defaults to `heap_backing`)
+     *
+     * @tparam reset_t Policy deciding which heap blocks are kept by `reset()`. (optional, defaults to `retain_all`)
      *
      * @remarks Inherits from `std::pmr::memory_resource` to integrate with the
      *          PMR (Polymorphic Memory Resource) framework provided in the C++ Standard Library.
      */
-    template <size_t StackSize = 4096U, size_t MaxStackAllocationSize = std::numeric_limits<size_t>::max(), size_t MaxHeapBlockSize = 65536U, bool Coalescing = true>
+    template <size_t StackSize = 4096U, size_t MaxStackAllocationSize = std::numeric_limits<size_t>::max(), size_t MaxHeapBlockSize = 65536U, bool Coalescing = true, bool SizeClasses = false, typename backing_t = heap_backing, typename reset_t = retain_all>
     class heterogeneous_pool final : public std::pmr::memory_resource {
 
         template <template <typename params_t> typename solver_t, typename params_t>
@@ -96,27 +119,200 @@ namespace chdr {
         static constexpr size_t s_default_heap_block_size {  4096U           };
         static constexpr size_t     s_max_heap_block_size { MaxHeapBlockSize };
 
+        /** @brief Base-2 logarithm of the smallest size class, which must be able to hold a pointer. */
+        static constexpr size_t s_min_class { 4U };
+
+        /** @brief Number of size classes. Size classes are powers of two, up to the width of `size_t`. */
+        static constexpr size_t s_num_classes { std::numeric_limits<size_t>::digits };
+
+        /** @brief Index denoting that no block is being carved. */
+        static constexpr size_t s_none { std::numeric_limits<size_t>::max() };
+
         // Fixed stack memory block:
         alignas(max_align_t) uint8_t m_stack_block[s_stack_block_size]; //NOLINT(*-avoid-c-arrays)
 
         size_t m_stack_write;         // Current write position for the stack block.
         size_t m_initial_block_width; // Width of the first allocated block.
         size_t m_block_width;         // Size of the current block.
+        size_t m_footprint;           // Combined size of all heap-allocated blocks.
 
         std::vector<block> m_blocks;
         std::map<size_t, block> m_free;
 
+        std::array<uint8_t*, s_num_classes> m_classes; // Heads of the size-class free lists. (SizeClasses only)
+        size_t m_taken;                                // Number of blocks in use since the last reset. (SizeClasses only)
+        size_t m_current;                              // Index of the block currently being carved, or `s_none`. (SizeClasses only)
+        size_t m_offset;                               // Carve position within the current block. (SizeClasses only)
+
+        reset_t m_reset; // Reset policy.
+
+        /**
+         * @brief Base-2 logarithm of the size class of an allocation, i.e. of the smallest power of two which is no
+         *        less than its size, its alignment, or the smallest size class.
+         */
+        [[nodiscard]] HOT static constexpr size_t size_class(size_t _bytes, size_t _alignment) noexcept {
+
+            const auto bytes = utils::max(_bytes, _alignment) - 1U;
+
+            // Binary search for the position of the highest set bit:
+            size_t result { 0U };
+
+            for (size_t shift = static_cast<size_t>(s_num_classes) / 2U; shift != 0U; shift /= 2U) {
+                if ((bytes >> result) >> shift != 0U) {
+                    result += shift;
+                }
+            }
+
+            return utils::max(bytes != 0U ? result + 1U : 0U, s_min_class);
+        }
+
+        [[nodiscard]] HOT bool owns_stack(const void* _p) const noexcept {
+
+            const auto p = reinterpret_cast<uintptr_t>(_p);
+            const auto b = reinterpret_cast<uintptr_t>(m_stack_block);
+
+            return p >= b && p < b + s_stack_block_size;
+        }
+
+        /**
+         * @brief Takes a block which has not been used since the last `reset()`, or requests a new one from the system.
+         *
+         * @details Blocks are kept in the order in which they are taken, such that the first `m_taken` blocks are
+         *          in use. Blocks retained by `reset()` are reused (best-fit) before new blocks are requested.
+         *
+         * @return Index of the block, or `m_blocks.size()` if the allocation failed.
+         */
+        size_t take(size_t _bytes, size_t _alignment) noexcept {
+
+            // Prefer the smallest block which fits, leaving larger blocks for larger allocations:
+            auto best = m_blocks.size();
+
+            for (auto i = m_taken; i < m_blocks.size(); ++i) {
+
+                if (const auto& b = m_blocks[i];
+                    b.size >= _bytes && (reinterpret_cast<uintptr_t>(b.data) & (_alignment - 1U)) == 0U &&
+                    (best == m_blocks.size() || b.size < m_blocks[best].size)
+                ) {
+                    best = i;
+                }
+            }
+
+            if (best != m_blocks.size()) {
+                std::swap(m_blocks[best], m_blocks[m_taken]);
+                return m_taken++;
+            }
+
+            const auto allocate_size = backing_t::round(utils::max(m_block_width, _bytes));
+            const auto alignment     = utils::max(_alignment, alignof(max_align_t));
+
+            uint8_t* data { nullptr };
+
+            try {
+                data = static_cast<uint8_t*>(backing_t::allocate(allocate_size, alignment));
+
+                m_blocks.emplace_back(allocate_size, alignment, data);
+            }
+            catch (...) {
+
+                if (data != nullptr) {
+                    backing_t::deallocate(data, allocate_size, alignment);
+                }
+
+                return m_blocks.size();
+            }
+
+            m_footprint  += allocate_size;
+            m_block_width = backing_t::grow(m_block_width, s_max_heap_block_size);
+
+            std::swap(m_blocks.back(), m_blocks[m_taken]);
+            return m_taken++;
+        }
+
+        /**
+         * @brief Carves memory for a size class from the current block.
+         *
+         * @details Allocations larger than half of a block are given a block of their own, so that the remainder of
+         *          the current block is not abandoned. Otherwise, if the allocation does not fit, carving moves on to
+         *          a new block, and the remainder of the previous block is not reused until the next `reset()`.
+         */
+        HOT uint8_t* carve(size_t _bytes, size_t _alignment) noexcept {
+
+            const auto fit = [this, _bytes, _alignment](size_t _index, size_t _offset) -> uint8_t* {
+
+                const auto& b = m_blocks[_index];
+
+                const auto base   = reinterpret_cast<uintptr_t>(b.data);
+                const auto offset = static_cast<size_t>(((base + _offset + _alignment - 1U) & ~(_alignment - 1U)) - base);
+
+                if (offset + _bytes <= b.size) {
+                    m_offset = offset + _bytes;
+                    return b.data + offset;
+                }
+
+                return nullptr;
+            };
+
+            if (m_current < m_taken) {
+                if (auto* result = fit(m_current, m_offset); result != nullptr) {
+                    return result;
+                }
+            }
+
+            if (_bytes > m_block_width / 2U) {
+
+                const auto i = take(_bytes, utils::max(_alignment, alignof(max_align_t)));
+
+                return i != m_blocks.size() ? m_blocks[i].data : nullptr;
+            }
+
+            if (const auto i = take(_bytes + _alignment - 1U, alignof(max_align_t)); i != m_blocks.size()) {
+                m_current = i;
+                return fit(m_current, 0U);
+            }
+
+            return nullptr;
+        }
+
+        HOT uint8_t* allocate_from_class(size_t _bytes, size_t _alignment) noexcept {
+
+            const auto c = size_class(_bytes, _alignment);
+
+            // Blocks of a class are aligned to the class size, up to the fundamental alignment:
+            if (uint8_t* head = m_classes[c];
+                head != nullptr && (_alignment <= alignof(max_align_t) || (reinterpret_cast<uintptr_t>(head) & (_alignment - 1U)) == 0U)
+            ) {
+                m_classes[c] = *reinterpret_cast<uint8_t**>(head);
+                return head;
+            }
+
+            const auto bytes = static_cast<size_t>(1U) << c;
+
+            return carve(bytes, utils::max(_alignment, utils::min(bytes, alignof(max_align_t))));
+        }
+
+        HOT void deallocate_to_class(void* _p, size_t _bytes, size_t _alignment) noexcept {
+
+            // Stack memory is only reclaimed by reset():
+            if (!owns_stack(_p)) {
+
+                const auto c = size_class(_bytes, _alignment);
+
+                *static_cast<uint8_t**>(_p) = m_classes[c];
+                m_classes[c] = static_cast<uint8_t*>(_p);
+            }
+        }
+
         HOT uint8_t* expand(size_t _bytes, size_t _alignment) noexcept {
 
             assert(_bytes > 0U && "Allocation size must be greater than zero.");
             assert((_alignment & (_alignment - 1U)) == 0U && "Alignment must be a power of two.");
 
-            const auto allocate_size = utils::max(m_block_width, _bytes);
+            const auto allocate_size = backing_t::round(utils::max(m_block_width, _bytes));
 
             uint8_t* result { nullptr };
 
             try {
-                result = static_cast<uint8_t*>(operator new(allocate_size, static_cast<std::align_val_t>(_alignment)));
+                result = static_cast<uint8_t*>(backing_t::allocate(allocate_size, _alignment));
 
                 m_blocks.emplace_back(
                     allocate_size,
@@ -148,7 +344,8 @@ namespace chdr {
                     }
                 }
 
-                m_block_width = utils::min((m_block_width * 3U) / 2U, s_max_heap_block_size);
+                m_footprint  += allocate_size;
+                m_block_width = backing_t::grow(m_block_width, s_max_heap_block_size);
             }
             catch (...) {
 
@@ -157,7 +354,7 @@ namespace chdr {
                 // ReSharper disable once CppDFAConstantConditions
                 if (result != nullptr) {
                     // ReSharper disable once CppDFAUnreachableCode
-                    operator delete(result, static_cast<std::align_val_t>(_alignment));
+                    backing_t::deallocate(result, allocate_size, _alignment);
                     result = nullptr;
 
                     m_blocks.pop_back();
@@ -212,8 +409,10 @@ namespace chdr {
          */
         void cleanup() noexcept {
             for (const auto& item : m_blocks) {
-                operator delete(item.data, static_cast<std::align_val_t>(item.alignment));
+                backing_t::deallocate(item.data, item.size, item.alignment);
             }
+
+            m_footprint = 0U;
         }
 
     protected:
@@ -257,18 +456,29 @@ namespace chdr {
                 uint8_t* aligned_ptr { nullptr };
 
                 // Attempt to allocate from the stack block:
-                if (aligned_bytes < MaxStackAllocationSize && m_stack_write + aligned_bytes <= s_stack_block_size) {
+                if (aligned_bytes < MaxStackAllocationSize) {
+
+                    // Align the address itself, as the alignment may exceed that of the stack block:
+                    const auto base   = reinterpret_cast<uintptr_t>(m_stack_block);
+                    const auto offset = static_cast<size_t>(((base + m_stack_write + _alignment - 1U) & ~(_alignment - 1U)) - base);
 
-                    aligned_ptr = m_stack_block + ((m_stack_write + _alignment - 1U) & ~(_alignment - 1U));
-                    m_stack_write = static_cast<size_t>(aligned_ptr - m_stack_block) + aligned_bytes;
+                    if (offset + aligned_bytes <= s_stack_block_size) {
+                        aligned_ptr   = m_stack_block + offset;
+                        m_stack_write = offset + aligned_bytes;
+                    }
                 }
 
                 if (aligned_ptr == nullptr) {
 
-                    // Attempt to find a free block, or create one otherwise:
-                    aligned_ptr = allocate_from_free(aligned_bytes);
-                    if (UNLIKELY(aligned_ptr == nullptr)) {
-                        aligned_ptr = expand(_bytes, _alignment);
+                    if constexpr (SizeClasses) {
+                        aligned_ptr = allocate_from_class(_bytes, _alignment);
+                    }
+                    else {
+                        // Attempt to find a free block, or create one otherwise:
+                        aligned_ptr = allocate_from_free(aligned_bytes);
+                        if (UNLIKELY(aligned_ptr == nullptr)) {
+                            aligned_ptr = expand(_bytes, _alignment);
+                        }
                     }
                 }
 
@@ -295,8 +505,9 @@ namespace chdr {
          * @brief Deallocates memory and returns it to the pool for future use.
          *
          * @details Releases a previously allocated chunk of memory and stores it in the internal free list for reuse.
-         *          If `Coalescing` is enabled, the freed memory block is coalesced with adjacent free blocks to reduce
-         *          fragmentation.
+         *          If `SizeClasses` is enabled, the memory is pushed to the free list of its size class in constant
+         *          time. Otherwise, if `Coalescing` is enabled, the freed memory block is coalesced with adjacent free
+         *          blocks to reduce fragmentation.
          *
          * @param [in] _p Pointer to the memory block to be deallocated. Must not be null.
          * @param [in] _bytes Size of the memory block to be deallocated, in bytes.
@@ -319,7 +530,18 @@ namespace chdr {
             assert(_bytes > 0U && "Allocation size must be greater than zero.");
             assert((_alignment & (_alignment - 1U)) == 0U && "Alignment must be a power of two.");
 
-            if (_bytes != 0U) {
+            if constexpr (SizeClasses) {
+
+                if (_p != nullptr && _bytes != 0U) {
+
+                    deallocate_to_class(_p, _bytes, _alignment);
+
+#if CHDR_DIAGNOSTICS == 1
+                    __diagnostic_data.num_allocated = (_bytes > __diagnostic_data.num_allocated) ? 0U : (__diagnostic_data.num_allocated - _bytes);
+#endif //CHDR_DIAGNOSTICS == 1
+                }
+            }
+            else if (_bytes != 0U) {
                 // No-op. (See C++17 standard.)
             }
             else {
@@ -400,7 +622,15 @@ namespace chdr {
             m_stack_block        (),
             m_stack_write        (0U),
             m_initial_block_width(utils::min(_initial_block_width, s_max_heap_block_size)),
-            m_block_width        (m_initial_block_width)
+            m_block_width        (m_initial_block_width),
+            m_footprint          (0U),
+            m_blocks             (),
+            m_free               (),
+            m_classes            (),
+            m_taken              (0U),
+            m_current            (s_none),
+            m_offset             (0U),
+            m_reset              ()
         {
             assert(_initial_block_width >= 2U && "Initial block width must be at least 2.");
 
@@ -435,8 +665,14 @@ namespace chdr {
             m_stack_write        (_other.m_stack_write        ),
             m_initial_block_width(_other.m_initial_block_width),
             m_block_width        (_other.m_block_width        ),
+            m_footprint          (_other.m_footprint          ),
             m_blocks             (std::move(_other.m_blocks)  ),
-            m_free               (std::move(_other.m_free  )  )
+            m_free               (std::move(_other.m_free  )  ),
+            m_classes            (_other.m_classes            ),
+            m_taken              (_other.m_taken              ),
+            m_current            (_other.m_current            ),
+            m_offset             (_other.m_offset             ),
+            m_reset              (std::move(_other.m_reset)   )
         {
             _other.release();
         }
@@ -453,8 +689,14 @@ namespace chdr {
                 m_stack_write         = _other.m_stack_write;
                 m_initial_block_width = _other.m_initial_block_width;
                 m_block_width         = _other.m_block_width;
+                m_footprint           = _other.m_footprint;
                 m_blocks              = std::move(_other.m_blocks);
                 m_free                = std::move(_other.m_free  );
+                m_classes             = _other.m_classes;
+                m_taken               = _other.m_taken;
+                m_current             = _other.m_current;
+                m_offset              = _other.m_offset;
+                m_reset               = std::move(_other.m_reset);
 
                 _other.release();
             }
@@ -469,9 +711,12 @@ namespace chdr {
          * @brief Resets the memory pool state to its initial configuration.
          *
          * @details Resets internal counters and indices, restoring the pool to a
-         *          state as if no memory has been allocated. All blocks remain allocated,
-         *          but any previously allocated data is effectively invalidated. This method
-         *          does not deallocate or release memory already held by the pool.
+         *          state as if no memory has been allocated. Blocks are kept according to the reset policy, which
+         *          is given the combined size of the blocks used since the previous reset. With the default policy
+         *          (`retain_all`), all blocks remain allocated, and no memory held by the pool is released.
+         *          Any previously allocated data is effectively invalidated.
+         *
+         * @note Without size classes, the pool cannot determine which blocks were used, so all are considered used.
          *
          * @warning After calling this method, all previously allocated memory from the pool
          *          should be deemed inaccessible.
@@ -483,18 +728,60 @@ namespace chdr {
          */
         void reset() noexcept {
 
-            m_stack_write = 0U;
-            m_block_width = m_initial_block_width;
+            size_t used { 0U };
+
+            if constexpr (SizeClasses) {
+                for (size_t i = 0U; i < m_taken; ++i) {
+                    used += m_blocks[i].size;
+                }
+            }
+            else {
+                used = m_footprint;
+            }
+
+            // Keep blocks, in the order in which they were taken, while they fit within the amount given by the policy:
+            if (const auto keep = m_reset.retain(used); keep < m_footprint) {
+
+                size_t kept { 0U };
+                size_t count { 0U };
 
-            try {
-                m_free.clear();
                 for (const auto& item : m_blocks) {
-                    m_free.emplace(item.size, item);
+
+                    if (item.size <= keep - kept) {
+                        kept += item.size;
+                        m_blocks[count++] = item;
+                    }
+                    else {
+                        backing_t::deallocate(item.data, item.size, item.alignment);
+                    }
                 }
+
+                m_blocks.resize(count, block { 0U, 0U, nullptr });
+                m_footprint = kept;
             }
-            catch (...) {
-                  m_free.clear();
-                m_blocks.clear();
+
+            m_stack_write = 0U;
+            m_block_width = m_initial_block_width;
+
+            // Every block becomes whole again, which coalesces all free memory:
+            m_classes.fill(nullptr);
+            m_taken   = 0U;
+            m_current = s_none;
+            m_offset  = 0U;
+
+            if constexpr (!SizeClasses) {
+
+                try {
+                    m_free.clear();
+                    for (const auto& item : m_blocks) {
+                        m_free.emplace(item.size, item);
+                    }
+                }
+                catch (...) {
+                    cleanup();
+                      m_free.clear();
+                    m_blocks.clear();
+                }
             }
 
 #if CHDR_DIAGNOSTICS == 1
@@ -526,6 +813,11 @@ namespace chdr {
             m_stack_write = 0U;
             m_block_width = m_initial_block_width;
 
+            m_classes.fill(nullptr);
+            m_taken   = 0U;
+            m_current = s_none;
+            m_offset  = 0U;
+
             {
                 cleanup();
                 decltype(m_blocks) temp{};
@@ -536,12 +828,25 @@ namespace chdr {
                 m_free = std::move(temp);
             }
 
+            m_reset = reset_t{};
+
 #if CHDR_DIAGNOSTICS == 1
             __diagnostic_data. num_allocated = 0U;
             __diagnostic_data.peak_allocated = 0U;
 #endif //CHDR_DIAGNOSTICS == 1
         }
 
+        /**
+         * @brief Retrieves the number of bytes currently held by the pool in heap-allocated blocks.
+         *
+         * @details The footprint grows whenever the pool requests a new block from the system, and only shrinks
+         *          when the pool is released, or when blocks are discarded by the reset policy. It does not include
+         *          the pool's stack buffer.
+         *
+         * @return The combined size of all heap-allocated blocks, in bytes.
+         */
+        [[nodiscard]] constexpr size_t footprint() const noexcept { return m_footprint; }
+
 #if CHDR_DIAGNOSTICS == 1
         constexpr const auto& __get_diagnostic_data() { return __diagnostic_data; };
 #endif //CHDR_DIAGNOSTICS == 1
@@ -28,6 +28,7 @@
 // ReSharper disable once CppUnusedIncludeDirective
 #include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
 #include "../../utils/utils.hpp"
+#include "backing.hpp"
 
 namespace chdr {
 
@@ -50,6 +51,7 @@ namespace chdr {
      * @tparam              StackSize Size of the pool's stack buffer, in bytes. (optional, defaults to `4096`)
      * @tparam MaxStackAllocationSize Maximum size of a direct allocation to the stack buffer, in bytes. (optional)
      * @tparam       MaxHeapBlockSize Maximum size of a heap-allocated block, in bytes. (optional, defaults to `65536`)
+     * @tparam              backing_t Policy from which heap blocks are requested. (optional, defaults to `heap_backing`)
      *
      * @warning Please note that it is not safe to request allocations greater than the initial
      *          block width or maximum block sizes when using this allocator.
@@ -58,7 +60,7 @@ namespace chdr {
      * @remarks Inherits from `std::pmr::memory_resource` to integrate with the
      *          PMR (Polymorphic Memory Resource) framework provided in the C++ Standard Library.
      */
-    template <size_t StackSize = 4096U, size_t MaxStackAllocationSize = std::numeric_limits<size_t>::max(), size_t MaxHeapBlockSize = 65536U>
+    template <size_t StackSize = 4096U, size_t MaxStackAllocationSize = std::numeric_limits<size_t>::max(), size_t MaxHeapBlockSize = 65536U, typename backing_t = heap_backing>
     class homogeneous_pool final : public std::pmr::memory_resource {
 
         template <template <typename params_t> typename solver_t, typename params_t>
@@ -98,6 +100,7 @@ namespace chdr {
         size_t m_stack_write;         // Current write position for the stack block.
         size_t m_initial_block_width; // Width of the first allocated block.
         size_t m_block_width;         // Size of the current block.
+        size_t m_footprint;           // Combined size of all heap-allocated blocks.
 
         std::vector<block> m_blocks;
         std::vector<uint8_t*> m_free;
@@ -110,10 +113,11 @@ namespace chdr {
 
             uint8_t* result { nullptr };
 
+            const auto allocate_bytes = backing_t::round(utils::max(m_block_width, utils::max(_bytes, _alignment)));
+
             try {
-                const auto allocate_bytes = utils::max(m_block_width, utils::max(_bytes, _alignment));
 
-                result = static_cast<uint8_t*>(operator new(allocate_bytes, static_cast<std::align_val_t>(_alignment)));
+                result = static_cast<uint8_t*>(backing_t::allocate(allocate_bytes, _alignment));
 
                 m_blocks.emplace_back(
                     allocate_bytes,
@@ -139,7 +143,8 @@ namespace chdr {
                     }
                 }
 
-                m_block_width = utils::min((m_block_width * 3U) / 2U, s_max_heap_block_size);
+                m_footprint  += allocate_bytes;
+                m_block_width = backing_t::grow(m_block_width, s_max_heap_block_size);
             }
             catch (...) {
 
@@ -148,7 +153,7 @@ namespace chdr {
                 // ReSharper disable once CppDFAConstantConditions
                 if (result != nullptr) {
                     // ReSharper disable once CppDFAUnreachableCode
-                    operator delete(result, static_cast<std::align_val_t>(_alignment));
+                    backing_t::deallocate(result, allocate_bytes, _alignment);
                     result = nullptr;
 
                     m_blocks.pop_back();
@@ -172,8 +177,10 @@ namespace chdr {
          */
         void cleanup() noexcept {
             for (const auto& item : m_blocks) {
-                operator delete(item.data, static_cast<std::align_val_t>(m_alignment));
+                backing_t::deallocate(item.data, item.size, m_alignment);
             }
+
+            m_footprint = 0U;
         }
 
     protected:
@@ -351,7 +358,8 @@ namespace chdr {
             m_alignment          (0U),
             m_stack_write        (0U),
             m_initial_block_width(utils::min(_initial_block_width, s_max_heap_block_size)),
-            m_block_width        (m_initial_block_width)
+            m_block_width        (m_initial_block_width),
+            m_footprint          (0U)
         {
             assert(_initial_block_width >= 2U && "Initial block width must be at least 2.");
 
@@ -388,10 +396,12 @@ namespace chdr {
             m_stack_write        (_other.m_stack_write        ),
             m_initial_block_width(_other.m_initial_block_width),
             m_block_width        (_other.m_block_width        ),
+            m_footprint          (_other.m_footprint          ),
             m_blocks             (std::move(_other.m_blocks)  ),
             m_free               (std::move(_other.m_free  )  )
         {
             _other.m_stack_write = 0U;
+            _other.m_footprint   = 0U;
             _other.m_blocks.clear();
             _other.m_free.clear();
         }
@@ -409,10 +419,12 @@ namespace chdr {
                 m_stack_write         = _other.m_stack_write;
                 m_initial_block_width = _other.m_initial_block_width;
                 m_block_width         = _other.m_block_width;
+                m_footprint           = _other.m_footprint;
                 m_blocks              = std::move(_other.m_blocks);
                 m_free                = std::move(_other.m_free  );
 
                 _other.m_stack_write = 0U;
+                _other.m_footprint   = 0U;
                 _other.m_blocks.clear();
                 _other.m_free.clear();
             }
@@ -463,6 +475,7 @@ namespace chdr {
                 }
             }
             catch (...) {
+                cleanup();
                 m_blocks.clear();
                   m_free.clear();
             }
@@ -508,6 +521,16 @@ namespace chdr {
 #endif //CHDR_DIAGNOSTICS == 1
         }
 
+        /**
+         * @brief Retrieves the number of bytes currently held by the pool in heap-allocated blocks.
+         *
+         * @details The footprint grows whenever the pool requests a new block from the system, and only shrinks
+         *          when the pool is released. It does not include the pool's stack buffer.
+         *
+         * @return The combined size of all heap-allocated blocks, in bytes.
+         */
+        [[nodiscard]] constexpr size_t footprint() const noexcept { return m_footprint; }
+
 #if CHDR_DIAGNOSTICS == 1
         constexpr const auto& __get_diagnostic_data() { return __diagnostic_data; };
 #endif //CHDR_DIAGNOSTICS == 1
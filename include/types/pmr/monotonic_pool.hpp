@@ -19,12 +19,15 @@
 #include <limits>
 #include <memory>
 #include <new>
+#include <utility>
 #include <vector>
 
 // ReSharper disable once CppUnusedIncludeDirective
 #include <memory_resource> // NOLINT(*-include-cleaner)
 
 #include "../../utils/utils.hpp"
+#include "backing.hpp"
+#include "reset_policy.hpp"
 
 // ReSharper disable once CppUnusedIncludeDirective
 #include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
@@ -43,11 +46,16 @@ namespace chdr {
      * @tparam              StackSize Size of the pool's stack buffer, in bytes. (optional, defaults to `4096`)
      * @tparam MaxStackAllocationSize Maximum size of a direct allocation to the stack buffer, in bytes. (optional)
      * @tparam       MaxHeapBlockSize Maximum size of a heap-allocated block, in bytes. (optional, defaults to `65536`)
+     * @tparam              backing_t Policy from which heap blocks are requested. (optional, defaults to `heap_backing`)
+     * @tparam                reset_t Policy deciding which heap blocks are kept by `reset()`. (optional, defaults to `release_all`)
      *
      * @remarks Inherits from `std::pmr::memory_resource` to integrate with the
      *          PMR (Polymorphic Memory Resource) framework provided in the C++ Standard Library.
+     *
+     * @see huge_page_backing
+     * @see retain_peak
      */
-    template <size_t StackSize = 4096U, size_t MaxStackAllocationSize = std::numeric_limits<size_t>::max(), size_t MaxHeapBlockSize = 65536U>
+    template <size_t StackSize = 4096U, size_t MaxStackAllocationSize = std::numeric_limits<size_t>::max(), size_t MaxHeapBlockSize = 65536U, typename backing_t = heap_backing, typename reset_t = release_all>
     class monotonic_pool final : public std::pmr::memory_resource {
 
         template <template <typename params_t> typename solver_t, typename params_t>
@@ -94,9 +102,12 @@ namespace chdr {
         size_t m_active_block_index;  // Index of the current active block.
         size_t m_initial_block_width; // Width of the first allocated block.
         size_t m_block_width;         // Size of the current block.
+        size_t m_footprint;           // Combined size of all heap-allocated blocks.
 
         std::vector<block> m_blocks;
 
+        reset_t m_reset; // Reset policy.
+
         HOT uint8_t* expand(size_t _bytes, size_t _alignment) {
 
             assert(_bytes > 0U && "Allocation size must be greater than zero.");
@@ -106,21 +117,35 @@ namespace chdr {
 
             try {
 
-                if (m_active_block_index + 1U < m_blocks.size()) { // Reuse an existing block:
+                // Blocks after the active block were retained by reset(). Find one which fits the allocation:
+                auto recycled = m_blocks.empty() ? 0U : m_active_block_index + 1U;
+
+                for (; recycled < m_blocks.size(); ++recycled) {
+
+                    if (const auto& b = m_blocks[recycled];
+                        b.size >= _bytes && (reinterpret_cast<uintptr_t>(b.data) & (_alignment - 1U)) == 0U
+                    ) {
+                        break;
+                    }
+                }
+
+                if (recycled < m_blocks.size()) { // Reuse an existing block:
 
-                    auto& recycled_block = m_blocks[++m_active_block_index];
+                    // Keep the blocks in use contiguous:
+                    m_active_block_index = m_blocks.empty() ? 0U : m_active_block_index + 1U;
+                    std::swap(m_blocks[recycled], m_blocks[m_active_block_index]);
 
-                    m_block_width = recycled_block.size;
-                    result = recycled_block.data;
+                    m_block_width = m_blocks[m_active_block_index].size;
+                    result        = m_blocks[m_active_block_index].data;
                 }
                 else { // Allocate a new, larger block:
 
-                    m_block_width = utils::max(
+                    m_block_width = backing_t::round(utils::max(
                         m_initial_block_width,
-                        utils::max(utils::min((m_block_width * 3U) / 2U, s_max_heap_block_size), _bytes)
-                    );
+                        utils::max(backing_t::grow(m_block_width, s_max_heap_block_size), _bytes)
+                    ));
 
-                    result = static_cast<uint8_t*>(operator new(m_block_width, static_cast<std::align_val_t>(_alignment)));
+                    result = static_cast<uint8_t*>(backing_t::allocate(m_block_width, _alignment));
 
                     m_blocks.emplace_back(
                         m_block_width,
@@ -128,7 +153,11 @@ namespace chdr {
                         result
                     );
 
-                    m_active_block_index = m_blocks.size() - 1U;
+                    // Keep the blocks in use contiguous:
+                    m_active_block_index = m_blocks.size() == 1U ? 0U : m_active_block_index + 1U;
+                    std::swap(m_blocks.back(), m_blocks[m_active_block_index]);
+
+                    m_footprint += m_block_width;
                 }
 
                 m_block_write = 0U; // Reset write head to beginning.
@@ -140,7 +169,7 @@ namespace chdr {
                 // ReSharper disable once CppDFAConstantConditions
                 if (result != nullptr) {
                     // ReSharper disable once CppDFAUnreachableCode
-                    operator delete(result, static_cast<std::align_val_t>(_alignment));
+                    backing_t::deallocate(result, m_block_width, _alignment);
                     result = nullptr;
 
                     m_blocks.pop_back();
@@ -164,8 +193,22 @@ namespace chdr {
          */
         void cleanup() noexcept {
             for (const auto& item : m_blocks) {
-                operator delete(item.data, static_cast<std::align_val_t>(item.alignment));
+                backing_t::deallocate(item.data, item.size, item.alignment);
             }
+
+            m_footprint = 0U;
+        }
+
+        void release_blocks() noexcept {
+
+            m_block_width        = m_initial_block_width;
+            m_stack_write        = 0U;
+            m_block_write        = 0U;
+            m_active_block_index = 0U;
+
+            cleanup();
+            decltype(m_blocks) temp{};
+            m_blocks = std::move(temp);
         }
 
     protected:
@@ -316,7 +359,8 @@ namespace chdr {
             m_block_write        (0U),
             m_active_block_index (0U),
             m_initial_block_width(utils::min(_initial_block_width, s_max_heap_block_size)),
-            m_block_width        (m_initial_block_width) {}
+            m_block_width        (m_initial_block_width),
+            m_footprint          (0U) {}
 
         /**
          * @brief Destroys the object and releases all allocated memory.
@@ -348,7 +392,9 @@ namespace chdr {
             m_active_block_index (_other.m_active_block_index ),
             m_initial_block_width(_other.m_initial_block_width),
             m_block_width        (_other.m_block_width        ),
-            m_blocks             (std::move(_other.m_blocks)  )
+            m_footprint          (_other.m_footprint          ),
+            m_blocks             (std::move(_other.m_blocks)  ),
+            m_reset              (std::move(_other.m_reset)   )
         {
             _other.release();
         }
@@ -367,7 +413,9 @@ namespace chdr {
                 m_active_block_index  = _other.m_active_block_index;
                 m_initial_block_width = _other.m_initial_block_width;
                 m_block_width         = _other.m_block_width;
+                m_footprint           = _other.m_footprint;
                 m_blocks              = std::move(_other.m_blocks);
+                m_reset               = std::move(_other.m_reset);
 
                 _other.release();
             }
@@ -375,10 +423,14 @@ namespace chdr {
         }
 
         /**
-         * @brief Releases all memory resources and resets the internal state of the memory pool.
+         * @brief Resets the memory pool, keeping the heap blocks chosen by the reset policy.
          *
-         * @details It is generally impractical to efficiently reset bucketed monotonic allocators.
-         *          Therefore, this function call redirects to release().
+         * @details The reset policy is given the combined size of the blocks used since the previous reset, and
+         *          returns the number of bytes to keep. Blocks are kept in the order in which they were used while they fit
+         *          within that amount, and the remainder are returned to the system. The write positions are then
+         *          rewound to the start of the first block.\n\n
+         *
+         *          With the default policy (`release_all`), no blocks are kept, and this is equivalent to `release()`.
          *
          * @warning After calling this method, all previously allocated memory from the pool
          *          should be deemed inaccessible.
@@ -387,9 +439,52 @@ namespace chdr {
          *       after calling of this function.
          *
          * @see release()
+         * @see retain_peak
          */
         void reset() noexcept {
-            return release();
+
+            size_t used { 0U };
+
+            if (!m_blocks.empty()) {
+                for (size_t i = 0U; i <= m_active_block_index; ++i) {
+                    used += m_blocks[i].size;
+                }
+            }
+
+            const auto keep = m_reset.retain(used);
+
+            if (keep == 0U) {
+                release_blocks();
+            }
+            else {
+
+                size_t kept { 0U };
+                size_t count { 0U };
+
+                for (const auto& item : m_blocks) {
+
+                    if (item.size <= keep - kept) {
+                        kept += item.size;
+                        m_blocks[count++] = item;
+                    }
+                    else {
+                        backing_t::deallocate(item.data, item.size, item.alignment);
+                    }
+                }
+
+                m_blocks.resize(count, block { 0U, 0U, nullptr });
+
+                m_footprint          = kept;
+                m_stack_write        = 0U;
+                m_block_write        = 0U;
+                m_active_block_index = 0U;
+                m_block_width        = m_blocks.empty() ? m_initial_block_width : m_blocks.front().size;
+            }
+
+#if CHDR_DIAGNOSTICS == 1
+            __diagnostic_data. num_allocated = 0U;
+            __diagnostic_data.peak_allocated = 0U;
+#endif //CHDR_DIAGNOSTICS == 1
         }
 
         /**
@@ -412,14 +507,9 @@ namespace chdr {
          */
         void release() {
 
-            m_block_width        = m_initial_block_width;
-            m_stack_write        = 0U;
-            m_block_write        = 0U;
-            m_active_block_index = 0U;
+            release_blocks();
 
-            cleanup();
-            decltype(m_blocks) temp{};
-            m_blocks = std::move(temp);
+            m_reset = reset_t{};
 
 #if CHDR_DIAGNOSTICS == 1
             __diagnostic_data. num_allocated = 0U;
@@ -427,6 +517,17 @@ namespace chdr {
 #endif //CHDR_DIAGNOSTICS == 1
         }
 
+        /**
+         * @brief Retrieves the number of bytes currently held by the pool in heap-allocated blocks.
+         *
+         * @details The footprint grows whenever the pool requests a new block from the system, and only shrinks
+         *          when the pool is released, or when blocks are discarded by the reset policy. It does not include
+         *          the pool's stack buffer.
+         *
+         * @return The combined size of all heap-allocated blocks, in bytes.
+         */
+        [[nodiscard]] constexpr size_t footprint() const noexcept { return m_footprint; }
+
 #if CHDR_DIAGNOSTICS == 1
         constexpr const auto& __get_diagnostic_data() { return __diagnostic_data; };
 #endif //CHDR_DIAGNOSTICS == 1
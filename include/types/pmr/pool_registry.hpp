@@ -0,0 +1,109 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_POOL_REGISTRY_HPP
+#define CHDR_POOL_REGISTRY_HPP
+
+/**
+ * @file pool_registry.hpp
+ */
+
+#include <cstddef>
+
+#include "heterogeneous_pool.hpp"
+#include "homogeneous_pool.hpp"
+#include "monotonic_pool.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr {
+
+    /**
+     * @nosubgrouping
+     * @class pool_registry
+     * @brief Hands out a private triple of memory pools to each thread.
+     *
+     * @details The pools of CHDR are single-threaded, so solves which run concurrently must not share them. Rather
+     *          than constructing three pools per thread by hand, each thread may request its own triple from the
+     *          registry. The triple is constructed on first use, and destroyed when the thread exits.
+     *
+     *          Example:
+     *          @code
+     *          auto& pools = chdr::pool_registry<>::local();
+     *
+     *          const params_t args { maze, start, end, size, h, pools.monotonic_pmr(), pools.heterogeneous_pmr(), pools.homogeneous_pmr() };
+     *
+     *          const auto path = chdr::solvers::solver<chdr::solvers::astar, params_t>::solve(args);
+     *
+     *          pools.reset();
+     *          @endcode
+     *
+     * @tparam     monotonic_t Type of the monotonic pool. (optional, defaults to `monotonic_pool<>`)
+     * @tparam heterogeneous_t Type of the heterogeneous pool. (optional, defaults to `heterogeneous_pool<>`)
+     * @tparam   homogeneous_t Type of the homogeneous pool. (optional, defaults to `homogeneous_pool<>`)
+     *
+     * @warning Memory allocated from a thread's pools must not outlive the thread, and must not be deallocated by
+     *          other threads. For objects shared between threads, use a `concurrent_pool`.
+     *
+     * @see concurrent_pool
+     */
+    template <typename monotonic_t = monotonic_pool<>, typename heterogeneous_t = heterogeneous_pool<>, typename homogeneous_t = homogeneous_pool<>>
+    class pool_registry final {
+
+    public:
+
+        /** @brief The pools belonging to a thread. */
+        struct pools final {
+
+            monotonic_t         monotonic;
+            heterogeneous_t heterogeneous;
+            homogeneous_t     homogeneous;
+
+            [[nodiscard]] HOT constexpr     monotonic_t*     monotonic_pmr() noexcept { return &monotonic;     }
+            [[nodiscard]] HOT constexpr heterogeneous_t* heterogeneous_pmr() noexcept { return &heterogeneous; }
+            [[nodiscard]] HOT constexpr   homogeneous_t*   homogeneous_pmr() noexcept { return &homogeneous;   }
+
+            /** @brief Resets each of the pools, retaining their memory for the next solve. */
+            void reset() noexcept {
+                monotonic    .reset();
+                heterogeneous.reset();
+                homogeneous  .reset();
+            }
+
+            /** @brief Releases the memory of each of the pools. */
+            void release() {
+                monotonic    .release();
+                heterogeneous.release();
+                homogeneous  .release();
+            }
+
+            /** @brief Combined number of bytes held by the pools in heap-allocated blocks. */
+            [[nodiscard]] size_t footprint() const noexcept {
+                return monotonic.footprint() + heterogeneous.footprint() + homogeneous.footprint();
+            }
+        };
+
+        pool_registry() = delete;
+
+        /**
+         * @brief Retrieves the pools of the calling thread, constructing them if this is the first request.
+         *
+         * @return A reference to the pools of the calling thread, which remains valid until the thread exits.
+         */
+        [[nodiscard]] static pools& local() {
+
+            thread_local pools s_local;
+
+            return s_local;
+        }
+    };
+
+} //chdr
+
+#endif //CHDR_POOL_REGISTRY_HPP
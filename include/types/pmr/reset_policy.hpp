@@ -0,0 +1,106 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_RESET_POLICY_HPP
+#define CHDR_RESET_POLICY_HPP
+
+/**
+ * @file reset_policy.hpp
+ */
+
+#include <cstddef>
+#include <limits>
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+#include "../../utils/utils.hpp"
+
+namespace chdr {
+
+    /**
+     * @brief Reset policy which returns every heap block to the system when a pool is reset.
+     *
+     * @details The default policy of `monotonic_pool`. Memory is not held between solves, but every solve must
+     *          request its blocks from the system again.
+     *
+     * @see retain_peak
+     */
+    struct release_all final {
+
+        /**
+         * @brief Determines how many bytes of heap blocks a pool should keep when it is reset.
+         *
+         * @param [in] _used Combined size of the blocks which were used since the previous reset, in bytes.
+         *
+         * @return The number of bytes to keep.
+         */
+        [[nodiscard]] HOT constexpr size_t retain([[maybe_unused]] size_t _used) noexcept { return 0U; }
+    };
+
+    /**
+     * @brief Reset policy which keeps every heap block when a pool is reset.
+     *
+     * @details The default policy of `heterogeneous_pool`. The footprint of the pool never shrinks before it is
+     *          released.
+     *
+     * @see retain_peak
+     */
+    struct retain_all final {
+
+        [[nodiscard]] HOT constexpr size_t retain([[maybe_unused]] size_t _used) noexcept { return std::numeric_limits<size_t>::max(); }
+    };
+
+    /**
+     * @brief Reset policy which keeps heap blocks up to the high-water mark of previous solves.
+     *
+     * @details Intended for streams of similarly-sized queries. Blocks are kept up to the largest amount of memory
+     *          used by a solve, and the pool's write positions are rewound rather than its blocks released. Once the
+     *          stream reaches a steady state, solves make no requests to the system.
+     *
+     *          If `Decay` is non-zero, the high-water mark is lowered every `Decay` resets to the largest usage
+     *          observed over those resets. This returns memory to the system after an unusually large solve, at the
+     *          cost of requesting it again if such solves recur.
+     *
+     * @tparam Decay Number of resets after which the high-water mark decays, or `0` to never decay.
+     *               (optional, defaults to `0`)
+     *
+     * @see release_all
+     * @see retain_all
+     */
+    template <size_t Decay = 0U>
+    struct retain_peak final {
+
+    private:
+
+        size_t m_peak   { 0U }; // High-water mark, in bytes.
+        size_t m_window { 0U }; // Largest usage since the high-water mark last decayed, in bytes.
+        size_t m_count  { 0U }; // Number of resets since the high-water mark last decayed.
+
+    public:
+
+        [[nodiscard]] HOT constexpr size_t retain(size_t _used) noexcept {
+
+            m_peak   = utils::max(m_peak,   _used);
+            m_window = utils::max(m_window, _used);
+
+            if constexpr (Decay != 0U) {
+
+                if (++m_count >= Decay) {
+                    m_peak   = m_window;
+                    m_window = 0U;
+                    m_count  = 0U;
+                }
+            }
+
+            return m_peak;
+        }
+    };
+
+} //chdr
+
+#endif //CHDR_RESET_POLICY_HPP
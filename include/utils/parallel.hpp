@@ -0,0 +1,285 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_PARALLEL_HPP
+#define CHDR_PARALLEL_HPP
+
+/**
+ * @file parallel.hpp
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../utils/utils.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr {
+
+    /**
+     * @nosubgrouping
+     * @struct parallel
+     * @brief A static utility class for splitting ranges of work between threads.
+     *
+     * @details Work is described by a function invoked as `_function(begin, end, thread)` over a contiguous chunk
+     *          of `[0, count)`, where `thread` is a dense index below the number of threads used, so that callers
+     *          may keep a buffer per thread. Ranges too small to be worth splitting are processed on the calling
+     *          thread.\n\n
+     *
+     *          `for_each()` starts its threads for a single call. Algorithms which split work many times in
+     *          succession (such as once per level of a breadth-first search) should instead hold a `pool`, whose
+     *          threads persist between calls.
+     */
+    struct parallel final {
+
+         parallel()                            = delete;
+         parallel           (const parallel& ) = delete;
+         parallel           (const parallel&&) = delete;
+         parallel& operator=(const parallel& ) = delete;
+         parallel& operator=(const parallel&&) = delete;
+        ~parallel()                            = delete;
+
+        /**
+         * @brief The number of threads which may run concurrently. At least one.
+         */
+        [[nodiscard]] static size_t max_threads() noexcept {
+            return utils::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1U));
+        }
+
+        /**
+         * @brief The number of threads worth using for a range, given the smallest chunk worth giving a thread.
+         */
+        [[nodiscard]] static constexpr size_t threads_for(size_t _count, size_t _chunk_min, size_t _max) noexcept {
+            return utils::clamp(_count / utils::max(_chunk_min, static_cast<size_t>(1U)), static_cast<size_t>(1U), _max);
+        }
+
+        /**
+         * @nosubgrouping
+         * @class pool
+         * @brief A set of persistent worker threads.
+         *
+         * @details Workers are started on the first call which needs them, and then sleep between calls. The calling
+         *          thread processes the first chunk of each call itself, so a pool of `n` threads holds `n - 1` workers.
+         *
+         * @warning A pool must only be used from one thread at a time.
+         */
+        class pool final {
+
+            using invoke_t = void (*)(const void*, size_t, size_t, size_t);
+
+            std::vector<std::thread> m_workers;
+            size_t                   m_capacity;
+
+            std::mutex              m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_done;
+
+            invoke_t    m_invoke;
+            const void* m_function;
+
+            size_t m_count;
+            size_t m_chunk;
+            size_t m_active;
+            size_t m_pending;
+            size_t m_generation;
+            bool   m_stop;
+
+            std::exception_ptr m_exception;
+
+            void work(size_t _thread) {
+
+                size_t generation { 0U };
+
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                for (;;) {
+
+                    m_wake.wait(lock, [this, &generation]() { return m_stop || m_generation != generation; });
+
+                    if (m_stop) {
+                        break;
+                    }
+
+                    generation = m_generation;
+
+                    if (_thread < m_active) {
+
+                        const auto invoke   = m_invoke;
+                        const auto function = m_function;
+                        const auto begin    = utils::min( _thread       * m_chunk, m_count);
+                        const auto end      = utils::min((_thread + 1U) * m_chunk, m_count);
+
+                        lock.unlock();
+
+                        std::exception_ptr exception;
+                        try {
+                            invoke(function, begin, end, _thread);
+                        }
+                        catch (...) {
+                            exception = std::current_exception();
+                        }
+
+                        lock.lock();
+
+                        if (exception && !m_exception) {
+                            m_exception = exception;
+                        }
+
+                        if (--m_pending == 0U) {
+                            m_done.notify_one();
+                        }
+                    }
+                }
+            }
+
+        public:
+
+            /**
+             * @param [in] _threads The most threads to use, including the calling thread. At least one.
+             */
+            [[maybe_unused, nodiscard]] explicit pool(size_t _threads = max_threads()) :
+                m_workers   (),
+                m_capacity  (utils::max(_threads, static_cast<size_t>(1U))),
+                m_mutex     (),
+                m_wake      (),
+                m_done      (),
+                m_invoke    (nullptr),
+                m_function  (nullptr),
+                m_count     (0U),
+                m_chunk     (0U),
+                m_active    (0U),
+                m_pending   (0U),
+                m_generation(0U),
+                m_stop      (false),
+                m_exception () {}
+
+            ~pool() {
+
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stop = true;
+                }
+
+                m_wake.notify_all();
+
+                for (auto& worker : m_workers) {
+                    worker.join();
+                }
+            }
+
+            pool           (const pool&) = delete;
+            pool& operator=(const pool&) = delete;
+            pool           (pool&&)      = delete;
+            pool& operator=(pool&&)      = delete;
+
+            /**
+             * @brief The most threads used by a call, including the calling thread.
+             */
+            [[nodiscard]] constexpr size_t size() const noexcept { return m_capacity; }
+
+            /**
+             * @brief Invokes `_function(begin, end, thread)` over `[0, _count)`, split into chunks processed in parallel.
+             *
+             * @param [in]     _count The size of the range.
+             * @param [in] _chunk_min The smallest chunk worth giving a thread.
+             * @param [in]  _function The function to invoke.
+             *
+             * @note Exceptions thrown by `_function` are rethrown on the calling thread, once every chunk has finished.
+             */
+            template <typename function_t>
+            void for_each(size_t _count, size_t _chunk_min, const function_t& _function) {
+
+                const size_t numThreads = threads_for(_count, _chunk_min, m_capacity);
+                const size_t chunkSize  = (_count + numThreads - 1U) / numThreads;
+
+                if (numThreads == 1U) {
+                    _function(static_cast<size_t>(0U), _count, static_cast<size_t>(0U));
+                    return;
+                }
+
+                if (UNLIKELY(m_workers.empty())) {
+
+                    m_workers.reserve(m_capacity - 1U);
+
+                    for (size_t t = 1U; t < m_capacity; ++t) {
+                        m_workers.emplace_back(&pool::work, this, t);
+                    }
+                }
+
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+
+                    m_invoke = [](const void* _f, size_t _begin, size_t _end, size_t _thread) {
+                        (*static_cast<const function_t*>(_f))(_begin, _end, _thread);
+                    };
+                    m_function = &_function;
+                    m_count    = _count;
+                    m_chunk    = chunkSize;
+                    m_active   = numThreads;
+                    m_pending  = numThreads - 1U;
+
+                    ++m_generation;
+                }
+
+                m_wake.notify_all();
+
+                std::exception_ptr exception;
+                try {
+                    _function(static_cast<size_t>(0U), utils::min(chunkSize, _count), static_cast<size_t>(0U));
+                }
+                catch (...) {
+                    exception = std::current_exception();
+                }
+
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_done.wait(lock, [this]() { return m_pending == 0U; });
+
+                if (!exception) {
+                    exception = m_exception;
+                }
+                m_exception = nullptr;
+
+                lock.unlock();
+
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        };
+
+        /**
+         * @brief Invokes `_function(begin, end, thread)` over `[0, _count)`, split into chunks processed in parallel.
+         *
+         * @details Threads are started for this call alone. Use a `pool` when splitting work repeatedly.
+         *
+         * @param [in]     _count The size of the range.
+         * @param [in] _chunk_min The smallest chunk worth giving a thread.
+         * @param [in]  _function The function to invoke.
+         */
+        template <typename function_t>
+        static void for_each(size_t _count, size_t _chunk_min, const function_t& _function) {
+
+            if (const auto numThreads = threads_for(_count, _chunk_min, max_threads()); numThreads == 1U) {
+                _function(static_cast<size_t>(0U), _count, static_cast<size_t>(0U));
+            }
+            else {
+                pool workers(numThreads);
+                workers.for_each(_count, _chunk_min, _function);
+            }
+        }
+    };
+
+} //chdr
+
+#endif //CHDR_PARALLEL_HPP
@@ -0,0 +1,271 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef CHDR_SMOOTHING_HPP
+#define CHDR_SMOOTHING_HPP
+
+/**
+ * @file smoothing.hpp
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "../utils/utils.hpp"
+
+// ReSharper disable once CppUnusedIncludeDirective
+#include "../utils/intrinsics.hpp" // NOLINT(*-include-cleaner)
+
+namespace chdr {
+
+    /**
+     * @nosubgrouping
+     * @struct smoothing
+     * @brief A static utility class providing line-of-sight tests and path post-processing for grids.
+     *
+     * @details Paths produced by grid solvers are restricted to the moves of the grid, and are therefore
+     *          "staircase-shaped". The methods of this class remove redundant vertices from such paths, leaving
+     *          only those which are required to keep every segment of the path unobstructed.\n\n
+     *
+     *          All methods operate directly on a `mazes::grid`, and smoothing is performed in place without
+     *          allocating. Smoothed paths are any-angle, and consecutive coordinates are no longer adjacent.
+     *
+     * @remarks Usage of this class is intended to be thread-safe as all methods are static and do not rely on any mutable state.
+     *
+     * @see solvers::solver::solve_smoothed()
+     */
+    struct smoothing final {
+
+         smoothing()                             = delete;
+         smoothing           (const smoothing& ) = delete;
+         smoothing           (const smoothing&&) = delete;
+         smoothing& operator=(const smoothing& ) = delete;
+         smoothing& operator=(const smoothing&&) = delete;
+        ~smoothing()                             = delete;
+
+        /**
+         * @brief Determines whether a cell of a grid is active.
+         * @details Bit grids are read from their packed representation directly, rather than through a node proxy.
+         */
+        template <typename maze_t>
+        [[nodiscard]] HOT static constexpr bool active(const maze_t& _maze, size_t _index) noexcept {
+
+            if constexpr (std::is_same_v<std::decay_t<decltype(_maze.nodes())>, std::vector<bool>>) {
+                return !_maze.nodes()[_index];
+            }
+            else {
+                return _maze[_index].is_active();
+            }
+        }
+
+    public:
+
+        /**
+         * @brief Determines whether the straight line between the centres of two cells is unobstructed.
+         *
+         * @details Walks the supercover of the line, i.e. every cell that the line passes through, using an integer
+         *          digital differential analyser generalised to K dimensions. Each step advances along the axis whose
+         *          next cell boundary is nearest, and comparisons are made by cross-multiplication so no floating
+         *          point arithmetic is used.\n\n
+         *
+         *          When the line passes exactly through a corner, the cells touching that corner must also be
+         *          active, so a line of sight never squeezes between two diagonally-adjacent obstacles.
+         *
+         * @param [in] _maze The grid to test against.
+         * @param [in]    _a The first cell.
+         * @param [in]    _b The second cell.
+         *
+         * @pre Both `_a` and `_b` must lie within the bounds of `_maze`.
+         *
+         * @return `true` if every cell covered by the line is active, otherwise `false`.
+         */
+        template <typename maze_t, typename coord_t>
+        [[maybe_unused, nodiscard]] HOT static constexpr bool line_of_sight(const maze_t& _maze, const coord_t& _a, const coord_t& _b) noexcept {
+
+            constexpr auto Kd = std::tuple_size_v<std::decay_t<coord_t>>;
+
+            std::array<int64_t, Kd> delta  {}; // Absolute difference per axis.
+            std::array<int64_t, Kd> stride {}; // Signed change in index per step along an axis.
+            std::array<int64_t, Kd> taken  {}; // Steps taken along an axis.
+
+            int64_t remaining { 0 };
+            int64_t    weight { 1 };
+
+            for (size_t i = 0U; i < Kd; ++i) {
+
+                const auto d = static_cast<int64_t>(_b[i]) - static_cast<int64_t>(_a[i]);
+
+                 delta[i] = utils::abs(d);
+                stride[i] = utils::sign<int64_t>(d) * weight;
+
+                remaining += delta[i];
+                weight    *= static_cast<int64_t>(_maze.size()[i]);
+            }
+
+            auto index = static_cast<int64_t>(utils::to_1d(_a, _maze.size()));
+
+            if (!active(_maze, static_cast<size_t>(index))) {
+                return false;
+            }
+
+            std::array<size_t, Kd> tied {};
+
+            while (remaining > 0) {
+
+                /*
+                 * The k-th boundary along axis i is crossed at t = (2k + 1) / (2 * delta[i]).
+                 * Find the axes whose next crossing is nearest.
+                 */
+                size_t count { 0U };
+
+                for (size_t i = 0U; i < Kd; ++i) {
+
+                    if (taken[i] < delta[i]) {
+
+                        if (count == 0U) {
+                            tied[count++] = i;
+                        }
+                        else {
+
+                            const auto j = tied[0U];
+
+                            const auto lhs = ((2 * taken[i]) + 1) * delta[j];
+                            const auto rhs = ((2 * taken[j]) + 1) * delta[i];
+
+                            if (lhs < rhs) {
+                                count = 0U;
+                                tied[count++] = i;
+                            }
+                            else if (lhs == rhs) {
+                                tied[count++] = i;
+                            }
+                        }
+                    }
+                }
+
+                // Check the cells touching a corner (all partial combinations of the tied steps):
+                if (count > 1U) {
+
+                    const auto full = (static_cast<size_t>(1U) << count) - 1U;
+
+                    for (size_t mask = 1U; mask < full; ++mask) {
+
+                        auto corner = index;
+
+                        for (size_t k = 0U; k < count; ++k) {
+                            if ((mask >> k) & 1U) {
+                                corner += stride[tied[k]];
+                            }
+                        }
+
+                        if (!active(_maze, static_cast<size_t>(corner))) {
+                            return false;
+                        }
+                    }
+                }
+
+                for (size_t k = 0U; k < count; ++k) {
+                    index += stride[tied[k]];
+                    ++taken[tied[k]];
+                }
+
+                remaining -= static_cast<int64_t>(count);
+
+                if (!active(_maze, static_cast<size_t>(index))) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Removes redundant vertices from a path using greedy line-of-sight shortcutting.
+         *
+         * @details Starting from the first coordinate, each vertex is kept only if the following vertex cannot be
+         *          seen from the last kept vertex. The path is compacted in place, and its first and last
+         *          coordinates are always preserved.
+         *
+         * @param [in]      _maze The grid the path was found in.
+         * @param [in, out] _path The path to smooth. Must be a resizable, random-access container of coordinates,
+         *                        in which consecutive coordinates are assumed to be traversable.
+         *
+         * @return Number of vertices removed from the path.
+         *
+         * @see line_of_sight()
+         */
+        template <typename maze_t, typename path_t>
+        [[maybe_unused]] static size_t shortcut(const maze_t& _maze, path_t& _path) {
+
+            const auto n = _path.size();
+
+            if (n <= 2U) {
+                return 0U;
+            }
+
+            size_t last { 0U }; // Index of the last kept vertex.
+
+            for (size_t i = 1U; i < n - 1U; ++i) {
+
+                if (!line_of_sight(_maze, _path[last], _path[i + 1U])) {
+                    _path[++last] = _path[i];
+                }
+            }
+
+            _path[++last] = _path[n - 1U];
+            _path.resize(last + 1U);
+
+            return n - _path.size();
+        }
+
+        /**
+         * @brief Pulls a path taut by repeated line-of-sight shortcutting.
+         *
+         * @details Greedy shortcutting only considers vertices in one direction, and may keep vertices which are
+         *          visible from further back along the path. This method alternates shortcutting passes over the
+         *          path in forward and reverse order until a pass no longer removes any vertices.
+         *
+         * @param [in]      _maze The grid the path was found in.
+         * @param [in, out] _path The path to smooth. Must be a resizable, random-access container of coordinates,
+         *                        in which consecutive coordinates are assumed to be traversable.
+         *
+         * @return Number of vertices removed from the path.
+         *
+         * @see shortcut()
+         */
+        template <typename maze_t, typename path_t>
+        [[maybe_unused]] static size_t string_pull(const maze_t& _maze, path_t& _path) {
+
+            size_t result { shortcut(_maze, _path) };
+
+            for (bool reversed = false;; reversed = !reversed) {
+
+                std::reverse(_path.begin(), _path.end());
+
+                const auto removed = shortcut(_maze, _path);
+                result += removed;
+
+                if (removed == 0U) {
+                    if (!reversed) {
+                        std::reverse(_path.begin(), _path.end());
+                    }
+                    break;
+                }
+            }
+
+            return result;
+        }
+    };
+
+} //chdr
+
+#endif //CHDR_SMOOTHING_HPP
@@ -0,0 +1,23 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+/**
+ * @file precompiled_2d.cpp
+ * @brief Instantiates the solver registries of 2-dimensional grids for `libchdr_static`. See `precompiled.hpp`.
+ */
+
+#include "../chdr.hpp"
+
+namespace chdr::solvers {
+
+    template class registry<precompiled_params<2U, bool, false>>;
+    template class registry<precompiled_params<2U, bool,  true>>;
+    template class registry<precompiled_params<2U, char, false>>;
+    template class registry<precompiled_params<2U, char,  true>>;
+
+} //chdr::solvers
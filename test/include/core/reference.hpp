@@ -0,0 +1,161 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_REFERENCE_HPP
+#define TEST_REFERENCE_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../generator/utils/lcg.hpp"
+
+namespace test {
+
+    /**
+     * @brief Shared helpers for the behavioural checks.
+     *
+     * @details Provides unoptimised reference implementations which the results of the library are compared against,
+     *          and a generator for the small random grids which the checks iterate over.
+     */
+    struct reference final {
+
+        /** @brief Distance of a node which cannot be reached from the root. */
+        static constexpr size_t unreachable_v = std::numeric_limits<size_t>::max();
+
+        /**
+         * @brief Generates a grid with obstacles placed uniformly at random.
+         *
+         * @details The first and last cells are always left traversable. Unlike `generator::obstacles`, the grid is
+         *          not guaranteed to be solvable, and nothing is logged.
+         */
+        template <typename weight_t, typename coord_t>
+        [[nodiscard]] static chdr::mazes::grid<coord_t, weight_t> random_grid(const coord_t& _size, double _density, size_t _seed) {
+
+            generator::utils::lcg<size_t> rng(_seed);
+
+            const auto threshold = static_cast<size_t>(static_cast<double>(decltype(rng)::max()) * _density);
+
+            std::vector<weight_t> nodes(chdr::utils::product<size_t>(_size), std::numeric_limits<weight_t>::lowest());
+
+            for (size_t i = 1U; i + 1U < nodes.size(); ++i) {
+                if (rng() <= threshold) {
+                    nodes[i] = std::numeric_limits<weight_t>::max();
+                }
+            }
+
+            return { _size, nodes };
+        }
+
+        /**
+         * @brief Computes the number of steps from `_root` to every cell of a grid using a plain breadth-first search.
+         * @return Distance of every cell, indexed by its index. `unreachable_v` for cells which cannot be reached.
+         */
+        template <bool Octile, typename maze_t, typename coord_t>
+        [[nodiscard]] static std::vector<size_t> distances(const maze_t& _maze, const coord_t& _root) {
+
+            using index_t = typename coord_t::value_type;
+
+            std::vector<size_t> result(_maze.count(), unreachable_v);
+
+            const auto root = static_cast<size_t>(chdr::utils::to_1d(_root, _maze.size()));
+
+            if (!_maze[root].is_active()) {
+                return result;
+            }
+
+            std::vector<size_t> frontier { root };
+            result[root] = 0U;
+
+            for (size_t i = 0U; i < frontier.size(); ++i) {
+
+                const auto curr = frontier[i];
+
+                for (const auto& [active, coord] : _maze.template get_neighbours<Octile>(static_cast<index_t>(curr))) {
+
+                    if (const auto n = static_cast<size_t>(chdr::utils::to_1d(coord, _maze.size())); active && result[n] == unreachable_v) {
+                        result[n] = result[curr] + 1U;
+                        frontier.emplace_back(n);
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Determines whether two cells are neighbours of one another.
+         */
+        template <bool Octile, typename coord_t>
+        [[nodiscard]] static constexpr bool adjacent(const coord_t& _a, const coord_t& _b) noexcept {
+
+            size_t sum { 0U };
+            size_t max { 0U };
+
+            for (size_t i = 0U; i < _a.size(); ++i) {
+                const auto d = static_cast<size_t>(_a[i] > _b[i] ? _a[i] - _b[i] : _b[i] - _a[i]);
+                sum += d;
+                max  = chdr::utils::max(max, d);
+            }
+
+            return Octile ? max == 1U : sum == 1U;
+        }
+
+        /**
+         * @brief Determines whether a path may be walked between two cells of a grid.
+         *
+         * @details Expects the layout of paths produced with `reverse_equivalence` disabled, i.e. from the end to the
+         *          node after the start, or the end alone if the start and end are the same cell. Every cell of the path
+         *          must be traversable and adjacent to the next.
+         */
+        template <bool Octile, typename maze_t, typename coord_t>
+        [[nodiscard]] static bool walkable(const maze_t& _maze, const std::vector<coord_t>& _path, const coord_t& _start, const coord_t& _end) {
+
+            if (_path.empty() || _path.front() != _end) {
+                return false;
+            }
+
+            for (size_t i = 0U; i < _path.size(); ++i) {
+
+                for (size_t j = 0U; j < _path[i].size(); ++j) {
+                    if (_path[i][j] >= _maze.size()[j]) {
+                        return false;
+                    }
+                }
+
+                if (!_maze[_path[i]].is_active()) {
+                    return false;
+                }
+
+                if (i + 1U < _path.size() && !adjacent<Octile>(_path[i], _path[i + 1U])) {
+                    return false;
+                }
+            }
+
+            return _start == _end ? _path.size() == 1U : adjacent<Octile>(_path.back(), _start);
+        }
+
+        /**
+         * @brief Logs the outcome of a check.
+         * @return `_pass`.
+         */
+        static bool report(const std::string& _name, bool _pass, const std::string& _detail = {}) {
+
+            debug::log("\t" + std::string(_pass ? "[PASS]" : "[FAIL]") + "\t" + _name + (_detail.empty() ? "" : " (" + _detail + ")"), _pass ? info : error);
+
+            return _pass;
+        }
+    };
+
+} //test::reference
+
+#endif //TEST_REFERENCE_HPP
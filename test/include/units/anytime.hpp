@@ -0,0 +1,105 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_ANYTIME_HPP
+#define TEST_ANYTIME_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks the paths published by `arastar` against those of `astar`.
+     *
+     * @details On random grids, an unbounded search starting from a heavily-inflated heuristic must finish with a path
+     *          as short as that of A*. A search interrupted by an expansion budget must report `exhausted`, and any
+     *          path it returns must still be walkable.
+     */
+    struct anytime final {
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using weight_t = typename params_t::weight_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            using check_params_t = chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t, false>;
+
+            constexpr size_t samples { 100U };
+
+            size_t optimal   { 0U };
+            size_t walkable  { 0U };
+            size_t exhausted { 0U };
+            size_t  deferred { 0U };
+
+            debug::log("(Anytime):");
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                const auto maze = reference::random_grid<weight_t>(_params.size, 0.3, seed);
+
+                const auto make = [&](scalar_t _weight, chdr::solvers::budget _budget) {
+                    return check_params_t {
+                        maze, _params.start, _params.end, _params.size, chdr::heuristics::manhattan_distance<scalar_t, coord_t>,
+                        _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr,
+                        _weight, 0U, std::numeric_limits<size_t>::max(), _budget, 0U
+                    };
+                };
+
+                const auto baseline = chdr::solvers::solver<chdr::solvers::  astar, check_params_t>::search(make(static_cast<scalar_t>(1), {}));
+                const auto  anytime = chdr::solvers::solver<chdr::solvers::arastar, check_params_t>::search(make(static_cast<scalar_t>(4), {}));
+
+                if (anytime.status == baseline.status && anytime.path.size() == baseline.path.size() &&
+                    (anytime.path.empty() || reference::walkable<false>(maze, anytime.path, _params.start, _params.end))
+                ) {
+                    ++optimal;
+                }
+
+                chdr::solvers::budget budget {};
+                budget.expansions = 8U;
+
+                const auto interrupted = chdr::solvers::solver<chdr::solvers::arastar, check_params_t>::search(make(static_cast<scalar_t>(4), budget));
+
+                // Any path longer than the budget cannot have been found within it:
+                if (baseline.path.size() > budget.expansions) {
+
+                    ++deferred;
+
+                    if (interrupted.status == chdr::solvers::search_status::exhausted) {
+                        ++exhausted;
+                    }
+                }
+
+                if (interrupted.path.empty() || (
+                        reference::walkable<false>(maze, interrupted.path, _params.start, _params.end) &&
+                        interrupted.path.size() >= baseline.path.size()
+                    )
+                ) {
+                    ++walkable;
+                }
+            }
+
+            bool result = reference::report("Unbounded paths match A*", optimal == samples, std::to_string(optimal) + "/" + std::to_string(samples));
+            result &= reference::report("Interrupted paths are walkable", walkable == samples, std::to_string(walkable) + "/" + std::to_string(samples));
+            result &= reference::report("Budget exhaustion is reported", deferred > 0U && exhausted == deferred, std::to_string(exhausted) + "/" + std::to_string(deferred));
+
+            return result;
+        }
+    };
+
+} //test::anytime
+
+#endif //TEST_ANYTIME_HPP
@@ -0,0 +1,141 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_BREADTH_FIRST_HPP
+#define TEST_BREADTH_FIRST_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace test {
+
+    /**
+     * @brief Measures the scalability of the parallel `distance_map` against a sequential breadth-first search.
+     *
+     * @details The grid is converted to a graph, and a compressed copy of it is searched from the start to every
+     *          vertex by a plain, single-threaded, queue-based breadth-first search. The direction-optimising search of
+     *          `distance_map` is then timed over the same graph using 1, 2, 4, 8, 16 and 32 threads. The fastest of
+     *          several samples is reported for each, alongside its speed-up relative to the sequential search and
+     *          relative to a single thread. The distance of every vertex is checked against the sequential search.
+     *
+     * @note Thread counts beyond the number of hardware threads oversubscribe the cores, and are expected to be slower.
+     */
+    struct breadth_first final {
+
+        template <typename params_t>
+        static void run(const params_t& _params) {
+
+            using index_t = typename params_t::index_type;
+            using   map_t = chdr::mazes::distance_map<index_t>;
+
+            /* TEST SAMPLES */
+#ifndef NDEBUG
+            constexpr size_t base_samples = 1UL;
+#else //!NDEBUG
+            constexpr size_t base_samples = 100000000UL;
+#endif //!NDEBUG
+
+            const size_t test_samples = chdr::utils::max(chdr::utils::sqrt(base_samples / _params.maze.count()), static_cast<size_t>(1U));
+
+            debug::log("(Graph):");
+
+            const chdr::mazes::graph<index_t, typename params_t::scalar_type> graph(_params.maze);
+            const chdr::mazes::csr<index_t> copy(graph);
+
+            debug::log("\t" + std::to_string(copy.count()) + " vertices, " + std::to_string(copy.edges()) + " edges");
+
+            const auto s = static_cast<index_t>(chdr::utils::to_1d(_params.start, _params.size));
+
+            /* SEQUENTIAL */
+            debug::log("(Sequential BFS):");
+            chdr::malloc_consolidate();
+
+            std::vector<size_t>  baseline;
+            std::vector<index_t> queue;
+
+            auto serial_time = std::numeric_limits<long double>::max();
+            for (size_t i = 0U; i < test_samples; ++i) {
+
+                const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                baseline.assign(copy.count(), map_t::unreachable);
+                queue.clear();
+
+                if (const auto root = copy.dense(s); root != chdr::mazes::csr<index_t>::null) {
+                    baseline[root] = 0U;
+                    queue.emplace_back(root);
+                }
+
+                for (size_t head = 0U; head < queue.size(); ++head) {
+
+                    const auto u = queue[head];
+
+                    for (auto e = copy.begin(u); e != copy.end(u); ++e) {
+
+                        if (const auto v = copy.target(e); baseline[v] == map_t::unreachable) {
+                            baseline[v] = baseline[u] + 1U;
+                            queue.emplace_back(v);
+                        }
+                    }
+                }
+
+                serial_time = chdr::utils::min(serial_time, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+            }
+
+            debug::log("\t" + std::to_string(queue.size()) + " reached\t(<= ~" + chdr::utils::to_string(serial_time) + ")");
+
+            /* DIRECTION-OPTIMISING */
+            debug::log("(Distance Map, " + std::to_string(chdr::parallel::max_threads()) + " hardware threads):");
+
+            map_t map(graph, s);
+
+            auto single_time = std::numeric_limits<long double>::max();
+
+            for (const size_t threads : std::array<size_t, 6U> { 1U, 2U, 4U, 8U, 16U, 32U }) {
+
+                chdr::malloc_consolidate();
+
+                auto map_time = std::numeric_limits<long double>::max();
+                for (size_t i = 0U; i < test_samples; ++i) {
+
+                    const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                    map.generate({ s }, threads);
+
+                    map_time = chdr::utils::min(map_time, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+                }
+
+                if (threads == 1U) {
+                    single_time = map_time;
+                }
+
+                size_t mismatches { 0U };
+                for (size_t v = 0U; v < copy.count(); ++v) {
+                    if (static_cast<size_t>(map.distance(copy.id(static_cast<index_t>(v)))) != baseline[v]) {
+                        ++mismatches;
+                    }
+                }
+
+                debug::log("\t" + std::to_string(threads) + " threads\t(<= ~" + chdr::utils::to_string(map_time) + ")" +
+                    "\tx" + std::to_string(static_cast<double>(serial_time / map_time)) + " vs sequential" +
+                    "\tx" + std::to_string(static_cast<double>(single_time / map_time)) + " vs 1 thread" +
+                    (mismatches == 0U ? "\t[MATCH]" : "\t[MISMATCH] " + std::to_string(mismatches) + " distances"), mismatches == 0U ? info : error);
+            }
+        }
+    };
+
+} //test::breadth_first
+
+#endif //TEST_BREADTH_FIRST_HPP
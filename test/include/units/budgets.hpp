@@ -0,0 +1,154 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_BUDGETS_HPP
+#define TEST_BUDGETS_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks that each limit of a `chdr::solvers::budget` interrupts a search.
+     *
+     * @details On random grids with a path, `astar` is run once without a budget, and then once under each of: an
+     *          expansion limit shorter than the path, a deadline in the past, and a raised cancellation flag. Each
+     *          interrupted search must report `exhausted` and return no path, and `solve()` must return no path either.
+     *          A budget which is never reached must not change the result.\n\n
+     *
+     *          Footprints only count heap blocks, and are polled every few hundred expansions, so the byte limit is
+     *          checked with `dijkstra` on an open grid large enough to reach both.
+     */
+    struct budgets final {
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using weight_t = typename params_t::weight_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            using check_params_t = chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t, false>;
+            using       solver_t = chdr::solvers::solver<chdr::solvers::astar, check_params_t>;
+
+            constexpr size_t samples { 100U };
+
+            size_t  solvable { 0U };
+            size_t unchanged { 0U };
+            size_t expansions { 0U };
+            size_t  deadline { 0U };
+            size_t    cancel { 0U };
+
+            const std::atomic<bool> cancelled { true };
+
+            debug::log("(Budget):");
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                const auto maze = reference::random_grid<weight_t>(_params.size, 0.3, seed);
+
+                const auto make = [&](chdr::solvers::budget _budget) {
+                    return check_params_t {
+                        maze, _params.start, _params.end, _params.size, chdr::heuristics::manhattan_distance<scalar_t, coord_t>,
+                        _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr,
+                        static_cast<scalar_t>(1), 0U, std::numeric_limits<size_t>::max(), _budget, 0U
+                    };
+                };
+
+                const auto baseline = solver_t::search(make({}));
+
+                if (baseline.status != chdr::solvers::search_status::found || baseline.path.size() < 2U) {
+                    continue;
+                }
+
+                ++solvable;
+
+                const auto interrupted = [&](chdr::solvers::budget _budget) {
+                    const auto args   = make(_budget);
+                    const auto result = solver_t::search(args);
+                    return result.status == chdr::solvers::search_status::exhausted && result.path.empty() && solver_t::solve(args).empty();
+                };
+
+                chdr::solvers::budget budget {};
+
+                // Limits which are never reached:
+                budget.expansions = _params.maze.count();
+                budget.deadline   = std::chrono::steady_clock::now() + std::chrono::hours(1);
+
+                if (const auto result = solver_t::search(make(budget)); result.status == baseline.status && result.path == baseline.path) {
+                    ++unchanged;
+                }
+
+                budget = {};
+                budget.expansions = baseline.path.size() - 1U;
+                expansions += interrupted(budget) ? 1U : 0U;
+
+                budget = {};
+                budget.deadline = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+                deadline += interrupted(budget) ? 1U : 0U;
+
+                budget = {};
+                budget.cancel = &cancelled;
+                cancel += interrupted(budget) ? 1U : 0U;
+            }
+
+            // Byte limit:
+            bool bytes { false };
+            {
+                constexpr auto Kd = std::tuple_size_v<coord_t>;
+
+                coord_t size {};
+                coord_t  end {};
+
+                for (size_t i = 0U; i < Kd; ++i) {
+                    size[i] = static_cast<typename coord_t::value_type>(chdr::utils::powui(static_cast<size_t>(2U), 16U / Kd));
+                     end[i] = size[i] - 1U;
+                }
+
+                const chdr::mazes::grid<coord_t, weight_t> maze(size, std::vector<weight_t>(chdr::utils::product<size_t>(size), std::numeric_limits<weight_t>::lowest()));
+
+                chdr::solvers::budget budget {};
+                budget.bytes = 1U;
+
+                const check_params_t args {
+                    maze, _params.start, end, size, chdr::heuristics::manhattan_distance<scalar_t, coord_t>,
+                    _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr,
+                    static_cast<scalar_t>(1), 0U, std::numeric_limits<size_t>::max(), budget, 0U
+                };
+
+                const auto result = chdr::solvers::solver<chdr::solvers::dijkstra, check_params_t>::search(args);
+
+                bytes = result.status == chdr::solvers::search_status::exhausted && result.path.empty();
+            }
+
+            const auto fraction = [&](size_t _count) { return std::to_string(_count) + "/" + std::to_string(solvable); };
+
+            bool result = reference::report("Unreached limits leave the path unchanged", solvable > 0U && unchanged == solvable, fraction(unchanged));
+            result &= reference::report("Expansion limit interrupts the search", expansions == solvable, fraction(expansions));
+            result &= reference::report("Deadline interrupts the search",         deadline == solvable, fraction(  deadline));
+            result &= reference::report("Byte limit interrupts the search",          bytes);
+            result &= reference::report("Cancellation interrupts the search",       cancel == solvable, fraction(    cancel));
+
+            return result;
+        }
+    };
+
+} //test::budgets
+
+#endif //TEST_BUDGETS_HPP
@@ -0,0 +1,122 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_BUFFERS_HPP
+#define TEST_BUFFERS_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks the paths written into caller-provided buffers against those returned by `solve()`.
+     *
+     * @details On random grids, `solve_into()` must write the same coordinates as `solve()` returns, and
+     *          `solve_indices()` their indices, leaving the rest of the buffer untouched. Solvers with a resumable
+     *          `context` (which write directly from the search tree) are checked alongside one without (which copies).
+     */
+    struct buffers final {
+
+    private:
+
+        template <template <typename> typename solver_t, typename params_t>
+        [[nodiscard]] static bool matches(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using  index_t = typename params_t:: index_type;
+
+            using search_t = chdr::solvers::solver<solver_t, params_t>;
+
+            const auto expected = search_t::solve(_params);
+
+            // Sentinels past the end of the path must not be overwritten:
+            coord_t sentinel {};
+            sentinel.fill(std::numeric_limits<typename coord_t::value_type>::max());
+
+            std::vector<coord_t> coords(_params.maze.count() + 1U, sentinel);
+            std::vector<index_t> indices(_params.maze.count() + 1U, std::numeric_limits<index_t>::max());
+
+            const auto coords_end  = search_t::solve_into   (_params, coords .data());
+            const auto indices_end = search_t::solve_indices(_params, indices.data());
+
+            if (static_cast<size_t>(coords_end  - coords .data()) != expected.size() ||
+                static_cast<size_t>(indices_end - indices.data()) != expected.size() ||
+                coords [expected.size()] != sentinel ||
+                indices[expected.size()] != std::numeric_limits<index_t>::max()
+            ) {
+                return false;
+            }
+
+            for (size_t i = 0U; i < expected.size(); ++i) {
+                if (coords[i] != expected[i] || indices[i] != static_cast<index_t>(chdr::utils::to_1d(expected[i], _params.size))) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    public:
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using weight_t = typename params_t::weight_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            using check_params_t = chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t, false>;
+
+            constexpr size_t samples { 100U };
+
+            size_t context  { 0U };
+            size_t fallback { 0U };
+
+            debug::log("(Buffers):");
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                const auto maze = reference::random_grid<weight_t>(_params.size, 0.3, seed);
+
+                const check_params_t args {
+                    maze, _params.start, _params.end, _params.size, chdr::heuristics::manhattan_distance<scalar_t, coord_t>,
+                    _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr,
+                    static_cast<scalar_t>(1), 0U, std::numeric_limits<size_t>::max(), {}, 0U
+                };
+
+                if (matches<chdr::solvers::   astar>(args) &&
+                    matches<chdr::solvers::   gstar>(args) &&
+                    matches<chdr::solvers::     bfs>(args) &&
+                    matches<chdr::solvers::dijkstra>(args)
+                ) {
+                    ++context;
+                }
+
+                if (matches<chdr::solvers::best_first>(args)) {
+                    ++fallback;
+                }
+            }
+
+            bool result = reference::report("Paths written from the search tree match solve()", context == samples, std::to_string(context) + "/" + std::to_string(samples));
+            result &= reference::report("Paths copied from solve() match solve()", fallback == samples, std::to_string(fallback) + "/" + std::to_string(samples));
+
+            return result;
+        }
+    };
+
+} //test::buffers
+
+#endif //TEST_BUFFERS_HPP
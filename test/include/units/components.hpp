@@ -0,0 +1,122 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_COMPONENTS_HPP
+#define TEST_COMPONENTS_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks `chdr::mazes::components` against a reference breadth-first search.
+     *
+     * @details On random grids, two active cells must be reported as connected exactly when the reference can reach
+     *          one from the other. After a blocked cell becomes active and is passed to `insert()`, the index must
+     *          agree with the reference on the edited grid.
+     */
+    struct components final {
+
+    private:
+
+        /**
+         * @brief Counts the pairs of active cells for which the index disagrees with the reference.
+         */
+        template <typename index_t, typename maze_t>
+        [[nodiscard]] static size_t mismatches(const chdr::mazes::components<index_t>& _index, const maze_t& _maze, const std::vector<index_t>& _cells) {
+
+            size_t result { 0U };
+
+            for (const auto& a : _cells) {
+
+                const auto distances = reference::distances<false>(_maze, chdr::utils::to_nd(a, _maze.size()));
+
+                for (const auto& b : _cells) {
+                    if (_index.connected(a, b) != (distances[static_cast<size_t>(b)] != reference::unreachable_v)) {
+                        ++result;
+                    }
+                }
+            }
+
+            return result;
+        }
+
+    public:
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  index_t = typename params_t:: index_type;
+            using weight_t = typename params_t::weight_type;
+
+            constexpr size_t samples { 50U };
+            constexpr size_t   cells { 24U };
+
+            size_t  built { 0U };
+            size_t  grown { 0U };
+            size_t opened { 0U };
+
+            debug::log("(Components):");
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                auto maze = reference::random_grid<weight_t>(_params.size, 0.4, seed);
+
+                generator::utils::lcg<size_t> rng(seed);
+
+                // A random selection of active cells to query between:
+                std::vector<index_t> active;
+                for (size_t i = 0U; i < cells * 4U && active.size() < cells; ++i) {
+                    if (const auto id = static_cast<index_t>(rng() % maze.count()); maze[id].is_active()) {
+                        active.emplace_back(id);
+                    }
+                }
+
+                chdr::mazes::components<index_t> index(maze);
+
+                built += mismatches(index, maze, active) == 0U ? 1U : 0U;
+
+                // Open a blocked cell, which may join previously separate components:
+                for (size_t i = 0U; i < maze.count(); ++i) {
+
+                    if (const auto id = static_cast<index_t>(rng() % maze.count()); !maze[id].is_active()) {
+
+                        ++opened;
+
+                        auto nodes = maze.nodes();
+                        nodes[static_cast<size_t>(id)] = std::numeric_limits<weight_t>::lowest();
+                        maze.nodes(nodes);
+
+                        index.insert(maze, id);
+                        active.emplace_back(id);
+
+                        grown += mismatches(index, maze, active) == 0U ? 1U : 0U;
+
+                        break;
+                    }
+                }
+            }
+
+            bool result = reference::report("Connectivity matches the reference", built == samples, std::to_string(built) + "/" + std::to_string(samples));
+            result &= reference::report("Connectivity after insert() matches the reference", opened > 0U && grown == opened, std::to_string(grown) + "/" + std::to_string(opened));
+
+            return result;
+        }
+    };
+
+} //test::components
+
+#endif //TEST_COMPONENTS_HPP
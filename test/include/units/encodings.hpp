@@ -0,0 +1,145 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_ENCODINGS_HPP
+#define TEST_ENCODINGS_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks that `rle_path` and `waypoint_path` expand back into the paths they encode.
+     *
+     * @details On random grids, paths encoded during backtracking by `solve_as()` must expand into the path returned
+     *          by `solve()`, both for a solver which encodes from its search tree and for one which encodes a copy.
+     *          Encoded paths must also survive `reverse()`, and a run longer than `count_t` can represent must be
+     *          split without losing any steps.
+     */
+    struct encodings final {
+
+    private:
+
+        template <typename path_t, typename coord_t>
+        [[nodiscard]] static bool expands(const path_t& _path, const std::vector<coord_t>& _expected) {
+            return _path.size() == _expected.size() &&
+                   std::equal(_path.begin(), _path.end(), _expected.begin(), _expected.end()) &&
+                   _path.decode() == _expected;
+        }
+
+        template <typename path_t, typename coord_t>
+        [[nodiscard]] static bool reverses(const std::vector<coord_t>& _expected) {
+
+            path_t path {};
+            for (const auto& coord : _expected) {
+                path.push_back(coord);
+            }
+            path.reverse();
+
+            return expands(path, std::vector<coord_t>(_expected.rbegin(), _expected.rend()));
+        }
+
+        template <template <typename> typename solver_t, typename params_t>
+        [[nodiscard]] static bool matches(const params_t& _params) {
+
+            using coord_t = typename params_t::coord_type;
+
+            using search_t = chdr::solvers::solver<solver_t, params_t>;
+
+            const auto expected = search_t::solve(_params);
+
+            return expands(search_t::template solve_as<chdr::     rle_path<coord_t>>(_params), expected) &&
+                   expands(search_t::template solve_as<chdr::waypoint_path<coord_t>>(_params), expected) &&
+                   reverses<chdr::     rle_path<coord_t>>(expected) &&
+                   reverses<chdr::waypoint_path<coord_t>>(expected);
+        }
+
+    public:
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using weight_t = typename params_t::weight_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            using check_params_t = chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t, false>;
+
+            constexpr size_t samples { 100U };
+
+            size_t context  { 0U };
+            size_t fallback { 0U };
+
+            debug::log("(Encodings):");
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                const auto maze = reference::random_grid<weight_t>(_params.size, 0.3, seed);
+
+                const check_params_t args {
+                    maze, _params.start, _params.end, _params.size, chdr::heuristics::manhattan_distance<scalar_t, coord_t>,
+                    _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr,
+                    static_cast<scalar_t>(1), 0U, std::numeric_limits<size_t>::max(), {}, 0U
+                };
+
+                if (matches<chdr::solvers::astar>(args)) {
+                    ++context;
+                }
+
+                if (matches<chdr::solvers::best_first>(args)) {
+                    ++fallback;
+                }
+            }
+
+            // A straight run followed by a diagonal one, each longer than a run of `uint8_t` can hold:
+            std::vector<coord_t> line { coord_t {} };
+            for (size_t i = 0U; i < 600U; ++i) {
+                auto next = line.back();
+                ++next[0U];
+                line.emplace_back(next);
+            }
+            for (size_t i = 0U; i < 300U; ++i) {
+                auto next = line.back();
+                for (auto& axis : next) {
+                    ++axis;
+                }
+                line.emplace_back(next);
+            }
+
+            chdr::rle_path<coord_t, uint8_t> split {};
+            for (const auto& coord : line) {
+                split.push_back(coord);
+            }
+
+            chdr::waypoint_path<coord_t> turns {};
+            for (const auto& coord : line) {
+                turns.push_back(coord);
+            }
+
+            bool result = reference::report("Paths encoded from the search tree expand into solve()", context == samples, std::to_string(context) + "/" + std::to_string(samples));
+            result &= reference::report("Paths encoded from a copy expand into solve()", fallback == samples, std::to_string(fallback) + "/" + std::to_string(samples));
+            result &= reference::report("Long runs are split without losing steps", split.runs() > 2U && expands(split, line), std::to_string(split.runs()) + " runs");
+            result &= reference::report("Waypoints are only stored at turns", turns.waypoints().size() <= 3U && expands(turns, line), std::to_string(turns.waypoints().size()) + " waypoints");
+
+            return result;
+        }
+    };
+
+} //test::encodings
+
+#endif //TEST_ENCODINGS_HPP
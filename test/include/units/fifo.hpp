@@ -0,0 +1,184 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_FIFO_HPP
+#define TEST_FIFO_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+namespace test {
+
+    /**
+     * @brief Compares the ring-buffer `chdr::queue` against a queue backed by `std::pmr::deque`.
+     *
+     * @details Both containers allocate from the heterogeneous pool of the parameters, and are timed performing:
+     *          - A breadth-first traversal of the maze from the start, which is the access pattern of `bfs`, `gbfs`
+     *            and `flood`.
+     *          - A synthetic benchmark, which pushes and pops the same number of elements in a steady state.
+     */
+    struct fifo final {
+
+    private:
+
+        /** @brief Minimal FIFO interface over `std::pmr::deque`, equivalent to the previous implementation of `chdr::queue`. */
+        template <typename T>
+        struct deque_queue final {
+
+            std::pmr::deque<T> c;
+
+            explicit deque_queue(std::pmr::memory_resource* _resource) : c(_resource) {}
+
+            [[nodiscard]] bool empty() const noexcept { return c.empty(); }
+            [[nodiscard]] size_t  size() const noexcept { return c.size();  }
+            [[nodiscard]] T&     front()       noexcept { return c.front(); }
+
+            template <typename... Args>
+            void emplace(Args&&... _args) { c.emplace_back(std::forward<Args>(_args)...); }
+
+            void pop() { c.pop_front(); }
+        };
+
+        template <typename queue_t, typename params_t>
+        [[nodiscard]] static size_t traverse(const params_t& _params) {
+
+            using index_t = typename params_t::index_type;
+
+            size_t result = 0U;
+
+            queue_t open(_params.heterogeneous_pmr);
+            chdr::existence_set<> closed(_params.maze.count(), _params.monotonic_pmr);
+
+            const auto s = static_cast<index_t>(chdr::utils::to_1d(_params.start, _params.size));
+
+            open.emplace(s);
+            closed.emplace(s);
+
+            while (!open.empty()) {
+
+                const auto curr = open.front();
+                open.pop();
+
+                ++result;
+
+                for (const auto& [active, coord] : _params.maze.template get_neighbours<params_t::octile_neighbours::value>(curr)) {
+
+                    if (active) {
+
+                        if (const auto n = static_cast<index_t>(chdr::utils::to_1d(coord, _params.size)); !closed.contains(n)) {
+                            closed.emplace(n);
+                            open.emplace(n);
+                        }
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        template <typename queue_t, typename params_t>
+        [[nodiscard]] static size_t churn(const params_t& _params, size_t _count) {
+
+            size_t result = 0U;
+
+            queue_t open(_params.heterogeneous_pmr);
+
+            // Keep a steady backlog of elements, as a breadth-first frontier does:
+            for (size_t i = 0U; i < 1024U; ++i) {
+                open.emplace(i);
+            }
+
+            for (size_t i = 0U; i < _count; ++i) {
+                result += open.front();
+                open.pop();
+                open.emplace(i);
+            }
+
+            return result;
+        }
+
+        template <typename params_t, typename function_t>
+        [[nodiscard]] static long double time(const params_t& _params, size_t _samples, function_t&& _function) {
+
+            auto result = std::numeric_limits<long double>::max();
+
+            for (size_t i = 0U; i < _samples; ++i) {
+
+                chdr::malloc_consolidate();
+
+                const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                _function();
+
+                result = chdr::utils::min(result, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+
+                _params.    monotonic_pmr->reset();
+                _params.heterogeneous_pmr->reset();
+                _params.  homogeneous_pmr->reset();
+            }
+
+            return result;
+        }
+
+    public:
+
+        template <typename params_t>
+        static void run(const params_t& _params) {
+
+            using index_t = typename params_t::index_type;
+
+            /* TEST SAMPLES */
+#ifndef NDEBUG
+            constexpr size_t base_samples = 1UL;
+#else //!NDEBUG
+            constexpr size_t base_samples = 100000000UL;
+#endif //!NDEBUG
+
+            const size_t test_samples = chdr::utils::max(chdr::utils::sqrt(base_samples / _params.maze.count()), static_cast<size_t>(1U));
+
+            /* TRAVERSAL */
+            debug::log("(Traversal):");
+
+            size_t visited_ring  = 0U;
+            size_t visited_deque = 0U;
+
+            const auto ring_traversal  = time(_params, test_samples, [&]() { visited_ring  = traverse<chdr::queue<index_t>>(_params); });
+            const auto deque_traversal = time(_params, test_samples, [&]() { visited_deque = traverse<deque_queue<index_t>>(_params); });
+
+            debug::log("\tstd::pmr::deque\t(<= ~" + chdr::utils::to_string(deque_traversal) + ")\t" + std::to_string(visited_deque) + " nodes");
+            debug::log("\tchdr::queue\t(<= ~"     + chdr::utils::to_string(ring_traversal)  + ")\t" + std::to_string(visited_ring)  + " nodes\tx" +
+                std::to_string(static_cast<double>(deque_traversal / ring_traversal)), visited_ring == visited_deque ? info : error);
+
+            /* CHURN */
+            debug::log("(Push/Pop):");
+
+            const size_t count = chdr::utils::max(_params.maze.count(), static_cast<size_t>(1000000U));
+
+            size_t sum_ring  = 0U;
+            size_t sum_deque = 0U;
+
+            const auto ring_churn  = time(_params, test_samples, [&]() { sum_ring  = churn<chdr::queue<size_t>>(_params, count); });
+            const auto deque_churn = time(_params, test_samples, [&]() { sum_deque = churn<deque_queue<size_t>>(_params, count); });
+
+            debug::log("\tstd::pmr::deque\t(<= ~" + chdr::utils::to_string(deque_churn) + ")\t" + std::to_string(count) + " operations");
+            debug::log("\tchdr::queue\t(<= ~"     + chdr::utils::to_string(ring_churn)  + ")\t" + std::to_string(count) + " operations\tx" +
+                std::to_string(static_cast<double>(deque_churn / ring_churn)), sum_ring == sum_deque ? info : error);
+        }
+    };
+
+} //test::fifo
+
+#endif //TEST_FIFO_HPP
@@ -0,0 +1,136 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_FLOW_FIELDS_HPP
+#define TEST_FLOW_FIELDS_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks `chdr::mazes::flow_field` against a reference breadth-first search.
+     *
+     * @details On random grids with one or more goals, the distance of every cell must equal the smallest reference
+     *          distance to any goal. Following `next()` from any reachable cell must then step through adjacent,
+     *          traversable cells and arrive at a goal in exactly that many steps. Fields with and without diagonal
+     *          movement are both checked.
+     */
+    struct flow_fields final {
+
+    private:
+
+        /**
+         * @brief Checks every cell of a field against the reference distances from its goals.
+         */
+        template <bool Octile, typename maze_t, typename coord_t>
+        [[nodiscard]] static bool matches(const maze_t& _maze, const std::vector<coord_t>& _goals) {
+
+            const chdr::mazes::flow_field<coord_t, uint32_t, Octile> field(_maze, _goals);
+
+            // Multi-source distances are the smallest of the single-source distances:
+            std::vector<size_t> expected(_maze.count(), reference::unreachable_v);
+
+            for (const auto& goal : _goals) {
+
+                const auto distances = reference::distances<Octile>(_maze, goal);
+
+                for (size_t i = 0U; i < expected.size(); ++i) {
+                    expected[i] = chdr::utils::min(expected[i], distances[i]);
+                }
+            }
+
+            for (size_t i = 0U; i < expected.size(); ++i) {
+
+                const auto coord = chdr::utils::to_nd(static_cast<typename coord_t::value_type>(i), _maze.size());
+
+                if (expected[i] == reference::unreachable_v) {
+
+                    if (field.reachable(coord) || field.next(coord) != coord) {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                if (!field.reachable(coord) || static_cast<size_t>(field.distance(coord)) != expected[i]) {
+                    return false;
+                }
+
+                // Follow the field to a goal:
+                auto curr = coord;
+                for (size_t step = 0U; step < expected[i]; ++step) {
+
+                    const auto next = field.next(curr);
+
+                    if (!reference::adjacent<Octile>(curr, next) || !_maze[next].is_active()) {
+                        return false;
+                    }
+
+                    curr = next;
+                }
+
+                if (field.distance(curr) != 0U || field.next(curr) != curr) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    public:
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using  index_t = typename params_t:: index_type;
+            using weight_t = typename params_t::weight_type;
+
+            constexpr size_t samples { 50U };
+
+            size_t  manhattan { 0U };
+            size_t     octile { 0U };
+
+            debug::log("(Flow Fields):");
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                const auto maze = reference::random_grid<weight_t>(_params.size, 0.3, seed);
+
+                generator::utils::lcg<size_t> rng(seed);
+
+                // Between one and three active goals:
+                std::vector<coord_t> goals;
+                for (size_t i = 0U; i < maze.count() && goals.size() < 1U + (seed % 3U); ++i) {
+                    if (const auto id = static_cast<index_t>(rng() % maze.count()); maze[id].is_active()) {
+                        goals.emplace_back(chdr::utils::to_nd(id, maze.size()));
+                    }
+                }
+
+                manhattan += matches<false>(maze, goals) ? 1U : 0U;
+                   octile += matches<true >(maze, goals) ? 1U : 0U;
+            }
+
+            bool result = reference::report("Orthogonal fields match the reference", manhattan == samples, std::to_string(manhattan) + "/" + std::to_string(samples));
+            result &= reference::report("Diagonal fields match the reference", octile == samples, std::to_string(octile) + "/" + std::to_string(samples));
+
+            return result;
+        }
+    };
+
+} //test::flow_fields
+
+#endif //TEST_FLOW_FIELDS_HPP
@@ -0,0 +1,148 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_HIERARCHY_HPP
+#define TEST_HIERARCHY_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks the paths of `chdr::mazes::hierarchy` against a reference breadth-first search.
+     *
+     * @details On random grids, a route must be found between two cells exactly when the reference can reach one
+     *          from the other. Refined paths must run from the start to the end through adjacent, traversable cells,
+     *          and cannot be shorter than the reference distance. After a cell of a path is blocked and the hierarchy
+     *          updated, the same must hold for the edited grid, and the path must be as long as that of a hierarchy
+     *          rebuilt from scratch.
+     */
+    struct hierarchy final {
+
+    private:
+
+        /**
+         * @brief Checks a path ordered from `_start` to `_end` (inclusive) against the reference distances from `_start`.
+         */
+        template <typename maze_t, typename coord_t>
+        [[nodiscard]] static bool valid(const maze_t& _maze, const std::vector<coord_t>& _path, const coord_t& _start, const coord_t& _end, const std::vector<size_t>& _distances) {
+
+            const auto target = _distances[static_cast<size_t>(chdr::utils::to_1d(_end, _maze.size()))];
+
+            if (target == reference::unreachable_v) {
+                return _path.empty();
+            }
+
+            if (_path.empty() || _path.front() != _start || _path.size() < target + 1U) {
+                return false;
+            }
+
+            // Reversed into the layout expected by the reference, which excludes the start:
+            const std::vector<coord_t> reversed(_path.rbegin(), _path.rend() - 1);
+
+            return _start == _end ? _path.size() == 1U : reference::walkable<false>(_maze, reversed, _start, _end);
+        }
+
+    public:
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using weight_t = typename params_t::weight_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            using hierarchy_t = chdr::mazes::hierarchy<coord_t, weight_t, size_t, scalar_t>;
+
+            constexpr size_t samples { 50U };
+            constexpr size_t queries { 20U };
+
+            size_t  total { 0U };
+            size_t  found { 0U };
+            size_t edited { 0U };
+            size_t  paths { 0U };
+
+            coord_t cluster_size {};
+            cluster_size.fill(static_cast<typename coord_t::value_type>(8U));
+
+            debug::log("(Hierarchy):");
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                auto maze = reference::random_grid<weight_t>(_params.size, 0.3, seed);
+
+                const hierarchy_t hpa(maze, cluster_size);
+
+                generator::utils::lcg<size_t> rng(seed);
+
+                for (size_t i = 0U; i < queries; ++i) {
+
+                    const auto start = chdr::utils::to_nd(static_cast<typename coord_t::value_type>(rng() % maze.count()), maze.size());
+                    const auto   end = chdr::utils::to_nd(static_cast<typename coord_t::value_type>(rng() % maze.count()), maze.size());
+
+                    if (!maze[start].is_active() || !maze[end].is_active()) {
+                        continue;
+                    }
+
+                    ++total;
+
+                    const auto distances = reference::distances<false>(maze, start);
+                    const auto path      = hpa.solve(start, end);
+
+                    found += valid(maze, path, start, end, distances) ? 1U : 0U;
+
+                    // Block a cell in the middle of the path, and check the updated hierarchy:
+                    if (path.size() > 2U) {
+
+                        ++paths;
+
+                        const auto blocked = path[path.size() / 2U];
+
+                        auto nodes = maze.nodes();
+                        nodes[static_cast<size_t>(chdr::utils::to_1d(blocked, maze.size()))] = std::numeric_limits<weight_t>::max();
+
+                        // One hierarchy is built from the edited grid, and another built from the original and then updated.
+                        // The order of their abstract edges may differ, so only the lengths of their paths are compared:
+                        const chdr::mazes::grid<coord_t, weight_t> copy(maze.size(), nodes);
+                        const hierarchy_t rebuilt(copy, cluster_size);
+
+                        hierarchy_t incremental(maze, cluster_size);
+                        maze.nodes(nodes);
+                        incremental.update(blocked);
+
+                        const auto rerouted = incremental.solve(start, end);
+
+                        if (valid(maze, rerouted, start, end, reference::distances<false>(maze, start)) && rerouted.size() == rebuilt.solve(start, end).size()) {
+                            ++edited;
+                        }
+
+                        // Restore the cell for the remaining queries:
+                        nodes[static_cast<size_t>(chdr::utils::to_1d(blocked, maze.size()))] = std::numeric_limits<weight_t>::lowest();
+                        maze.nodes(nodes);
+                    }
+                }
+            }
+
+            bool result = reference::report("Refined paths match the reference", total > 0U && found == total, std::to_string(found) + "/" + std::to_string(total));
+            result &= reference::report("Updated hierarchies match the edited grid", paths > 0U && edited == paths, std::to_string(edited) + "/" + std::to_string(paths));
+
+            return result;
+        }
+    };
+
+} //test::hierarchy
+
+#endif //TEST_HIERARCHY_HPP
@@ -0,0 +1,242 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_POOLS_HPP
+#define TEST_POOLS_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace test {
+
+    /**
+     * @brief Compares configurations of the memory pools.
+     *
+     * @details Several solvers are timed solving the same query with different pools, alongside the combined
+     *          footprint of the pools after the search:
+     *          - The default, tree-based free list of `heterogeneous_pool` against its size-class free lists. A
+     *            synthetic benchmark which replaces a steady backlog of live allocations of mixed sizes isolates the
+     *            cost of the free lists.
+     *          - Pools backed by the heap against pools backed by transparent huge pages, which is most relevant to
+     *            large (e.g. 3D) searches.
+     *          - A monotonic pool which releases its blocks on reset against one which retains its peak, as in a
+     *            stream of repeated solves.
+     */
+    struct pools final {
+
+    private:
+
+        using class_pool = chdr::heterogeneous_pool<4096U, std::numeric_limits<size_t>::max(), 65536U, true, true>;
+
+        using huge_monotonic     = chdr::monotonic_pool    <4096U, std::numeric_limits<size_t>::max(), 65536U,              chdr::huge_page_backing>;
+        using huge_heterogeneous = chdr::heterogeneous_pool<4096U, std::numeric_limits<size_t>::max(), 65536U, true, false, chdr::huge_page_backing>;
+        using huge_homogeneous   = chdr::homogeneous_pool  <4096U, std::numeric_limits<size_t>::max(), 65536U,              chdr::huge_page_backing>;
+
+        using peak_monotonic      = chdr::monotonic_pool<4096U, std::numeric_limits<size_t>::max(), 65536U, chdr::heap_backing,      chdr::retain_peak<>>;
+        using peak_huge_monotonic = chdr::monotonic_pool<4096U, std::numeric_limits<size_t>::max(), 65536U, chdr::huge_page_backing, chdr::retain_peak<>>;
+
+        /** @brief Parameters identical to `params_t`, other than the types of the memory pools. */
+        template <typename params_t, typename monotonic_t, typename heterogeneous_t, typename homogeneous_t>
+        struct pool_params final {
+
+            using  weight_type [[maybe_unused]] = typename params_t:: weight_type;
+            using  scalar_type [[maybe_unused]] = typename params_t:: scalar_type;
+            using   index_type [[maybe_unused]] = typename params_t::  index_type;
+            using   coord_type [[maybe_unused]] = typename params_t::  coord_type;
+
+            using        lazy_sorting [[maybe_unused]] = typename params_t::       lazy_sorting;
+            using          no_cleanup [[maybe_unused]] = typename params_t::         no_cleanup;
+            using reverse_equivalence [[maybe_unused]] = typename params_t::reverse_equivalence;
+            using   octile_neighbours [[maybe_unused]] = typename params_t::  octile_neighbours;
+
+            decltype(std::declval<params_t>().maze) maze;
+            const coord_type start;
+            const coord_type end;
+            const coord_type size;
+            scalar_type (*h)(const coord_type&, const coord_type&) noexcept;
+
+                monotonic_t*     monotonic_pmr;
+            heterogeneous_t* heterogeneous_pmr;
+              homogeneous_t*   homogeneous_pmr;
+
+            const scalar_type weight;
+            const      size_t capacity;
+            const      size_t memory_limit;
+        };
+
+        template <template <typename> typename solver_t, typename monotonic_t, typename heterogeneous_t, typename homogeneous_t, typename params_t>
+        [[nodiscard]] static std::pair<long double, size_t> time(const params_t& _params, size_t _samples) {
+
+            using args_t = pool_params<params_t, monotonic_t, heterogeneous_t, homogeneous_t>;
+
+            monotonic_t         monotonic;
+            heterogeneous_t heterogeneous;
+            homogeneous_t     homogeneous;
+
+            const args_t args { _params.maze, _params.start, _params.end, _params.size, _params.h, &monotonic, &heterogeneous, &homogeneous, _params.weight, _params.capacity, _params.memory_limit };
+
+            auto result = std::numeric_limits<long double>::max();
+            size_t footprint = 0U;
+
+            for (size_t i = 0U; i < _samples; ++i) {
+
+                chdr::malloc_consolidate();
+
+                const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                const auto path = chdr::solvers::solver<solver_t, args_t>::solve(args);
+
+                result = chdr::utils::min(result, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+
+                footprint = monotonic.footprint() + heterogeneous.footprint() + homogeneous.footprint();
+
+                monotonic    .reset();
+                heterogeneous.reset();
+                homogeneous  .reset();
+            }
+
+            return { result, footprint };
+        }
+
+        template <typename heterogeneous_t>
+        [[nodiscard]] static std::pair<long double, size_t> churn(size_t _count, size_t _samples) {
+
+            heterogeneous_t heterogeneous;
+
+            auto result = std::numeric_limits<long double>::max();
+            size_t footprint = 0U;
+
+            for (size_t i = 0U; i < _samples; ++i) {
+
+                // Keep a steady backlog of live allocations of mixed sizes, which are replaced in FIFO order:
+                std::array<std::pair<void*, size_t>, 1024U> live {};
+
+                uint32_t state = 0x9E3779B9U;
+
+                const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                for (size_t j = 0U; j < _count; ++j) {
+
+                    state ^= state << 13U;
+                    state ^= state >> 17U;
+                    state ^= state <<  5U;
+
+                    auto& [ptr, bytes] = live[j % live.size()];
+
+                    if (ptr != nullptr) {
+                        heterogeneous.deallocate(ptr, bytes, alignof(std::max_align_t));
+                    }
+
+                    bytes = 8U * ((state % 128U) + 1U);
+                    ptr   = heterogeneous.allocate(bytes, alignof(std::max_align_t));
+                }
+
+                result = chdr::utils::min(result, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+
+                footprint = heterogeneous.footprint();
+
+                heterogeneous.reset();
+            }
+
+            return { result, footprint };
+        }
+
+        static void report(const std::string& _name, const std::string& _before, const std::string& _after, const std::pair<long double, size_t>& _lhs, const std::pair<long double, size_t>& _rhs) {
+
+            const auto& [lhs_time, lhs_footprint] = _lhs;
+            const auto& [rhs_time, rhs_footprint] = _rhs;
+
+            debug::log("(" + _name + "):");
+            debug::log("\t" + _before + "\t(<= ~" + chdr::utils::to_string(lhs_time) + ")\t" + std::to_string(lhs_footprint) + " bytes");
+            debug::log("\t" + _after  + "\t(<= ~" + chdr::utils::to_string(rhs_time) + ")\t" + std::to_string(rhs_footprint) + " bytes\tx" +
+                std::to_string(static_cast<double>(lhs_time / rhs_time)));
+        }
+
+        /** @brief Compares the tree-based free list of `heterogeneous_pool` against its size-class free lists. */
+        template <template <typename> typename solver_t, typename params_t>
+        static void compare_classes(const std::string& _name, const params_t& _params, size_t _samples) {
+
+            const auto tree = time<solver_t, chdr::monotonic_pool<>, chdr::heterogeneous_pool<>, chdr::homogeneous_pool<>>(_params, _samples);
+            const auto size = time<solver_t, chdr::monotonic_pool<>, class_pool,                 chdr::homogeneous_pool<>>(_params, _samples);
+
+            report(_name, "Tree\t", "Size Classes", tree, size);
+        }
+
+        /** @brief Compares pools backed by the heap against pools backed by transparent huge pages. */
+        template <template <typename> typename solver_t, typename params_t>
+        static void compare_backing(const std::string& _name, const params_t& _params, size_t _samples) {
+
+            const auto heap = time<solver_t, chdr::monotonic_pool<>, chdr::heterogeneous_pool<>, chdr::homogeneous_pool<>>(_params, _samples);
+            const auto huge = time<solver_t, huge_monotonic,         huge_heterogeneous,          huge_homogeneous        >(_params, _samples);
+
+            report(_name, "Heap\t", "Huge Pages", heap, huge);
+        }
+
+        /** @brief Compares a monotonic pool which releases its blocks on reset against one which retains its peak. */
+        template <template <typename> typename solver_t, typename params_t>
+        static void compare_reset(const std::string& _name, const params_t& _params, size_t _samples) {
+
+            const auto release = time<solver_t, chdr::monotonic_pool<>, chdr::heterogeneous_pool<>, chdr::homogeneous_pool<>>(_params, _samples);
+            const auto retain  = time<solver_t, peak_monotonic,         chdr::heterogeneous_pool<>, chdr::homogeneous_pool<>>(_params, _samples);
+            const auto huge    = time<solver_t, peak_huge_monotonic,    huge_heterogeneous,          huge_homogeneous        >(_params, _samples);
+
+            report(_name, "Release\t", "Retain Peak", release, retain);
+            report(_name, "Release\t", "Retain Peak (Huge Pages)", release, huge);
+        }
+
+    public:
+
+        template <typename params_t>
+        static void run(const params_t& _params) {
+
+            /* TEST SAMPLES */
+#ifndef NDEBUG
+            constexpr size_t base_samples = 1UL;
+#else //!NDEBUG
+            constexpr size_t base_samples = 100000000UL;
+#endif //!NDEBUG
+
+            const size_t test_samples = chdr::utils::max(chdr::utils::sqrt(base_samples / _params.maze.count()), static_cast<size_t>(1U));
+
+            /* SIZE CLASSES */
+            compare_classes<chdr::solvers::astar   >("A*",       _params, test_samples);
+            compare_classes<chdr::solvers::bfs     >("BFS",      _params, test_samples);
+            compare_classes<chdr::solvers::dijkstra>("Dijkstra", _params, test_samples);
+            compare_classes<chdr::solvers::gstar   >("G*",       _params, test_samples);
+            compare_classes<chdr::solvers::smastar >("SMA*",     _params, test_samples);
+
+            const size_t count = chdr::utils::max(_params.maze.count(), static_cast<size_t>(1000000U));
+
+            report("Allocate/Deallocate", "Tree\t", "Size Classes", churn<chdr::heterogeneous_pool<>>(count, test_samples), churn<class_pool>(count, test_samples));
+
+            /* BACKING */
+            compare_backing<chdr::solvers::astar   >("A*",       _params, test_samples);
+            compare_backing<chdr::solvers::bfs     >("BFS",      _params, test_samples);
+            compare_backing<chdr::solvers::dijkstra>("Dijkstra", _params, test_samples);
+            compare_backing<chdr::solvers::gstar   >("G*",       _params, test_samples);
+
+            /* RESET POLICY */
+            compare_reset<chdr::solvers::astar   >("A*",       _params, test_samples);
+            compare_reset<chdr::solvers::bfs     >("BFS",      _params, test_samples);
+            compare_reset<chdr::solvers::dijkstra>("Dijkstra", _params, test_samples);
+            compare_reset<chdr::solvers::gstar   >("G*",       _params, test_samples);
+        }
+    };
+
+} //test::pools
+
+#endif //TEST_POOLS_HPP
@@ -0,0 +1,231 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_REGISTRY_HPP
+#define TEST_REGISTRY_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks the solver front door, `chdr::solve()`, and the `registry` behind it.
+     *
+     * @details Every registered name must be found, and unknown names (or solvers which do not support the dimensions
+     *          of the grid or the requested neighbourhood) must throw. On a small open grid, every solver must return its path in the normalised
+     *          order, from the end to the step after the start. On random grids, paths must be walkable and, for
+     *          the optimal solvers, as short as the reference. "auto" must behave exactly as the solver it selects.
+     */
+    struct registry final {
+
+    private:
+
+        template <typename function_t>
+        [[nodiscard]] static bool throws(const function_t& _function) {
+
+            try {
+                static_cast<void>(_function());
+            }
+            catch (const std::invalid_argument&) {
+                return true;
+            }
+
+            return false;
+        }
+
+        /** @brief Solvers which return only some of the coordinates along their path. */
+        [[nodiscard]] static bool partial(std::string_view _name) noexcept {
+            return _name == "flood" || _name == "gjps" || _name == "jps" || _name == "lazy_thetastar";
+        }
+
+        /** @brief Checks the names of a registry, and that each of them can be found. */
+        template <typename params_t>
+        [[nodiscard]] static bool complete(bool _supported) {
+
+            using registry_t = chdr::solvers::registry<params_t>;
+
+            const auto names = registry_t::names();
+
+            bool result = std::is_sorted(names.begin(), names.end()) && std::adjacent_find(names.begin(), names.end()) == names.end();
+
+            for (const auto& name : names) {
+                result &= registry_t::find(name) != nullptr;
+            }
+
+            for (const auto& name : { std::string_view("gjps"), std::string_view("jps") }) {
+                result &= (registry_t::find(name) != nullptr) == _supported;
+            }
+
+            return result && registry_t::find("unknown") == nullptr;
+        }
+
+        /** @brief Runs every solver on a small open grid, and checks the order of the paths they return. */
+        template <bool Octile, typename scalar_t, typename coord_t, typename weight_t>
+        [[nodiscard]] static size_t normalised(size_t& _total) {
+
+            using params_t = chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t, Octile>;
+
+            coord_t size {};
+            size.fill(static_cast<typename coord_t::value_type>(8U));
+
+            const auto maze = reference::random_grid<weight_t>(size, 0.0, 0U);
+
+            coord_t start {};
+            start.fill(static_cast<typename coord_t::value_type>(1U));
+
+            auto end = start;
+            end[0U] = static_cast<typename coord_t::value_type>(4U);
+            end[size.size() - 1U] = static_cast<typename coord_t::value_type>(3U);
+
+            chdr::solvers::options<scalar_t, coord_t> options;
+            options.octile = Octile;
+
+            size_t result { 0U };
+
+            for (const auto& name : chdr::solvers::registry<params_t>::names()) {
+
+                ++_total;
+
+                const auto path = chdr::solve<scalar_t>(name, maze, start, end, options).path;
+
+                const bool valid = partial(name) ?
+                    !path.empty() && path.front() == end && std::find(path.begin(), path.end(), start) == path.end() :
+                    reference::walkable<Octile>(maze, path, start, end);
+
+                if (valid) {
+                    ++result;
+                }
+                else {
+                    debug::log("\t\"" + std::string(name) + "\" returned a path in the wrong order", error);
+                }
+            }
+
+            return result;
+        }
+
+    public:
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using  index_t = typename params_t:: index_type;
+            using weight_t = typename params_t::weight_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            constexpr size_t samples { 50U };
+            constexpr size_t queries { 10U };
+
+            debug::log("(Registry):");
+
+            // Jump-point search only supports octile neighbours in two dimensions:
+            constexpr bool planar = std::tuple_size_v<coord_t> == 2U;
+
+            const bool found = complete<chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t, false>>(false) &&
+                               complete<chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t,  true>>(planar);
+
+            // Unknown names, and solvers which do not support the grid, must be rejected:
+            const auto maze = reference::random_grid<weight_t>(_params.size, 0.3, 0U);
+
+            chdr::solvers::options<scalar_t, coord_t> cardinal;
+            chdr::solvers::options<scalar_t, coord_t> octile;
+            octile.octile = true;
+
+            const auto solve = [&](std::string_view _name, const chdr::solvers::options<scalar_t, coord_t>& _options) {
+                return chdr::solve<scalar_t>(_name, maze, _params.start, _params.end, _options);
+            };
+
+            const bool rejected = throws([&]() { return solve("unknown", cardinal); }) &&
+                                  throws([&]() { return solve("unknown", octile  ); }) &&
+                                  throws([&]() { return solve("jps",     cardinal); }) &&
+                                  throws([&]() { return solve("gjps",    cardinal); }) &&
+                                  throws([&]() { return solve("jps",     octile  ); }) != planar &&
+                                  throws([&]() { return solve("gjps",    octile  ); }) != planar;
+
+            // Path order:
+            size_t total { 0U };
+            const auto ordered = normalised<false, scalar_t, coord_t, weight_t>(total) +
+                                 normalised<true,  scalar_t, coord_t, weight_t>(total);
+
+            // Paths between random cells, and "auto":
+            size_t  queried { 0U };
+            size_t  optimal { 0U };
+            size_t selected { 0U };
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                const auto grid = reference::random_grid<weight_t>(_params.size, 0.3, seed);
+                const chdr::mazes::statistics statistics(grid);
+
+                chdr::solvers::options<scalar_t, coord_t> options;
+                options.statistics = &statistics;
+
+                generator::utils::lcg<size_t> rng(seed);
+
+                for (size_t i = 0U; i < queries; ++i) {
+
+                    const auto start = chdr::utils::to_nd(static_cast<index_t>(rng() % grid.count()), grid.size());
+                    const auto   end = chdr::utils::to_nd(static_cast<index_t>(rng() % grid.count()), grid.size());
+
+                    if (start == end || !grid[start].is_active() || !grid[end].is_active()) {
+                        continue;
+                    }
+
+                    ++queried;
+
+                    const auto target = reference::distances<false>(grid, start)[static_cast<size_t>(chdr::utils::to_1d(end, grid.size()))];
+
+                    bool valid { true };
+
+                    for (const auto& name : { "astar", "best_first", "dijkstra", "smastar" }) {
+
+                        const auto path = chdr::solve<scalar_t>(name, grid, start, end, options).path;
+
+                        if (target == reference::unreachable_v) {
+                            valid &= path.empty();
+                        }
+                        else {
+                            valid &= reference::walkable<false>(grid, path, start, end) && (std::string_view(name) == "best_first" || path.size() == target);
+                        }
+                    }
+
+                    optimal += valid ? 1U : 0U;
+
+                    const auto automatic = chdr::solve<scalar_t>("auto", grid, start, end, options);
+                    const auto   expected = chdr::solve<scalar_t>(chdr::solvers::selector::select(statistics, false), grid, start, end, options);
+
+                    if (automatic.status == expected.status && automatic.path == expected.path) {
+                        ++selected;
+                    }
+                }
+            }
+
+            bool result = reference::report("Every registered solver is found", found);
+            result &= reference::report("Unknown and unsupported solvers are rejected", rejected);
+            result &= reference::report("Paths are returned from the end to the step after the start", ordered == total, std::to_string(ordered) + "/" + std::to_string(total));
+            result &= reference::report("Paths are walkable and optimal solvers match the reference", queried > 0U && optimal == queried, std::to_string(optimal) + "/" + std::to_string(queried));
+            result &= reference::report("\"auto\" matches the solver it selects", queried > 0U && selected == queried, std::to_string(selected) + "/" + std::to_string(queried));
+
+            return result;
+        }
+    };
+
+} //test::registry
+
+#endif //TEST_REGISTRY_HPP
@@ -0,0 +1,146 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_SCALING_HPP
+#define TEST_SCALING_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace test {
+
+    /**
+     * @brief Measures the scalability of the parallel `hdastar` solver against the sequential `astar` solver.
+     *
+     * @details The same query is solved by A*, and then by HDA* using 1, 2, 4, 8, 16 and 32 threads. The fastest of
+     *          several samples is reported for each, alongside its speed-up relative to A* and relative to HDA* on a
+     *          single thread. The cost of every path is checked against that of A*.
+     *
+     * @note Thread counts beyond the number of hardware threads oversubscribe the cores, and are expected to be slower.
+     */
+    struct scaling final {
+
+        template <typename params_t>
+        static void run(const params_t& _params) {
+
+            using scalar_t = typename params_t::scalar_type;
+
+            /* TEST SAMPLES */
+#ifndef NDEBUG
+            constexpr size_t base_samples = 1UL;
+#else //!NDEBUG
+            constexpr size_t base_samples = 100000000UL;
+#endif //!NDEBUG
+
+            const size_t test_samples = chdr::utils::max(chdr::utils::sqrt(base_samples / _params.maze.count()), static_cast<size_t>(1U));
+
+            struct threaded_params final {
+
+                using  weight_type [[maybe_unused]] = typename params_t:: weight_type;
+                using  scalar_type [[maybe_unused]] = typename params_t:: scalar_type;
+                using   index_type [[maybe_unused]] = typename params_t::  index_type;
+                using   coord_type [[maybe_unused]] = typename params_t::  coord_type;
+
+                using        lazy_sorting [[maybe_unused]] = typename params_t::       lazy_sorting;
+                using          no_cleanup [[maybe_unused]] = typename params_t::         no_cleanup;
+                using reverse_equivalence [[maybe_unused]] = typename params_t::reverse_equivalence;
+                using   octile_neighbours [[maybe_unused]] = typename params_t::  octile_neighbours;
+
+                decltype(std::declval<params_t>().maze) maze;
+                const coord_type start;
+                const coord_type end;
+                const coord_type size;
+                scalar_type (*h)(const coord_type&, const coord_type&) noexcept;
+
+                decltype(std::declval<params_t>().    monotonic_pmr)     monotonic_pmr;
+                decltype(std::declval<params_t>().heterogeneous_pmr) heterogeneous_pmr;
+                decltype(std::declval<params_t>().  homogeneous_pmr)   homogeneous_pmr;
+
+                const scalar_type weight;
+                const      size_t capacity;
+                const      size_t memory_limit;
+                const      size_t threads;
+            };
+
+            const auto reset = [&_params]() {
+                _params.    monotonic_pmr->reset();
+                _params.heterogeneous_pmr->reset();
+                _params.  homogeneous_pmr->reset();
+            };
+
+            /* A* */
+            debug::log("(A*):");
+            chdr::malloc_consolidate();
+
+            decltype(chdr::solvers::solver<chdr::solvers::astar, params_t>::search(_params)) baseline;
+
+            auto astar_time = std::numeric_limits<long double>::max();
+            for (size_t i = 0U; i < test_samples; ++i) {
+
+                const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                baseline = chdr::solvers::solver<chdr::solvers::astar, params_t>::search(_params);
+
+                reset();
+
+                astar_time = chdr::utils::min(astar_time, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+            }
+
+            debug::log("\t" + std::string(!baseline.path.empty() ? "[SOLVED]" : "[IMPOSSIBLE]") + "\t(<= ~" + chdr::utils::to_string(astar_time) + ")\tCost " + std::to_string(baseline.cost.value_or(0)));
+
+            /* HDA* */
+            debug::log("(HDA*, " + std::to_string(std::thread::hardware_concurrency()) + " hardware threads):");
+
+            auto single_time = std::numeric_limits<long double>::max();
+
+            for (const size_t threads : std::array<size_t, 6U> { 1U, 2U, 4U, 8U, 16U, 32U }) {
+
+                chdr::malloc_consolidate();
+
+                const threaded_params args { _params.maze, _params.start, _params.end, _params.size, _params.h, _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr, _params.weight, _params.capacity, _params.memory_limit, threads };
+
+                decltype(chdr::solvers::solver<chdr::solvers::hdastar, threaded_params>::search(args)) result;
+
+                auto hdastar_time = std::numeric_limits<long double>::max();
+                for (size_t i = 0U; i < test_samples; ++i) {
+
+                    const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                    result = chdr::solvers::solver<chdr::solvers::hdastar, threaded_params>::search(args);
+
+                    reset();
+
+                    hdastar_time = chdr::utils::min(hdastar_time, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+                }
+
+                if (threads == 1U) {
+                    single_time = hdastar_time;
+                }
+
+                const bool match = result.cost == baseline.cost && result.path.empty() == baseline.path.empty();
+
+                debug::log("\t" + std::to_string(threads) + " threads\t(<= ~" + chdr::utils::to_string(hdastar_time) + ")" +
+                    "\tx" + std::to_string(static_cast<double>(astar_time  / hdastar_time)) + " vs A*" +
+                    "\tx" + std::to_string(static_cast<double>(single_time / hdastar_time)) + " vs 1 thread" +
+                    (match ? "\t[MATCH]" : "\t[MISMATCH] Cost " + std::to_string(static_cast<scalar_t>(result.cost.value_or(0)))), match ? info : error);
+            }
+        }
+    };
+
+} //test::scaling
+
+#endif //TEST_SCALING_HPP
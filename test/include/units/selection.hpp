@@ -0,0 +1,204 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_SELECTION_HPP
+#define TEST_SELECTION_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../generator/grid.hpp"
+#include "../generator/obstacles.hpp"
+
+namespace test {
+
+    /**
+     * @brief Calibrates the thresholds of `chdr::solvers::selector`, which backs the "auto" solver.
+     *
+     * @details Generates open, cluttered and maze-like grids of the requested size, and times each of the candidate
+     *          solvers of the selector on every one, alongside the statistics of the grid. The solver chosen by the
+     *          selector is reported with its slowdown relative to the fastest candidate, which is `x1` when the
+     *          thresholds are well calibrated for the grid.
+     */
+    struct selection final {
+
+    private:
+
+        static constexpr size_t s_candidates = 5U;
+
+        template <typename params_t, typename function_t>
+        [[nodiscard]] static long double time(const params_t& _params, size_t _samples, function_t&& _function) {
+
+            auto result = std::numeric_limits<long double>::max();
+
+            for (size_t i = 0U; i < _samples; ++i) {
+
+                chdr::malloc_consolidate();
+
+                const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                _function();
+
+                result = chdr::utils::min(result, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+
+                _params.    monotonic_pmr->reset();
+                _params.heterogeneous_pmr->reset();
+                _params.  homogeneous_pmr->reset();
+            }
+
+            return result;
+        }
+
+        template <template <typename> typename solver_t, typename params_t>
+        [[nodiscard]] static std::pair<long double, typename params_t::scalar_type> measure(const params_t& _params, size_t _samples) {
+
+            typename params_t::scalar_type cost {};
+
+            const auto duration = time(_params, _samples, [&]() {
+
+                const auto result = chdr::solvers::solver<solver_t, params_t>::search(_params);
+
+                // Solvers which do not track costs (such as BFS) only run on unit-weight grids, where a step costs one:
+                cost = result.cost.value_or(static_cast<typename params_t::scalar_type>(result.path.size()));
+            });
+
+            return { duration, cost };
+        }
+
+        template <bool Octile, typename params_t, typename maze_t>
+        static void evaluate(const chdr::mazes::statistics& _stats, const params_t& _params, const maze_t& _maze, const typename params_t::coord_type& _end, size_t _samples) {
+
+            using  coord_t = typename params_t::coord_type;
+            using weight_t = typename params_t::weight_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            using candidate_params_t = chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t, Octile>;
+
+            debug::log(Octile ? "\t[Octile]" : "\t[Manhattan]");
+
+            const candidate_params_t args {
+                _maze, _params.start, _end, _params.size,
+                Octile ? chdr::heuristics::octile_distance<scalar_t, coord_t> : chdr::heuristics::manhattan_distance<scalar_t, coord_t>,
+                _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr,
+                static_cast<scalar_t>(1), 0U, std::numeric_limits<size_t>::max(), {}, 0U
+            };
+
+            const std::array<std::string_view, s_candidates> names { "jps", "astar", "bfs", "fringe", "gstar" };
+
+            const std::array<std::pair<long double, scalar_t>, s_candidates> results {
+                measure<chdr::solvers::   jps, candidate_params_t>(args, _samples),
+                measure<chdr::solvers:: astar, candidate_params_t>(args, _samples),
+                measure<chdr::solvers::   bfs, candidate_params_t>(args, _samples),
+                measure<chdr::solvers::fringe, candidate_params_t>(args, _samples),
+                measure<chdr::solvers:: gstar, candidate_params_t>(args, _samples)
+            };
+
+            // Candidates returning a costlier path than the others are not eligible to be the fastest:
+            auto optimal = std::numeric_limits<scalar_t>::max();
+
+            for (const auto& [duration, cost] : results) {
+                optimal = chdr::utils::min(optimal, cost);
+            }
+
+            size_t fastest  = 1U;
+            size_t selected = 0U;
+
+            for (size_t i = 0U; i < s_candidates; ++i) {
+
+                if (results[i].second == optimal && results[i].first < results[fastest].first) {
+                    fastest = i;
+                }
+
+                if (names[i] == chdr::solvers::selector::select(_stats, Octile)) {
+                    selected = i;
+                }
+
+                debug::log("\t\t" + std::string(names[i]) + "\t(<= ~" + chdr::utils::to_string(results[i].first) + ")\tCost " + std::to_string(results[i].second) + (results[i].second == optimal ? "" : " (inexact)"));
+            }
+
+            debug::log("\t\tFastest: " + std::string(names[fastest]) + "\tSelected: " + std::string(names[selected]) + "\tx" +
+                std::to_string(static_cast<double>(results[selected].first / results[fastest].first)), selected == fastest ? info : warning);
+        }
+
+        template <typename params_t, typename maze_t>
+        static void evaluate(const std::string& _name, const params_t& _params, const maze_t& _maze, const typename params_t::coord_type& _end, size_t _samples) {
+
+            const chdr::mazes::statistics stats(_maze);
+
+            debug::log("(" + _name + "):");
+            debug::log("\tDensity " + std::to_string(stats.density()) + "\tCorridors " + std::to_string(stats.corridor_ratio()) + "\tMean Degree " + std::to_string(stats.mean_degree()));
+
+            evaluate<false>(stats, _params, _maze, _end, _samples);
+            evaluate< true>(stats, _params, _maze, _end, _samples);
+        }
+
+    public:
+
+        template <typename params_t>
+        static void run(const params_t& _params) {
+
+            using weight_t = typename params_t::weight_type;
+            using  index_t = typename params_t:: index_type;
+            using  coord_t = typename params_t:: coord_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            /* TEST SAMPLES */
+#ifndef NDEBUG
+            constexpr size_t base_samples = 1UL;
+#else //!NDEBUG
+            constexpr size_t base_samples = 10000000UL;
+#endif //!NDEBUG
+
+            const size_t test_samples = chdr::utils::max(chdr::utils::sqrt(base_samples / _params.maze.count()), static_cast<size_t>(1U));
+
+            constexpr size_t seed { 0U };
+
+            /* OPEN */
+            {
+                auto end = _params.end;
+
+                const std::vector<weight_t> nodes(chdr::utils::product<size_t>(_params.size), std::numeric_limits<weight_t>::lowest());
+                const chdr::mazes::grid<coord_t, weight_t> maze(_params.size, nodes);
+
+                evaluate("Open", _params, maze, end, test_samples);
+            }
+
+            /* CLUTTERED */
+            for (const auto density : { 0.05, 0.1, 0.15 }) {
+
+                auto end = _params.end;
+
+                const auto maze = generator::obstacles::generate<weight_t, index_t, coord_t, scalar_t>(_params.start, end, _params.size, density, 16U, seed);
+
+                evaluate("Cluttered " + std::to_string(static_cast<size_t>(density * 100.0)) + "%", _params, maze, end, test_samples);
+            }
+
+            /* MAZES */
+            for (const auto loops : { 0.0, 0.1, 0.5 }) {
+
+                auto end = _params.end;
+
+                const auto maze = generator::grid::generate<weight_t, coord_t, scalar_t>(_params.start, end, _params.size, loops, 0.0, seed);
+
+                evaluate("Maze " + std::to_string(static_cast<size_t>(loops * 100.0)) + "% loops", _params, maze, end, test_samples);
+            }
+        }
+    };
+
+} //test::selection
+
+#endif //TEST_SELECTION_HPP
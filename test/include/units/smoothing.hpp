@@ -0,0 +1,234 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_SMOOTHING_HPP
+#define TEST_SMOOTHING_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../core/reference.hpp"
+
+namespace test {
+
+    /**
+     * @brief Checks the paths produced by `chdr::smoothing` for line-of-sight validity.
+     *
+     * @details `line_of_sight()` is compared against a reference which samples points densely along the line, and
+     *          must never report a line as unobstructed if the reference finds an obstacle touching it. On random
+     *          grids, A* paths smoothed by `shortcut()` and `string_pull()` must then keep their endpoints, only keep
+     *          vertices of the original path, and have an unobstructed line between every pair of consecutive
+     *          vertices. The waypoints of `lazy_thetastar` are held to the same standard.
+     */
+    struct smoothing final {
+
+    private:
+
+        /**
+         * @brief Determines whether a line between the centres of two cells touches any inactive cell, by sampling.
+         *
+         * @details Cells span half a unit either side of their centre. Sampled points lying on the boundary between
+         *          cells (within a small tolerance) must have every cell they touch active.
+         */
+        template <typename maze_t, typename coord_t>
+        [[nodiscard]] static bool visible(const maze_t& _maze, const coord_t& _a, const coord_t& _b) {
+
+            constexpr auto   Kd = std::tuple_size_v<coord_t>;
+            constexpr double epsilon { 1e-9 };
+
+            size_t steps { 0U };
+            for (size_t i = 0U; i < Kd; ++i) {
+                steps += static_cast<size_t>(std::abs(static_cast<int64_t>(_b[i]) - static_cast<int64_t>(_a[i])));
+            }
+
+            const auto samples = 16U * (steps + 1U);
+
+            for (size_t k = 0U; k <= samples; ++k) {
+
+                const auto t = static_cast<double>(k) / static_cast<double>(samples);
+
+                coord_t lo {};
+                coord_t hi {};
+
+                for (size_t i = 0U; i < Kd; ++i) {
+                    const auto p = static_cast<double>(_a[i]) + (t * (static_cast<double>(_b[i]) - static_cast<double>(_a[i]))) + 0.5;
+                    lo[i] = static_cast<typename coord_t::value_type>(std::floor(p - epsilon));
+                    hi[i] = static_cast<typename coord_t::value_type>(std::floor(p + epsilon));
+                }
+
+                for (size_t mask = 0U; mask < (static_cast<size_t>(1U) << Kd); ++mask) {
+
+                    coord_t cell {};
+                    for (size_t i = 0U; i < Kd; ++i) {
+                        cell[i] = ((mask >> i) & 1U) != 0U ? hi[i] : lo[i];
+                    }
+
+                    bool contained { true };
+                    for (size_t i = 0U; i < Kd; ++i) {
+                        contained &= cell[i] < _maze.size()[i];
+                    }
+
+                    if (!contained || !_maze[cell].is_active()) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Checks a smoothed path against the path it was smoothed from.
+         */
+        template <typename maze_t, typename coord_t>
+        [[nodiscard]] static bool valid(const maze_t& _maze, const std::vector<coord_t>& _smoothed, const std::vector<coord_t>& _original) {
+
+            if (_smoothed.empty() || _smoothed.size() > _original.size() || _smoothed.front() != _original.front() || _smoothed.back() != _original.back()) {
+                return false;
+            }
+
+            // Every vertex must appear in the original path, in the same order:
+            auto it = _original.begin();
+            for (const auto& vertex : _smoothed) {
+                it = std::find(it, _original.end(), vertex);
+                if (it == _original.end()) {
+                    return false;
+                }
+            }
+
+            for (size_t i = 0U; i + 1U < _smoothed.size(); ++i) {
+                if (!chdr::smoothing::line_of_sight(_maze, _smoothed[i], _smoothed[i + 1U]) || !visible(_maze, _smoothed[i], _smoothed[i + 1U])) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    public:
+
+        template <typename params_t>
+        [[nodiscard]] static bool run(const params_t& _params) {
+
+            using  coord_t = typename params_t:: coord_type;
+            using  index_t = typename params_t:: index_type;
+            using weight_t = typename params_t::weight_type;
+            using scalar_t = typename params_t::scalar_type;
+
+            using check_params_t = chdr::solvers::dispatch_params<coord_t, weight_t, scalar_t, false>;
+            using       search_t = chdr::solvers::solver<chdr::solvers::astar, check_params_t>;
+
+            constexpr size_t samples { 100U };
+            constexpr size_t   pairs { 200U };
+
+            size_t  solvable { 0U };
+            size_t  shortcut { 0U };
+            size_t    pulled { 0U };
+            size_t     solve { 0U };
+            size_t       any { 0U };
+            size_t  agreeing { 0U };
+            size_t      seen { 0U };
+            size_t   refuted { 0U };
+
+            debug::log("(Smoothing):");
+
+            for (size_t seed = 0U; seed < samples; ++seed) {
+
+                const auto maze = reference::random_grid<weight_t>(_params.size, 0.3, seed);
+
+                // Line of sight between random pairs of cells:
+                generator::utils::lcg<size_t> rng(seed);
+
+                for (size_t i = 0U; i < pairs; ++i) {
+
+                    const auto a = chdr::utils::to_nd(static_cast<index_t>(rng() % maze.count()), maze.size());
+                    const auto b = chdr::utils::to_nd(static_cast<index_t>(rng() % maze.count()), maze.size());
+
+                    const auto los = chdr::smoothing::line_of_sight(maze, a, b);
+
+                    if (los == chdr::smoothing::line_of_sight(maze, b, a)) {
+                        ++agreeing;
+                    }
+
+                    if (los) {
+                        ++seen;
+                        refuted += visible(maze, a, b) ? 0U : 1U;
+                    }
+                }
+
+                // Smoothed paths:
+                const check_params_t args {
+                    maze, _params.start, _params.end, _params.size, chdr::heuristics::manhattan_distance<scalar_t, coord_t>,
+                    _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr,
+                    static_cast<scalar_t>(1), 0U, std::numeric_limits<size_t>::max(), {}, 0U
+                };
+
+                auto original = search_t::solve(args);
+
+                if (original.empty()) {
+                    continue;
+                }
+
+                ++solvable;
+
+                original.emplace_back(_params.start);
+
+                auto greedy = original;
+                static_cast<void>(chdr::smoothing::shortcut(maze, greedy));
+                shortcut += valid(maze, greedy, original) ? 1U : 0U;
+
+                auto taut = original;
+                static_cast<void>(chdr::smoothing::string_pull(maze, taut));
+                pulled += valid(maze, taut, original) ? 1U : 0U;
+
+                original.pop_back();
+
+                // Any-angle paths only consist of waypoints, so can only be checked for line of sight:
+                if (auto waypoints = chdr::solvers::solver<chdr::solvers::lazy_thetastar, check_params_t>::solve(args); !waypoints.empty() && waypoints.front() == _params.end) {
+
+                    waypoints.emplace_back(_params.start);
+
+                    bool unobstructed { true };
+                    for (size_t i = 0U; i + 1U < waypoints.size(); ++i) {
+                        unobstructed &= chdr::smoothing::line_of_sight(maze, waypoints[i], waypoints[i + 1U]) && visible(maze, waypoints[i], waypoints[i + 1U]);
+                    }
+
+                    any += unobstructed ? 1U : 0U;
+                }
+
+                if (valid(maze, search_t::template solve_smoothed<false>(args), original) &&
+                    valid(maze, search_t::template solve_smoothed<true >(args), original)
+                ) {
+                    ++solve;
+                }
+            }
+
+            const auto fraction = [&](size_t _count) { return std::to_string(_count) + "/" + std::to_string(solvable); };
+
+            bool result = reference::report("Line of sight agrees with the sampled reference", seen > 0U && refuted == 0U, std::to_string(refuted) + " refuted of " + std::to_string(seen));
+            result &= reference::report("Line of sight is symmetric", agreeing == samples * pairs, std::to_string(agreeing) + "/" + std::to_string(samples * pairs));
+            result &= reference::report("Shortcut paths are unobstructed",       solvable > 0U && shortcut == solvable, fraction(shortcut));
+            result &= reference::report("String-pulled paths are unobstructed",  solvable > 0U &&   pulled == solvable, fraction(  pulled));
+            result &= reference::report("solve_smoothed() paths are unobstructed", solvable > 0U &&  solve == solvable, fraction(   solve));
+            result &= reference::report("Lazy Theta* paths are unobstructed",      solvable > 0U &&    any == solvable, fraction(     any));
+
+            return result;
+        }
+    };
+
+} //test::smoothing
+
+#endif //TEST_SMOOTHING_HPP
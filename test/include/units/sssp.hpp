@@ -0,0 +1,189 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_SSSP_HPP
+#define TEST_SSSP_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace test {
+
+    /**
+     * @brief Compares the parallel delta-stepping `shortest_path_tree` against the `dijkstra` solver.
+     *
+     * @details The grid is converted to a (pruned, weighted) graph first. Dijkstra's algorithm is timed routing from
+     *          the start to the end, and the shortest-path tree is timed generating the distances of every vertex from
+     *          the start. The cost of the path found by Dijkstra's algorithm is checked against the distance of the
+     *          end within the tree.
+     */
+    struct sssp final {
+
+        template <typename params_t>
+        static void run(const params_t& _params) {
+
+            using  index_t = typename params_t:: index_type;
+            using scalar_t = typename params_t::scalar_type;
+            using  coord_t = typename params_t:: coord_type;
+            using  graph_t = chdr::mazes::graph<index_t, scalar_t>;
+
+            /* TEST SAMPLES */
+#ifndef NDEBUG
+            constexpr size_t base_samples = 1UL;
+#else //!NDEBUG
+            constexpr size_t base_samples = 100000000UL;
+#endif //!NDEBUG
+
+            const size_t test_samples = chdr::utils::max(chdr::utils::sqrt(base_samples / _params.maze.count()), static_cast<size_t>(1U));
+
+            debug::log("(Graph):");
+
+            graph_t graph(_params.maze);
+
+            // Pruning may leave edges leading to vertices without entries of their own, which cannot be expanded:
+            {
+                std::vector<index_t> dangling;
+
+                for (const auto& [id, neighbours] : graph) {
+                    for (const auto& [n, w] : neighbours) {
+                        if (!graph.contains(n)) {
+                            dangling.emplace_back(n);
+                        }
+                    }
+                }
+
+                for (const auto& n : dangling) {
+                    graph.add(n);
+                }
+            }
+
+            debug::log("\t" + std::to_string(graph.count()) + " vertices");
+
+            struct graph_params final {
+
+                using  weight_type [[maybe_unused]] = typename params_t:: weight_type;
+                using  scalar_type [[maybe_unused]] = scalar_t;
+                using   index_type [[maybe_unused]] =  index_t;
+                using   coord_type [[maybe_unused]] =  coord_t;
+
+                using        lazy_sorting [[maybe_unused]] = typename params_t::       lazy_sorting;
+                using          no_cleanup [[maybe_unused]] = typename params_t::         no_cleanup;
+                using reverse_equivalence [[maybe_unused]] = typename params_t::reverse_equivalence;
+                using   octile_neighbours [[maybe_unused]] = typename params_t::  octile_neighbours;
+
+                const graph_t& maze;
+                const coord_type start;
+                const coord_type end;
+                const coord_type size;
+                scalar_type (*h)(const coord_type&, const coord_type&) noexcept;
+
+                decltype(std::declval<params_t>().    monotonic_pmr)     monotonic_pmr;
+                decltype(std::declval<params_t>().heterogeneous_pmr) heterogeneous_pmr;
+                decltype(std::declval<params_t>().  homogeneous_pmr)   homogeneous_pmr;
+
+                const scalar_type weight;
+                const      size_t capacity;
+                const      size_t memory_limit;
+            };
+
+            const graph_params args { graph, _params.start, _params.end, _params.size, _params.h, _params.monotonic_pmr, _params.heterogeneous_pmr, _params.homogeneous_pmr, _params.weight, _params.capacity, _params.memory_limit };
+
+            const auto s = static_cast<index_t>(chdr::utils::to_1d(_params.start, _params.size));
+            const auto e = static_cast<index_t>(chdr::utils::to_1d(_params.end,   _params.size));
+
+            /* DIJKSTRA */
+            debug::log("(Dijkstra):");
+            chdr::malloc_consolidate();
+
+            decltype(chdr::solvers::solver<chdr::solvers::dijkstra, graph_params>::solve(args)) path;
+
+            auto dijkstra_time = std::numeric_limits<long double>::max();
+            for (size_t i = 0U; i < test_samples; ++i) {
+
+                const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                path = chdr::solvers::solver<chdr::solvers::dijkstra, graph_params>::solve(args);
+
+                if (i != test_samples - 1U) {
+                    _params.    monotonic_pmr->reset();
+                    _params.heterogeneous_pmr->reset();
+                    _params.  homogeneous_pmr->reset();
+                }
+
+                dijkstra_time = chdr::utils::min(dijkstra_time, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+            }
+
+            debug::log("\t" + std::string(!path.empty() ? "[SOLVED]" : "[IMPOSSIBLE]") + "\t(<= ~" + chdr::utils::to_string(dijkstra_time) + ") (start to end)");
+
+            /* DELTA-STEPPING */
+            debug::log("(Delta-Stepping, " + std::to_string(std::thread::hardware_concurrency()) + " threads):");
+            chdr::malloc_consolidate();
+
+            auto sw_start = std::chrono::high_resolution_clock::now();
+
+            chdr::mazes::shortest_path_tree<index_t, scalar_t> tree(graph, s);
+
+            const auto build_time = std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count();
+
+            auto tree_time = std::numeric_limits<long double>::max();
+            for (size_t i = 0U; i < test_samples; ++i) {
+
+                sw_start = std::chrono::high_resolution_clock::now();
+
+                tree.generate({ s });
+
+                tree_time = chdr::utils::min(tree_time, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+            }
+
+            debug::log("\t" + std::string(tree.reachable(e) ? "[SOLVED]" : "[IMPOSSIBLE]") + "\t(<= ~" + chdr::utils::to_string(tree_time) + ") (start to every vertex, delta " + std::to_string(tree.delta()) + ")");
+            debug::log("\t\t\t(<= ~" + chdr::utils::to_string(build_time) + ") (including copy of graph)");
+
+            /* VERIFY */
+            if (!path.empty()) {
+
+                auto cost = static_cast<scalar_t>(0);
+                auto prev = s;
+
+                for (const auto& coord : path) {
+
+                    const auto curr = static_cast<index_t>(chdr::utils::to_1d(coord, _params.size));
+
+                    if (curr != prev) {
+
+                        auto best = std::numeric_limits<scalar_t>::max();
+
+                        for (const auto& [n, w] : graph.get_neighbours(prev)) {
+                            if (n == curr) {
+                                best = chdr::utils::min(best, w);
+                            }
+                        }
+
+                        cost += best;
+                    }
+
+                    prev = curr;
+                }
+
+                debug::log(cost == tree.distance(e) ? "\t[MATCH]\t\tCost " + std::to_string(cost) :
+                    "\t[MISMATCH]\tDijkstra " + std::to_string(cost) + ", delta-stepping " + std::to_string(tree.distance(e)), cost == tree.distance(e) ? info : error);
+            }
+        }
+    };
+
+} //test::sssp
+
+#endif //TEST_SSSP_HPP
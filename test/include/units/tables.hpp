@@ -0,0 +1,121 @@
+/*
+ * Computational Helper for Direction and Routing (CHDR)
+ * Copyright (c) 2024 by Nazar Elsayed & Louis Eriksson
+ *
+ * Licensed under CC BY-NC-ND 4.0
+ * https://creativecommons.org/licenses/by-nc-nd/4.0/
+ */
+
+#ifndef TEST_TABLES_HPP
+#define TEST_TABLES_HPP
+
+#include <chdr.hpp>
+#include <debug.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+
+namespace test {
+
+    /**
+     * @brief Compares the open-addressing `chdr::flat_map` against `std::pmr::unordered_map`.
+     *
+     * @details Both containers allocate from the heterogeneous pool of the parameters, and are timed performing the
+     *          access pattern of the node tables of `smastar` and `osmastar`: a bounded working set of keys, in which
+     *          every insertion is paired with a number of lookups, and with the erasure of the oldest key.
+     */
+    struct tables final {
+
+    private:
+
+        template <typename map_t>
+        [[nodiscard]] static size_t churn(std::pmr::memory_resource* _resource, size_t _count, size_t _bound) {
+
+            size_t result = 0U;
+
+            map_t map(_resource);
+
+            for (size_t i = 0U; i < _count; ++i) {
+
+                // Scatter the keys, as the indices of nodes on a search frontier are:
+                const auto key = (i * 0x9E3779B1U) % (_count * 4U);
+
+                map[key] = i;
+
+                for (size_t j = 0U; j < 4U; ++j) {
+
+                    if (const auto search = map.find((key + j) % (_count * 4U)); search != map.end()) {
+                        result += search->second;
+                    }
+                }
+
+                if (i >= _bound) {
+                    map.erase(((i - _bound) * 0x9E3779B1U) % (_count * 4U));
+                }
+            }
+
+            return result + map.size();
+        }
+
+        template <typename params_t, typename function_t>
+        [[nodiscard]] static long double time(const params_t& _params, size_t _samples, function_t&& _function) {
+
+            auto result = std::numeric_limits<long double>::max();
+
+            for (size_t i = 0U; i < _samples; ++i) {
+
+                chdr::malloc_consolidate();
+
+                const auto sw_start = std::chrono::high_resolution_clock::now();
+
+                _function();
+
+                result = chdr::utils::min(result, std::chrono::duration_cast<std::chrono::duration<long double>>(std::chrono::high_resolution_clock::now() - sw_start).count());
+
+                _params.    monotonic_pmr->reset();
+                _params.heterogeneous_pmr->reset();
+                _params.  homogeneous_pmr->reset();
+            }
+
+            return result;
+        }
+
+    public:
+
+        template <typename params_t>
+        static void run(const params_t& _params) {
+
+            /* TEST SAMPLES */
+#ifndef NDEBUG
+            constexpr size_t base_samples = 1UL;
+#else //!NDEBUG
+            constexpr size_t base_samples = 100000000UL;
+#endif //!NDEBUG
+
+            const size_t test_samples = chdr::utils::max(chdr::utils::sqrt(base_samples / _params.maze.count()), static_cast<size_t>(1U));
+
+            /* CHURN */
+            debug::log("(Insert/Find/Erase):");
+
+            const size_t count = chdr::utils::max(_params.maze.count(), static_cast<size_t>(1000000U));
+            const size_t bound = chdr::utils::max(count / 16U, static_cast<size_t>(1U));
+
+            size_t sum_flat = 0U;
+            size_t sum_node = 0U;
+
+            const auto flat_churn = time(_params, test_samples, [&]() { sum_flat = churn<chdr::flat_map<size_t, size_t>>(_params.heterogeneous_pmr, count, bound); });
+            const auto node_churn = time(_params, test_samples, [&]() { sum_node = churn<std::pmr::unordered_map<size_t, size_t>>(_params.heterogeneous_pmr, count, bound); });
+
+            debug::log("\tstd::pmr::unordered_map\t(<= ~" + chdr::utils::to_string(node_churn) + ")\t" + std::to_string(count) + " operations");
+            debug::log("\tchdr::flat_map\t\t(<= ~"        + chdr::utils::to_string(flat_churn) + ")\t" + std::to_string(count) + " operations\tx" +
+                std::to_string(static_cast<double>(node_churn / flat_churn)), sum_flat == sum_node ? info : error);
+        }
+    };
+
+} //test::tables
+
+#endif //TEST_TABLES_HPP
@@ -10,6 +10,22 @@
 #include <debug.hpp>
 
 #include "core/application.hpp"
+#include "units/anytime.hpp"
+#include "units/budgets.hpp"
+#include "units/breadth_first.hpp"
+#include "units/buffers.hpp"
+#include "units/components.hpp"
+#include "units/encodings.hpp"
+#include "units/fifo.hpp"
+#include "units/flow_fields.hpp"
+#include "units/hierarchy.hpp"
+#include "units/pools.hpp"
+#include "units/registry.hpp"
+#include "units/scaling.hpp"
+#include "units/selection.hpp"
+#include "units/smoothing.hpp"
+#include "units/sssp.hpp"
+#include "units/tables.hpp"
 
 namespace test {
 
@@ -32,9 +48,12 @@ namespace test {
                       << "  <solver> <maze_weight_type> <x> <y> <z>      Process with 3-dimensional coordinates.\n"
                       << "  <solver> <maze_weight_type> <x> <y> <z> <w>  Process with 4-dimensional coordinates.\n"
                       << "\nSolvers:\n"
+                      << "  arastar        Anytime Repairing A*\n"
                       << "  astar          A*\n"
                       << "  bfs            Breadth-First Search\n"
+                      << "  bit_bfs        Bit-Parallel Breadth-First Search\n"
                       << "  best_first     Best-First Search\n"
+                      << "  delta_stepping Parallel Delta-Stepping (compared against Dijkstra's Algorithm)\n"
                       << "  dfs            Depth-First Search\n"
                       << "  dijkstra       Dijkstra's Algorithm\n"
                       << "  eidastar       Enhanced Iterative-Deepening A*\n"
@@ -50,10 +69,28 @@ namespace test {
                       << "  smastar        Simplified Memory-Bounded A* Search\n"
                       << "  osmastar       Optimising Simplified Memory-Bounded A* Search\n"
                       << "  gstar          Graveyard Search (G*)\n"
+                      << "  hdastar        Hash-Distributed A* (scaling from 1 to 32 threads, compared against A*)\n"
                       << "  idastar        Iterative-Deepening A*\n"
                       << "  idbest_first   Iterative-Deepening Best-First Search\n"
                       << "  iddfs          Iterative-Deepening Depth-First Search\n"
                       << "  jps            Jump-Point Search\n"
+                      << "  lazy_thetastar Lazy Theta* (any-angle)\n"
+                      << "\nBenchmarks:\n"
+                      << "  auto           Solver selection thresholds, calibrated on open, cluttered and maze-like grids\n"
+                      << "  distance_map   Direction-optimising parallel BFS (scaling from 1 to 32 threads, compared against sequential BFS)\n"
+                      << "  pools          Memory pool configurations (size classes, huge pages, reset policies) compared against defaults\n"
+                      << "  queue          Ring-buffer queue compared against std::pmr::deque\n"
+                      << "  table          Open-addressing flat map compared against std::pmr::unordered_map\n"
+                      << "\nChecks:\n"
+                      << "  anytime        ARA* paths compared against A*, with and without a budget\n"
+                      << "  budget         Expansion, deadline, byte and cancellation limits interrupting a search\n"
+                      << "  buffers        Paths written into caller-provided buffers compared against solve()\n"
+                      << "  components     Connected-component labels compared against breadth-first search\n"
+                      << "  encoding       Run-length and waypoint path encodings expanded back into coordinates\n"
+                      << "  flow_field     Flow-field distances and directions compared against breadth-first search\n"
+                      << "  hierarchy      HPA* paths compared against breadth-first search, before and after edits\n"
+                      << "  registry       Solver lookup, rejection, path order and \"auto\" through chdr::solve()\n"
+                      << "  smoothing      Shortcut and string-pulled paths checked for line of sight\n"
                       << "\nMaze Weight Type:\n"
                       << "  bit            Search space represented using 1-bit values.\n"
                       << "  byte           Search space represented using 4-bit values.\n"
@@ -131,33 +168,52 @@ namespace test {
 
                 const scalar_type weight       =  1U;
                 const      size_t capacity     =  0U;
-                const      size_t memory_limit = 90U;
+                const      size_t memory_limit = 16U * 1024U * 1024U;
             };
 
             const params args { test, start, end, _size, chdr::heuristics::manhattan_distance<scalar_t, coord_t>, &monotonic, &heterogeneous, &homogeneous };
 
-                 if (_solver == "astar"        ) { result = invoke<chdr::solvers::        astar, params>(args); }
+                 if (_solver == "anytime"      ) { result = anytime::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
+            else if (_solver == "arastar"      ) { result = invoke<chdr::solvers::      arastar, params>(args); }
+            else if (_solver == "astar"        ) { result = invoke<chdr::solvers::        astar, params>(args); }
+            else if (_solver == "auto"         ) { selection::run(args); result = EXIT_SUCCESS; }
             else if (_solver == "best_first"   ) { result = invoke<chdr::solvers::   best_first, params>(args); }
             else if (_solver == "bfs"          ) { result = invoke<chdr::solvers::          bfs, params>(args); }
+            else if (_solver == "bit_bfs"      ) { result = invoke<chdr::solvers::      bit_bfs, params>(args); }
+            else if (_solver == "budget"       ) { result = budgets::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
+            else if (_solver == "buffers"      ) { result = buffers::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
+            else if (_solver == "components"   ) { result = components::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
+            else if (_solver == "delta_stepping") { sssp::run(args); result = EXIT_SUCCESS; }
             else if (_solver == "dfs"          ) { result = invoke<chdr::solvers::          dfs, params>(args); }
             else if (_solver == "dijkstra"     ) { result = invoke<chdr::solvers::     dijkstra, params>(args); }
+            else if (_solver == "distance_map" ) { breadth_first::run(args); result = EXIT_SUCCESS; }
             else if (_solver == "eidastar"     ) { result = invoke<chdr::solvers::     eidastar, params>(args); }
             else if (_solver == "eidbest_first") { result = invoke<chdr::solvers::eidbest_first, params>(args); }
             else if (_solver == "eiddfs"       ) { result = invoke<chdr::solvers::       eiddfs, params>(args); }
+            else if (_solver == "encoding"     ) { result = encodings::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
             else if (_solver == "flood"        ) { result = invoke<chdr::solvers::        flood, params>(args); }
+            else if (_solver == "flow_field"   ) { result = flow_fields::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
             else if (_solver == "fringe"       ) { result = invoke<chdr::solvers::       fringe, params>(args); }
             else if (_solver == "gbest_first"  ) { result = invoke<chdr::solvers::  gbest_first, params>(args); }
             else if (_solver == "gbfs"         ) { result = invoke<chdr::solvers::         gbfs, params>(args); }
             else if (_solver == "gdfs"         ) { result = invoke<chdr::solvers::         gdfs, params>(args); }
             else if (_solver == "gjps"         ) { result = invoke<chdr::solvers::         gjps, params>(args); }
             else if (_solver == "gstar"        ) { result = invoke<chdr::solvers::        gstar, params>(args); }
+            else if (_solver == "hdastar"      ) { scaling::run(args); result = EXIT_SUCCESS; }
+            else if (_solver == "hierarchy"    ) { result = hierarchy::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
             else if (_solver == "idastar"      ) { result = invoke<chdr::solvers::      idastar, params>(args); }
             else if (_solver == "idbest_first" ) { result = invoke<chdr::solvers:: idbest_first, params>(args); }
             else if (_solver == "iddfs"        ) { result = invoke<chdr::solvers::        iddfs, params>(args); }
             else if (_solver == "jps"          ) { result = invoke<chdr::solvers::          jps, params>(args); }
+            else if (_solver == "lazy_thetastar") { result = invoke<chdr::solvers::lazy_thetastar, params>(args); }
             else if (_solver == "mgstar"       ) { result = invoke<chdr::solvers::       mgstar, params>(args); }
             else if (_solver == "osmastar"     ) { result = invoke<chdr::solvers::     osmastar, params>(args); }
+            else if (_solver == "pools"        ) { pools::run(args); result = EXIT_SUCCESS; }
+            else if (_solver == "queue"        ) { fifo::run(args); result = EXIT_SUCCESS; }
+            else if (_solver == "registry"     ) { result = registry::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
             else if (_solver == "smastar"      ) { result = invoke<chdr::solvers::      smastar, params>(args); }
+            else if (_solver == "smoothing"    ) { result = smoothing::run(args) ? EXIT_SUCCESS : EXIT_FAILURE; }
+            else if (_solver == "table"        ) { tables::run(args); result = EXIT_SUCCESS; }
             else {
                 debug::log("ERROR: Unknown solver \"" + std::string(_solver) + "\"!", error);
             }